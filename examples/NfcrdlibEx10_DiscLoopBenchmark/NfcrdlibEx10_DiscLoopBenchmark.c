@@ -0,0 +1,662 @@
+/*
+*         Copyright (c), NXP Semiconductors Bangalore / India
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+* particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Example Source for NfcrdlibEx10_DiscLoopBenchmark that measures the cycle time of the Discovery loop.
+* Runs a scripted scenario (empty field, one card per technology, mixed Type A + Type V, colliding cards)
+* for a given number of poll cycles and reports p50/p99/max cycle time, SPI bytes per cycle and how the
+* cycle time splits into guard time, FDT/RF time and host (SPI and processing) time.
+* The bus traffic can be recorded to a trace file and replayed later without reader hardware, see
+* NfcrdlibEx10_Trace.h.
+*
+* Please refer Readme.txt file for Hardware Pin Configuration, Software Configuration and steps to build and
+* execute the project which is present in the same project directory.
+*
+*/
+
+/**
+ * Header for hardware configuration: bus interface, reset of attached reader ID, onboard LED handling etc.
+ * */
+#include <phhwConfig.h>
+
+/**
+* Reader Library Headers
+*/
+#include <ph_Status.h>
+
+/*Platform Headers*/
+#include <phPlatform.h>
+
+/*BAL Headers*/
+#include <phbalReg.h>
+
+/*PAL Headers*/
+#include <phpalI14443p3a.h>
+#include <phpalI14443p4.h>
+#include <phpalFelica.h>
+#include <phpalI14443p3b.h>
+#include <phpalI14443p4a.h>
+#include <phpalI18092mPI.h>
+#include <phpalSli15693.h>
+#include <phpalI18000p3m3.h>
+#include <phalI18000p3m3.h>
+
+/*AL Headers*/
+#include <phalT1T.h>
+
+#include <phacDiscLoop.h>
+
+#include "NfcrdlibEx10_Trace.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_DEFAULT_CYCLES        1000    /**< Poll cycles run per scenario if not given on command line */
+#define BENCH_MAX_CYCLES           100000   /**< Upper limit of poll cycles per scenario */
+
+/**
+* Benchmark scenario
+*/
+typedef struct
+{
+    const char *pName;                      /**< Scenario name given on command line */
+    const char *pSetup;                     /**< What to place in the field before starting */
+    uint8_t     bPollTechCfg;               /**< Technologies to poll */
+    uint8_t     bDeviceLimit;               /**< Device limit applied to all technologies */
+} Bench_Scenario_t;
+
+static const Bench_Scenario_t gScenarios[] = {
+    { "empty",     "Remove all cards from the field",                  0x3F, 1 },
+    { "typea",     "Place one Type A card",                            0x3F, 1 },
+    { "typeb",     "Place one Type B card",                            0x3F, 1 },
+    { "typef",     "Place one Type F (FeliCa) card",                   0x3F, 1 },
+    { "typev",     "Place one Type V (ISO 15693) card",                0x3F, 1 },
+    { "mixed_av",  "Place one Type A and one Type V card",             0x3F, 1 },
+    { "collision", "Place several Type A cards on top of each other",  PHAC_DISCLOOP_POS_BIT_MASK_A, PHAC_DISCLOOP_CFG_MAX_CARDS_SUPPORTED }
+};
+
+/*******************************************************************************
+**   Global Variable Declaration
+*******************************************************************************/
+phbalReg_Stub_DataParams_t         sBalReader;                 /**< BAL component holder */
+
+/*HAL variables*/
+phhalHw_Nfc_Ic_DataParams_t        sHal_Nfc_Ic;                /* HAL component holder for Nfc Ic's */
+uint8_t                            bHalBufferTx[256];          /* HAL TX buffer. Size 256 - Based on maximum FSL */
+uint8_t                            bHalBufferRx[256];          /* HAL RX buffer. Size 256 - Based on maximum FSL */
+void                              *pHal;                       /* HAL pointer */
+
+/*PAL variables*/
+phpalI14443p3a_Sw_DataParams_t     spalI14443p3a;              /* PAL ISO I14443-A component */
+phpalI14443p4a_Sw_DataParams_t     spalI14443p4a;              /* PAL ISO I14443-4A component */
+phpalI14443p3b_Sw_DataParams_t     spalI14443p3b;              /* PAL ISO I14443-B component */
+phpalI14443p4_Sw_DataParams_t      spalI14443p4;               /* PAL ISO I14443-4 component */
+phpalFelica_Sw_DataParams_t        spalFelica;                 /* PAL Felica component */
+phpalI18092mPI_Sw_DataParams_t     spalI18092mPI;              /* PAL ISO 18092 Initiator component */
+
+#ifndef NXPBUILD__PHHAL_HW_RC523
+phpalSli15693_Sw_DataParams_t      spalSli15693;               /* PAL ISO 15693 component */
+phalI18000p3m3_Sw_DataParams_t     salI18000p3m3;              /* AL ISO 18000p3m3 component */
+phpalI18000p3m3_Sw_DataParams_t    spalI18000p3m3;             /* PAL ISO 18000p3m3 component */
+#endif /* NXPBUILD__PHHAL_HW_RC523 */
+
+phPlatform_DataParams_t            sPlatform;                  /* OSAL component holder */
+
+/*DiscLoop variables*/
+phacDiscLoop_Sw_DataParams_t       sDiscLoop;                  /* Discovery loop component */
+
+/*Application Layer variables*/
+phalT1T_Sw_DataParams_t            alT1T;                      /* AL T1T component */
+
+static uint8_t    aData[50];                                   /* ATR/ATS response holder */
+static uint32_t   aCycleTimeUs[BENCH_MAX_CYCLES];               /* Measured cycle times */
+
+/*******************************************************************************
+**   Function Declarations
+*******************************************************************************/
+
+phStatus_t NfcRdLibInit(void);
+
+#ifdef NXPBUILD__PHHAL_HW_RC663
+/* Configure LPCD (for CLRC663) */
+static phStatus_t ConfigureLPCD(void)
+{
+    phStatus_t status;
+    uint8_t bValueI;
+    uint8_t bValueQ;
+
+    status = phhalHw_Rc663_Cmd_Lpcd_GetConfig(pHal, &bValueI, &bValueQ);
+    CHECK_SUCCESS(status);
+
+    status = phhalHw_Rc663_Cmd_Lpcd_SetConfig(
+        pHal,
+        PHHAL_HW_RC663_CMD_LPCD_MODE_POWERDOWN,
+        bValueI,
+        bValueQ,
+        1,
+        100);
+    CHECK_SUCCESS(status);
+
+    return phacDiscLoop_SetConfig(&sDiscLoop, PHAC_DISCLOOP_CONFIG_ENABLE_LPCD, PH_ON);
+}
+#endif
+
+#ifdef NXPBUILD__PHHAL_HW_PN5180
+/* Configure LPCD (for PN5180) */
+static phStatus_t ConfigureLPCD(void)
+{
+    phStatus_t status;
+    uint16_t wValue;
+
+    status = phhalHw_Pn5180_Int_LPCD_GetConfig(pHal, PHHAL_HW_CONFIG_LPCD_REF, &wValue);
+    CHECK_SUCCESS(status);
+
+    status = phhalHw_Pn5180_Int_LPCD_SetConfig(pHal, PHHAL_HW_CONFIG_LPCD_MODE, PHHAL_HW_PN5180_LPCD_MODE_POWERDOWN);
+    CHECK_SUCCESS(status);
+
+    return phacDiscLoop_SetConfig(&sDiscLoop, PHAC_DISCLOOP_CONFIG_ENABLE_LPCD, PH_ON);
+}
+#endif
+
+#ifdef NXPBUILD__PHHAL_HW_RC523
+/* LPCD is not supported by PN512 */
+static phStatus_t ConfigureLPCD(void)
+{
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_AC_DISCLOOP);
+}
+#endif
+
+/**
+* This function will initialize Reader LIbrary Component
+*/
+phStatus_t NfcRdLibInit(void)
+{
+    phStatus_t status;
+
+    /* Initialize the Reader BAL (Bus Abstraction Layer) component */
+    status = phbalReg_Stub_Init(
+        &sBalReader,
+        sizeof(phbalReg_Stub_DataParams_t));
+    CHECK_SUCCESS(status);
+
+    /* Initialize the OSAL Stub component */
+    status = phPlatform_Init(&sPlatform);
+    CHECK_SUCCESS(status);
+
+    /* Initialize the OSAL Events. */
+    status = phOsal_Event_Init();
+    CHECK_SUCCESS(status);
+
+    /* A replayed trace needs neither the interrupt thread nor the SPI port */
+    if(Trace_GetMode() != TRACE_MODE_REPLAY)
+    {
+        //Start interrupt thread
+        Set_Interrupt();
+    }
+
+    /* Set HAL type in BAL */
+#ifdef NXPBUILD__PHHAL_HW_PN5180
+    status = phbalReg_SetConfig(
+        &sBalReader,
+        PHBAL_REG_CONFIG_HAL_HW_TYPE,
+        PHBAL_REG_HAL_HW_PN5180);
+#endif
+#ifdef NXPBUILD__PHHAL_HW_RC523
+    status = phbalReg_SetConfig(
+        &sBalReader,
+        PHBAL_REG_CONFIG_HAL_HW_TYPE,
+        PHBAL_REG_HAL_HW_RC523);
+#endif
+#ifdef NXPBUILD__PHHAL_HW_RC663
+    status = phbalReg_SetConfig(
+        &sBalReader,
+        PHBAL_REG_CONFIG_HAL_HW_TYPE,
+        PHBAL_REG_HAL_HW_RC663);
+#endif
+    CHECK_SUCCESS(status);
+
+    status = phbalReg_SetPort(
+        &sBalReader,
+        SPI_CONFIG);
+    CHECK_SUCCESS(status);
+
+    /* Open BAL */
+    if(Trace_GetMode() != TRACE_MODE_REPLAY)
+    {
+        status = phbalReg_OpenPort(&sBalReader);
+        CHECK_SUCCESS(status);
+    }
+
+    /* Initialize the Reader HAL (Hardware Abstraction Layer) component */
+    status = phhalHw_Nfc_IC_Init(
+        &sHal_Nfc_Ic,
+        sizeof(phhalHw_Nfc_Ic_DataParams_t),
+        &sBalReader,
+        0,
+        bHalBufferTx,
+        sizeof(bHalBufferTx),
+        bHalBufferRx,
+        sizeof(bHalBufferRx));
+    CHECK_SUCCESS(status);
+
+    /* Set the parameter to use the SPI interface */
+    sHal_Nfc_Ic.sHal.bBalConnectionType = PHHAL_HW_BAL_CONNECTION_SPI;
+
+    Configure_Device(&sHal_Nfc_Ic);
+
+    /* Set the generic pointer */
+    pHal = &sHal_Nfc_Ic.sHal;
+
+    status = phpalI14443p3a_Sw_Init(&spalI14443p3a, sizeof(phpalI14443p3a_Sw_DataParams_t), pHal);
+    CHECK_SUCCESS(status);
+
+    status = phpalI14443p4a_Sw_Init(&spalI14443p4a, sizeof(phpalI14443p4a_Sw_DataParams_t), pHal);
+    CHECK_SUCCESS(status);
+
+    status = phpalI14443p4_Sw_Init(&spalI14443p4, sizeof(phpalI14443p4_Sw_DataParams_t), pHal);
+    CHECK_SUCCESS(status);
+
+    status = phpalI14443p3b_Sw_Init(&spalI14443p3b, sizeof(phpalI14443p3b_Sw_DataParams_t), pHal);
+    CHECK_SUCCESS(status);
+
+    status = phpalFelica_Sw_Init(&spalFelica, sizeof(phpalFelica_Sw_DataParams_t), pHal);
+    CHECK_SUCCESS(status);
+
+    status = phpalI18092mPI_Sw_Init(&spalI18092mPI, sizeof(phpalI18092mPI_Sw_DataParams_t), pHal);
+    CHECK_SUCCESS(status);
+
+#ifndef NXPBUILD__PHHAL_HW_RC523
+    status = phpalI18000p3m3_Sw_Init(&spalI18000p3m3, sizeof(phpalI18000p3m3_Sw_DataParams_t), pHal);
+    CHECK_SUCCESS(status);
+
+    status = phalI18000p3m3_Sw_Init(&salI18000p3m3, sizeof(phalI18000p3m3_Sw_DataParams_t), &spalI18000p3m3);
+    CHECK_SUCCESS(status);
+
+    status = phpalSli15693_Sw_Init(&spalSli15693, sizeof(phpalSli15693_Sw_DataParams_t), pHal);
+    CHECK_SUCCESS(status);
+#endif /* NXPBUILD__PHHAL_HW_RC523 */
+
+    status = phalT1T_Sw_Init(&alT1T, sizeof(phalT1T_Sw_DataParams_t), &spalI14443p3a);
+    CHECK_SUCCESS(status);
+
+    /* Initialize the discover component */
+    status = phacDiscLoop_Sw_Init(&sDiscLoop, sizeof(phacDiscLoop_Sw_DataParams_t), pHal);
+    CHECK_SUCCESS(status);
+
+    /* Assign other layer parameters in discovery loop */
+    sDiscLoop.pPal1443p3aDataParams   = &spalI14443p3a;
+    sDiscLoop.pPal1443p3bDataParams   = &spalI14443p3b;
+    sDiscLoop.pPal1443p4aDataParams   = &spalI14443p4a;
+    sDiscLoop.pPal14443p4DataParams   = &spalI14443p4;
+#ifndef NXPBUILD__PHHAL_HW_RC523
+    sDiscLoop.pPal18000p3m3DataParams = &spalI18000p3m3;
+    sDiscLoop.pAl18000p3m3DataParams  = &salI18000p3m3;
+    sDiscLoop.pPalSli15693DataParams  = &spalSli15693;
+#endif /* NXPBUILD__PHHAL_HW_RC523 */
+    sDiscLoop.pPal18092mPIDataParams  = &spalI18092mPI;
+    sDiscLoop.pPalFelicaDataParams    = &spalFelica;
+    sDiscLoop.pAlT1TDataParams        = &alT1T;
+    sDiscLoop.pHalDataParams          = pHal;
+
+    /* Assign ATR/ATS response buffers */
+    sDiscLoop.sTypeATargetInfo.sTypeA_P2P.pAtrRes   = aData;
+    sDiscLoop.sTypeFTargetInfo.sTypeF_P2P.pAtrRes   = aData;
+    sDiscLoop.sTypeATargetInfo.sTypeA_I3P4.pAts     = aData;
+
+    /* Passive polling only */
+    status = phacDiscLoop_SetConfig(&sDiscLoop, PHAC_DISCLOOP_CONFIG_ACT_POLL_TECH_CFG, 0x00);
+    CHECK_SUCCESS(status);
+
+    return PH_ERR_SUCCESS;
+}
+
+/**
+* Returns monotonic time in microseconds
+*/
+static uint64_t GetTimeUs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000U) + ((uint64_t)ts.tv_nsec / 1000U);
+}
+
+static int CompareU32(const void *pA, const void *pB)
+{
+    uint32_t dwA = *(const uint32_t *)pA;
+    uint32_t dwB = *(const uint32_t *)pB;
+
+    return (dwA > dwB) - (dwA < dwB);
+}
+
+/**
+* Sum of the configured guard times of the technologies polled in the last cycle.
+* The discovery loop applies one guard time per polled technology; Type F uses GTBF when
+* Type B is also configured for polling and GTFB otherwise.
+*/
+static uint32_t GetGuardTimeUs(uint8_t bPolledTechs, uint8_t bPollTechCfg)
+{
+    uint32_t dwGuardTimeUs = 0;
+    uint16_t wGtConfig;
+    uint16_t wValue;
+    uint8_t  bIndex;
+
+    for(bIndex = 0; bIndex < PHAC_DISCLOOP_PASS_POLL_MAX_TECHS_SUPPORTED; bIndex++)
+    {
+        if(!(bPolledTechs & (1 << bIndex)))
+        {
+            continue;
+        }
+
+        switch(bIndex)
+        {
+        case PHAC_DISCLOOP_TECH_TYPE_A:
+            wGtConfig = PHAC_DISCLOOP_CONFIG_GTA_VALUE_US;
+            break;
+        case PHAC_DISCLOOP_TECH_TYPE_B:
+            wGtConfig = PHAC_DISCLOOP_CONFIG_GTB_VALUE_US;
+            break;
+        case PHAC_DISCLOOP_TECH_TYPE_F212:
+        case PHAC_DISCLOOP_TECH_TYPE_F424:
+            wGtConfig = (bPollTechCfg & PHAC_DISCLOOP_POS_BIT_MASK_B) ?
+                PHAC_DISCLOOP_CONFIG_GTBF_VALUE_US : PHAC_DISCLOOP_CONFIG_GTFB_VALUE_US;
+            break;
+        case PHAC_DISCLOOP_TECH_TYPE_V:
+            wGtConfig = PHAC_DISCLOOP_CONFIG_GTV_VALUE_US;
+            break;
+        default:
+            wGtConfig = PHAC_DISCLOOP_CONFIG_GT18000P3M3_VALUE_US;
+            break;
+        }
+
+        if(phacDiscLoop_GetConfig(&sDiscLoop, wGtConfig, &wValue) == PH_ERR_SUCCESS)
+        {
+            dwGuardTimeUs += wValue;
+        }
+    }
+
+    return dwGuardTimeUs;
+}
+
+/**
+* Runs the given scenario for the given number of poll cycles and prints the statistics.
+*/
+static phStatus_t RunScenario(const Bench_Scenario_t *pScenario, uint32_t dwCycles, uint8_t bLpcd)
+{
+    phStatus_t status;
+    uint8_t    bPollTechCfg;
+    uint16_t   wPolledTechs;
+    uint32_t   dwCycle;
+    uint32_t   dwActivated = 0;
+    uint32_t   dwBusBytes;
+    uint32_t   dwElapsedUs;
+    uint32_t   dwRfUs;
+    uint32_t   dwGuardUs;
+    uint64_t   qwStart;
+    uint64_t   qwRfStart;
+    uint64_t   qwTotalUs = 0;
+    uint64_t   qwGuardUs = 0;
+    uint64_t   qwRfUs = 0;
+    uint64_t   qwHostUs = 0;
+
+    bPollTechCfg = pScenario->bPollTechCfg;
+#ifdef NXPBUILD__PHHAL_HW_RC523
+    /* Type V and 18000p3m3 are not supported by PN512 */
+    bPollTechCfg &= (uint8_t)~(PHAC_DISCLOOP_POS_BIT_MASK_V | PHAC_DISCLOOP_POS_BIT_MASK_18000P3M3);
+#endif /* NXPBUILD__PHHAL_HW_RC523 */
+
+    status = phacDiscLoop_SetConfig(&sDiscLoop, PHAC_DISCLOOP_CONFIG_TYPEA_DEVICE_LIMIT, pScenario->bDeviceLimit);
+    CHECK_SUCCESS(status);
+
+    if(bLpcd)
+    {
+        status = ConfigureLPCD();
+        CHECK_SUCCESS(status);
+    }
+
+    if(Trace_GetMode() == TRACE_MODE_REPLAY)
+    {
+        DEBUG_PRINTF("\n Scenario '%s': replaying trace", pScenario->pName);
+    }
+    else
+    {
+        DEBUG_PRINTF("\n Scenario '%s': %s, then press Enter.", pScenario->pName, pScenario->pSetup);
+        (void)getchar();
+    }
+
+    dwBusBytes = sBalReader.dwTxBytes + sBalReader.dwRxBytes;
+
+    for(dwCycle = 0; dwCycle < dwCycles; dwCycle++)
+    {
+        status = phacDiscLoop_SetConfig(&sDiscLoop, PHAC_DISCLOOP_CONFIG_NEXT_POLL_STATE, PHAC_DISCLOOP_POLL_STATE_DETECTION);
+        CHECK_SUCCESS(status);
+
+        status = phacDiscLoop_SetConfig(&sDiscLoop, PHAC_DISCLOOP_CONFIG_PAS_POLL_TECH_CFG, bPollTechCfg);
+        CHECK_SUCCESS(status);
+
+        /* Every cycle starts with the field off, as in a real polling loop */
+        status = phhalHw_FieldOff(pHal);
+        CHECK_SUCCESS(status);
+
+        qwRfStart = Trace_GetRfWaitUs();
+        qwStart = GetTimeUs();
+        status = phacDiscLoop_Run(&sDiscLoop, PHAC_DISCLOOP_ENTRY_POINT_POLL);
+        dwElapsedUs = (uint32_t)(GetTimeUs() - qwStart);
+        dwRfUs = (uint32_t)(Trace_GetRfWaitUs() - qwRfStart);
+
+        if(Trace_Diverged() == PH_ON)
+        {
+            dwCycles = dwCycle;
+            break;
+        }
+
+        /* A replayed wait returns at once, the recorded RF time is added instead */
+        if(Trace_GetMode() == TRACE_MODE_REPLAY)
+        {
+            dwElapsedUs += dwRfUs;
+        }
+        aCycleTimeUs[dwCycle] = dwElapsedUs;
+        qwTotalUs += dwElapsedUs;
+
+        if(((status & PH_ERR_MASK) == PHAC_DISCLOOP_DEVICE_ACTIVATED) ||
+           ((status & PH_ERR_MASK) == PHAC_DISCLOOP_PASSIVE_TARGET_ACTIVATED) ||
+           ((status & PH_ERR_MASK) == PHAC_DISCLOOP_MULTI_DEVICES_RESOLVED) ||
+           ((status & PH_ERR_MASK) == PHAC_DISCLOOP_MULTI_TECH_DETECTED))
+        {
+            dwActivated++;
+        }
+
+        /* Guard times are part of the RF waits; clamp so that no share goes negative */
+        status = phacDiscLoop_GetConfig(&sDiscLoop, PHAC_DISCLOOP_CONFIG_POLLED_TECHS, &wPolledTechs);
+        CHECK_SUCCESS(status);
+        dwGuardUs = GetGuardTimeUs((uint8_t)wPolledTechs, bPollTechCfg);
+        if(dwRfUs > dwElapsedUs)
+        {
+            dwRfUs = dwElapsedUs;
+        }
+        if(dwGuardUs > dwRfUs)
+        {
+            dwGuardUs = dwRfUs;
+        }
+        qwGuardUs += dwGuardUs;
+        qwRfUs += dwRfUs - dwGuardUs;
+        qwHostUs += dwElapsedUs - dwRfUs;
+    }
+
+    dwBusBytes = (sBalReader.dwTxBytes + sBalReader.dwRxBytes) - dwBusBytes;
+
+    if(dwCycles == 0)
+    {
+        DEBUG_PRINTF("\n  no cycle matched the trace\n");
+        return PH_ADD_COMPCODE(PH_ERR_INTERFACE_ERROR, PH_COMP_BAL);
+    }
+
+    qsort(aCycleTimeUs, dwCycles, sizeof(aCycleTimeUs[0]), CompareU32);
+
+    DEBUG_PRINTF("\n  cycles          : %u (%u with card found)", dwCycles, dwActivated);
+    DEBUG_PRINTF("\n  cycle time p50  : %u us", aCycleTimeUs[(dwCycles * 50) / 100]);
+    DEBUG_PRINTF("\n  cycle time p99  : %u us", aCycleTimeUs[(dwCycles * 99) / 100]);
+    DEBUG_PRINTF("\n  cycle time max  : %u us", aCycleTimeUs[dwCycles - 1]);
+    DEBUG_PRINTF("\n  cycle time mean : %u us", (uint32_t)(qwTotalUs / dwCycles));
+    DEBUG_PRINTF("\n  SPI bytes/cycle : %u", dwBusBytes / dwCycles);
+    DEBUG_PRINTF("\n  guard time/cycle: %u us (configured, polled technologies)", (uint32_t)(qwGuardUs / dwCycles));
+    DEBUG_PRINTF("\n  FDT/RF/cycle    : %u us (other RF waits: FDT and frame air time)", (uint32_t)(qwRfUs / dwCycles));
+    DEBUG_PRINTF("\n  host/cycle      : %u us (SPI and host processing)\n", (uint32_t)(qwHostUs / dwCycles));
+
+    if(bLpcd)
+    {
+        status = phacDiscLoop_SetConfig(&sDiscLoop, PHAC_DISCLOOP_CONFIG_ENABLE_LPCD, PH_OFF);
+        CHECK_SUCCESS(status);
+    }
+
+    return PH_ERR_SUCCESS;
+}
+
+static void PrintUsage(const char *pProgram)
+{
+    uint32_t dwIndex;
+
+    DEBUG_PRINTF("\n Usage: %s [scenario|all] [cycles] [lpcd] [record=<file>|replay=<file>]\n Scenarios:", pProgram);
+    for(dwIndex = 0; dwIndex < (sizeof(gScenarios) / sizeof(gScenarios[0])); dwIndex++)
+    {
+        DEBUG_PRINTF("\n   %-10s %s", gScenarios[dwIndex].pName, gScenarios[dwIndex].pSetup);
+    }
+    DEBUG_PRINTF("\n");
+}
+
+/*******************************************************************************
+**   Main Function
+*******************************************************************************/
+int main (int argc, char *argv[])
+{
+    int        ret = 0;
+    const char *pScenario = "all";
+    uint32_t   dwCycles = BENCH_DEFAULT_CYCLES;
+    uint8_t    bLpcd = PH_OFF;
+    uint32_t   dwIndex;
+    uint8_t    bFound = PH_OFF;
+    uint8_t    bTraceMode = TRACE_MODE_OFF;
+    const char *pTraceFile = NULL;
+    int        argIndex;
+    int        numPositional = 0;
+    phStatus_t status;
+
+    for(argIndex = 1; argIndex < argc; argIndex++)
+    {
+        if(strcmp(argv[argIndex], "lpcd") == 0)
+        {
+            bLpcd = PH_ON;
+        }
+        else if(strncmp(argv[argIndex], "record=", 7) == 0)
+        {
+            bTraceMode = TRACE_MODE_RECORD;
+            pTraceFile = &argv[argIndex][7];
+        }
+        else if(strncmp(argv[argIndex], "replay=", 7) == 0)
+        {
+            bTraceMode = TRACE_MODE_REPLAY;
+            pTraceFile = &argv[argIndex][7];
+        }
+        else if(numPositional == 0)
+        {
+            pScenario = argv[argIndex];
+            numPositional++;
+        }
+        else if(numPositional == 1)
+        {
+            dwCycles = (uint32_t)strtoul(argv[argIndex], NULL, 0);
+            numPositional++;
+        }
+        else
+        {
+            dwCycles = 0;
+        }
+    }
+    if((dwCycles == 0) || (dwCycles > BENCH_MAX_CYCLES))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if(bTraceMode != TRACE_MODE_OFF)
+    {
+        status = Trace_Open(bTraceMode, pTraceFile);
+        if(status != PH_ERR_SUCCESS)
+        {
+            DEBUG_PRINTF("\n Cannot open trace file '%s'\n", pTraceFile);
+            return 1;
+        }
+    }
+
+    if(bTraceMode != TRACE_MODE_REPLAY)
+    {
+        /* Set the interface link for the internal chip communication */
+        ret = Set_Interface_Link();
+        if(ret)
+        {
+            Trace_Close();
+            return 1;
+        }
+
+        /* Perform a hardware reset */
+        Reset_reader_device();
+    }
+
+    DEBUG_PRINTF("\n DiscLoopBenchmark Example: \n");
+
+    status = NfcRdLibInit();
+    CHECK_STATUS(status);
+
+    if(status == PH_ERR_SUCCESS)
+    {
+        for(dwIndex = 0; dwIndex < (sizeof(gScenarios) / sizeof(gScenarios[0])); dwIndex++)
+        {
+            if((strcmp(pScenario, "all") == 0) || (strcmp(pScenario, gScenarios[dwIndex].pName) == 0))
+            {
+                bFound = PH_ON;
+                status = RunScenario(&gScenarios[dwIndex], dwCycles, bLpcd);
+                CHECK_STATUS(status);
+
+                /* The rest of the trace belongs to a different run */
+                if(Trace_Diverged() == PH_ON)
+                {
+                    ret = 1;
+                    break;
+                }
+            }
+        }
+
+        if(bFound == PH_OFF)
+        {
+            PrintUsage(argv[0]);
+            ret = 1;
+        }
+
+        (void)phhalHw_FieldOff(pHal);
+    }
+
+    if(bTraceMode != TRACE_MODE_REPLAY)
+    {
+        Cleanup_Interface_Link();
+    }
+    Trace_Close();
+
+    return ret;
+}
+
+/******************************************************************************
+**                            End Of File
+******************************************************************************/
@@ -0,0 +1,410 @@
+/*
+*         Copyright (c), NXP Semiconductors Bangalore / India
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+* particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Bus trace recording and replay for NfcrdlibEx10_DiscLoopBenchmark.
+* Please refer NfcrdlibEx10_Trace.h for the trace format.
+*/
+
+#include <ph_Status.h>
+#include <phOsal.h>
+#include <phbalReg.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "NfcrdlibEx10_Trace.h"
+
+#define TRACE_MAX_DATA_LEN      1024U   /**< Largest exchange stored in a record */
+#define TRACE_MAX_LINE_LEN      ((4U * TRACE_MAX_DATA_LEN) + 128U)
+
+/**
+* One replayed record
+*/
+typedef struct
+{
+    uint8_t     bType;          /**< 'X' or 'W' */
+    phStatus_t  wStatus;        /**< Returned status */
+    uint16_t    wTxLen;         /**< X: length of TX data */
+    uint16_t    wRxLen;         /**< X: length of RX data */
+    uint32_t    dwDataPos;      /**< X: position of TX data, followed by RX data, in the data pool */
+    uint32_t    dwBusTxBytes;   /**< X: bus TX bytes counted by the BAL */
+    uint32_t    dwBusRxBytes;   /**< X: bus RX bytes counted by the BAL */
+    uint32_t    dwEvents;       /**< W: received events */
+    uint32_t    dwWaitUs;       /**< W: wait time */
+} Trace_Record_t;
+
+/* Functions provided by the linker for the wrapped symbols */
+phStatus_t __real_phbalReg_Stub_Exchange(phbalReg_Stub_DataParams_t * pDataParams, uint16_t wOption,
+    uint8_t * pTxBuffer, uint16_t wTxLength, uint16_t wRxBufSize, uint8_t * pRxBuffer, uint16_t * pRxLength);
+phStatus_t __real_phOsal_Event_WaitAny(phOsal_EventType_t eEvtType, uint32_t dwTimeoutCount,
+    phOsal_EventType_t *pRcvdEvt);
+
+static uint8_t          bTraceMode = TRACE_MODE_OFF;
+static FILE            *pTraceFile = NULL;
+static uint64_t         qwRfWaitUs = 0;
+static uint8_t          bDiverged = PH_OFF;
+
+static Trace_Record_t  *pRecords = NULL;
+static uint32_t         dwNumRecords = 0;
+static uint32_t         dwNextRecord = 0;
+static uint8_t         *pDataPool = NULL;
+static uint32_t         dwDataPoolLen = 0;
+
+static uint64_t Trace_GetTimeUs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000U) + ((uint64_t)ts.tv_nsec / 1000U);
+}
+
+static void Trace_WriteHex(const uint8_t *pData, uint16_t wLen)
+{
+    uint16_t wIndex;
+
+    if((pData == NULL) || (wLen == 0))
+    {
+        fputs(" -", pTraceFile);
+        return;
+    }
+
+    fputc(' ', pTraceFile);
+    for(wIndex = 0; wIndex < wLen; wIndex++)
+    {
+        fprintf(pTraceFile, "%02X", pData[wIndex]);
+    }
+}
+
+/* Parses a hex field into the data pool, returns the number of bytes or -1 */
+static int32_t Trace_ParseHex(const char *pHex, uint8_t *pOut)
+{
+    size_t   len;
+    size_t   i;
+    unsigned int byte;
+
+    if(strcmp(pHex, "-") == 0)
+    {
+        return 0;
+    }
+
+    len = strlen(pHex);
+    if(((len % 2U) != 0) || ((len / 2U) > TRACE_MAX_DATA_LEN))
+    {
+        return -1;
+    }
+
+    for(i = 0; i < len; i += 2U)
+    {
+        if(sscanf(&pHex[i], "%2x", &byte) != 1)
+        {
+            return -1;
+        }
+        pOut[i / 2U] = (uint8_t)byte;
+    }
+
+    return (int32_t)(len / 2U);
+}
+
+static phStatus_t Trace_Load(void)
+{
+    static char     aLine[TRACE_MAX_LINE_LEN];
+    static char     aTx[(2U * TRACE_MAX_DATA_LEN) + 1U];
+    static char     aRx[(2U * TRACE_MAX_DATA_LEN) + 1U];
+    Trace_Record_t  sRecord;
+    uint32_t        dwCapacity = 0;
+    uint32_t        dwPoolCapacity = 0;
+    unsigned int    dwStatus;
+    unsigned int    dwA;
+    unsigned int    dwB;
+    unsigned int    dwC;
+    int32_t         dwLen;
+
+    while(fgets(aLine, sizeof(aLine), pTraceFile) != NULL)
+    {
+        memset(&sRecord, 0, sizeof(sRecord));
+
+        if(aLine[0] == 'X')
+        {
+            if(sscanf(aLine, "X %2048s %2048s %x %u %u", aTx, aRx, &dwStatus, &dwA, &dwB) != 5)
+            {
+                return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_BAL);
+            }
+
+            /* Room for TX and RX data of this record */
+            if((dwPoolCapacity - dwDataPoolLen) < (2U * TRACE_MAX_DATA_LEN))
+            {
+                dwPoolCapacity = (dwPoolCapacity * 2U) + (4U * TRACE_MAX_DATA_LEN);
+                pDataPool = realloc(pDataPool, dwPoolCapacity);
+                if(pDataPool == NULL)
+                {
+                    return PH_ADD_COMPCODE(PH_ERR_RESOURCE_ERROR, PH_COMP_BAL);
+                }
+            }
+
+            sRecord.bType = 'X';
+            sRecord.wStatus = (phStatus_t)dwStatus;
+            sRecord.dwBusTxBytes = dwA;
+            sRecord.dwBusRxBytes = dwB;
+            sRecord.dwDataPos = dwDataPoolLen;
+
+            dwLen = Trace_ParseHex(aTx, &pDataPool[dwDataPoolLen]);
+            if(dwLen < 0)
+            {
+                return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_BAL);
+            }
+            sRecord.wTxLen = (uint16_t)dwLen;
+
+            dwLen = Trace_ParseHex(aRx, &pDataPool[dwDataPoolLen + sRecord.wTxLen]);
+            if(dwLen < 0)
+            {
+                return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_BAL);
+            }
+            sRecord.wRxLen = (uint16_t)dwLen;
+
+            dwDataPoolLen += (uint32_t)sRecord.wTxLen + sRecord.wRxLen;
+        }
+        else if(aLine[0] == 'W')
+        {
+            if(sscanf(aLine, "W %x %x %x %u", &dwA, &dwB, &dwStatus, &dwC) != 4)
+            {
+                return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_BAL);
+            }
+
+            sRecord.bType = 'W';
+            sRecord.dwEvents = dwB;
+            sRecord.wStatus = (phStatus_t)dwStatus;
+            sRecord.dwWaitUs = dwC;
+        }
+        else
+        {
+            /* Comment or empty line */
+            continue;
+        }
+
+        if(dwNumRecords == dwCapacity)
+        {
+            dwCapacity = (dwCapacity * 2U) + 1024U;
+            pRecords = realloc(pRecords, dwCapacity * sizeof(Trace_Record_t));
+            if(pRecords == NULL)
+            {
+                return PH_ADD_COMPCODE(PH_ERR_RESOURCE_ERROR, PH_COMP_BAL);
+            }
+        }
+        pRecords[dwNumRecords++] = sRecord;
+    }
+
+    return PH_ERR_SUCCESS;
+}
+
+/* Returns the next replayed record of the given type, NULL once the run diverged */
+static Trace_Record_t * Trace_NextRecord(uint8_t bType)
+{
+    if((bDiverged == PH_OFF) &&
+        ((dwNextRecord >= dwNumRecords) || (pRecords[dwNextRecord].bType != bType)))
+    {
+        printf("\n Trace replay diverged at record %u of %u\n", dwNextRecord + 1U, dwNumRecords);
+        bDiverged = PH_ON;
+    }
+
+    if(bDiverged == PH_ON)
+    {
+        return NULL;
+    }
+
+    return &pRecords[dwNextRecord++];
+}
+
+phStatus_t Trace_Open(uint8_t bMode, const char *pFileName)
+{
+    phStatus_t status = PH_ERR_SUCCESS;
+
+    pTraceFile = fopen(pFileName, (bMode == TRACE_MODE_RECORD) ? "w" : "r");
+    if(pTraceFile == NULL)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_BAL);
+    }
+
+    if(bMode == TRACE_MODE_RECORD)
+    {
+        fprintf(pTraceFile, "# NfcrdlibEx10_DiscLoopBenchmark bus trace\n");
+    }
+    else
+    {
+        status = Trace_Load();
+        fclose(pTraceFile);
+        pTraceFile = NULL;
+    }
+
+    if(status == PH_ERR_SUCCESS)
+    {
+        bTraceMode = bMode;
+    }
+
+    return status;
+}
+
+void Trace_Close(void)
+{
+    if(pTraceFile != NULL)
+    {
+        fclose(pTraceFile);
+        pTraceFile = NULL;
+    }
+
+    free(pRecords);
+    free(pDataPool);
+    pRecords = NULL;
+    pDataPool = NULL;
+    bTraceMode = TRACE_MODE_OFF;
+}
+
+uint8_t Trace_GetMode(void)
+{
+    return bTraceMode;
+}
+
+uint64_t Trace_GetRfWaitUs(void)
+{
+    return qwRfWaitUs;
+}
+
+uint8_t Trace_Diverged(void)
+{
+    return bDiverged;
+}
+
+phStatus_t __wrap_phbalReg_Stub_Exchange(
+                                         phbalReg_Stub_DataParams_t * pDataParams,
+                                         uint16_t wOption,
+                                         uint8_t * pTxBuffer,
+                                         uint16_t wTxLength,
+                                         uint16_t wRxBufSize,
+                                         uint8_t * pRxBuffer,
+                                         uint16_t * pRxLength
+                                         )
+{
+    phStatus_t      status;
+    Trace_Record_t *pRecord;
+    uint32_t        dwTxBytes;
+    uint32_t        dwRxBytes;
+    uint16_t        wRxLength = 0;
+
+    if(bTraceMode == TRACE_MODE_REPLAY)
+    {
+        pRecord = Trace_NextRecord('X');
+        if((pRecord != NULL) &&
+            ((pRecord->wTxLen != wTxLength) || (pRecord->wRxLen > wRxBufSize) ||
+            (memcmp(&pDataPool[pRecord->dwDataPos], pTxBuffer, wTxLength) != 0)))
+        {
+            printf("\n Trace replay diverged at record %u of %u\n", dwNextRecord, dwNumRecords);
+            bDiverged = PH_ON;
+            pRecord = NULL;
+        }
+        if(pRecord == NULL)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INTERFACE_ERROR, PH_COMP_BAL);
+        }
+
+        if((pRxBuffer != NULL) && (pRecord->wRxLen != 0))
+        {
+            memcpy(pRxBuffer, &pDataPool[pRecord->dwDataPos + pRecord->wTxLen], pRecord->wRxLen);
+        }
+        if(pRxLength != NULL)
+        {
+            *pRxLength = pRecord->wRxLen;
+        }
+        pDataParams->dwTxBytes += pRecord->dwBusTxBytes;
+        pDataParams->dwRxBytes += pRecord->dwBusRxBytes;
+
+        return pRecord->wStatus;
+    }
+
+    dwTxBytes = pDataParams->dwTxBytes;
+    dwRxBytes = pDataParams->dwRxBytes;
+
+    status = __real_phbalReg_Stub_Exchange(pDataParams, wOption, pTxBuffer, wTxLength, wRxBufSize, pRxBuffer, pRxLength);
+
+    if(bTraceMode == TRACE_MODE_RECORD)
+    {
+        if((pRxLength != NULL) && (pRxBuffer != NULL) && (*pRxLength <= TRACE_MAX_DATA_LEN))
+        {
+            wRxLength = *pRxLength;
+        }
+
+        fputc('X', pTraceFile);
+        Trace_WriteHex(pTxBuffer, wTxLength);
+        Trace_WriteHex(pRxBuffer, wRxLength);
+        fprintf(pTraceFile, " %04X %u %u\n", status,
+            pDataParams->dwTxBytes - dwTxBytes,
+            pDataParams->dwRxBytes - dwRxBytes);
+    }
+
+    return status;
+}
+
+phStatus_t __wrap_phOsal_Event_WaitAny(
+                                       phOsal_EventType_t eEvtType,
+                                       uint32_t dwTimeoutCount,
+                                       phOsal_EventType_t *pRcvdEvt
+                                       )
+{
+    phStatus_t          status;
+    Trace_Record_t     *pRecord;
+    phOsal_EventType_t  eRcvdEvt = (phOsal_EventType_t)0;
+    uint64_t            qwStart;
+    uint32_t            dwWaitUs;
+
+    if(bTraceMode == TRACE_MODE_REPLAY)
+    {
+        pRecord = Trace_NextRecord('W');
+        if(pRecord == NULL)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_IO_TIMEOUT, PH_COMP_OSAL);
+        }
+
+        if(eEvtType & E_PH_OSAL_EVT_RF)
+        {
+            qwRfWaitUs += pRecord->dwWaitUs;
+        }
+        if(pRcvdEvt != NULL)
+        {
+            *pRcvdEvt = (phOsal_EventType_t)pRecord->dwEvents;
+        }
+
+        return pRecord->wStatus;
+    }
+
+    qwStart = Trace_GetTimeUs();
+    status = __real_phOsal_Event_WaitAny(eEvtType, dwTimeoutCount, &eRcvdEvt);
+    dwWaitUs = (uint32_t)(Trace_GetTimeUs() - qwStart);
+
+    if(eEvtType & E_PH_OSAL_EVT_RF)
+    {
+        qwRfWaitUs += dwWaitUs;
+    }
+    if(pRcvdEvt != NULL)
+    {
+        *pRcvdEvt = eRcvdEvt;
+    }
+
+    if(bTraceMode == TRACE_MODE_RECORD)
+    {
+        fprintf(pTraceFile, "W %X %X %04X %u\n", (unsigned int)eEvtType, (unsigned int)eRcvdEvt, status, dwWaitUs);
+    }
+
+    return status;
+}
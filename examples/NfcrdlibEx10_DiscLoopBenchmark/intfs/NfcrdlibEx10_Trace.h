@@ -0,0 +1,67 @@
+/*
+*         Copyright (c), NXP Semiconductors Bangalore / India
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+* particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Bus trace recording and replay for NfcrdlibEx10_DiscLoopBenchmark.
+*
+* The executable is linked with --wrap=phbalReg_Stub_Exchange and --wrap=phOsal_Event_WaitAny,
+* so every SPI exchange of the HAL and every wait of the HAL for an RF (IRQ) event passes
+* through this module. It measures the time the HAL waits for RF events (guard times, FDT
+* and frame air time) and can record all exchanges and waits to a text file, or replay such
+* a file instead of talking to the reader IC. Replay reproduces the exact register traffic of
+* the recorded run, so host processing time can be compared without hardware.
+*
+* Trace file, one record per line, hex fields, '-' for no data:
+*   X <tx data> <rx data> <status> <bus tx bytes> <bus rx bytes>
+*   W <awaited events> <received events> <status> <wait time in us>
+*/
+
+#ifndef EX10_TRACE_H
+#define EX10_TRACE_H
+
+#include <ph_Status.h>
+#include <stdint.h>
+
+#define TRACE_MODE_OFF      0x00U   /**< Talk to the reader IC, no recording. */
+#define TRACE_MODE_RECORD   0x01U   /**< Talk to the reader IC and record all exchanges and waits. */
+#define TRACE_MODE_REPLAY   0x02U   /**< Replay a recorded trace, no reader IC needed. */
+
+/**
+* Start recording to / replaying from the given file. Replay loads the complete trace.
+*/
+phStatus_t Trace_Open(uint8_t bMode, const char *pFileName);
+
+/**
+* Flush and close the trace file.
+*/
+void Trace_Close(void);
+
+/**
+* Returns the active trace mode.
+*/
+uint8_t Trace_GetMode(void);
+
+/**
+* Returns the total time the HAL waited for RF events since start, in microseconds.
+* In replay mode this is the recorded wait time.
+*/
+uint64_t Trace_GetRfWaitUs(void);
+
+/**
+* Returns PH_ON if the replayed run no longer matches the trace (different command line,
+* library configuration or end of trace).
+*/
+uint8_t Trace_Diverged(void);
+
+#endif /* EX10_TRACE_H */
@@ -16,6 +16,7 @@
  * Example Source for NfcrdlibEx5_ISO15693 that uses the ISO15693 implementation.
  * This example will load/configure Discovery loop for ISO15693, uses POLL mode to detect the ISO15693 card.
  * Displays detected ISO15693 card information like UID, Card Type, Block Read and Block Write operation status.
+ * For NXP ICODE tags the block read throughput of the standard commands and of the ICODE fast mode is compared.
  * Example will activate the device at index zero whenever multiple MIFARE Classic cards are detected.
  *
  * Please refer Readme.txt file for Hardware Pin Configuration, Software Configuration and steps to build and
@@ -58,9 +59,13 @@
 
 /* AL Headers */
 #include <phalI15693.h>
+#include <phalSli.h>
 
 #include <phacDiscLoop.h>
 
+#include <stdint.h>
+#include <time.h>
+
 #define ISO15693_NXP_TAG_ID             0x04    /* ISO15693 NXP Cards specific code */
 #define ISO15693_UID_NXP_IDPOS          6       /* ISO15693 NXP Cards specific code position (UID6) */
 #define ISO15693_UID_SIZE_BITS    		64      /* ISO15693 UID Size in Bits */
@@ -76,6 +81,7 @@
 #define ISO15693_MFGID_SLI_STATE        0
 #define ISO15693_MFGID_SLIX_STATE       2
 #define ISO15693_MFGID_SLIX2_STATE      1
+#define ISO15693_MFGID_DNA_STATE        3
 
 /* SLI Card Type states */
 #define ISO15693_UID_SLI_STATE          1
@@ -87,6 +93,10 @@
 #define ISO15693_UID_SLIX_S_STATE       2
 #define ISO15693_UID_SLIX_L_STATE       3
 
+/* Throughput benchmark */
+#define BENCH_NUM_BLOCKS                8       /* Blocks read per frame; all ICODE variants have at least 8 blocks */
+#define BENCH_NUM_FRAMES                50      /* Frames read per mode */
+
 /*******************************************************************************
 **   Global Variable Declaration
 *******************************************************************************/
@@ -106,6 +116,7 @@ phpalMifare_Sw_DataParams_t        spalMifare;                 /* PAL  MIFARE co
 phpalSli15693_Sw_DataParams_t       spalSli15693;       /* PAL ISO 15693 component */
 phacDiscLoop_Sw_DataParams_t        sDiscLoop;          /* Discovery loop component */
 phalI15693_Sw_DataParams_t          salI15693;          /* 15693 SW Data Params */
+phalSli_Sw_DataParams_t             salSli;             /* ICODE SLI SW Data Params */
 
 /***********************************************************************************************
  * \brief   Print a given array of integers on the console
@@ -279,6 +290,13 @@ phStatus_t NfcRdLibInit(void)
     status = phalI15693_Sw_Init(&salI15693, sizeof(salI15693), sDiscLoop.pPalSli15693DataParams);
     CHECK_SUCCESS(status);
 
+    /* Initialize ICODE SLI application layer */
+    status = phalSli_Sw_Init(&salSli, sizeof(salSli), sDiscLoop.pPalSli15693DataParams);
+    CHECK_SUCCESS(status);
+
+    /* Standard block commands of phalSli_ReadBlocks/WriteBlocks */
+    salSli.pAlI15693DataParams = &salI15693;
+
     /* Read Chip Version */
 #if defined NXPBUILD__PHHAL_HW_RC663
     status = phhalHw_Rc663_ReadRegister(&sHal_Nfc_Ic.sHal, PHHAL_HW_RC663_REG_VERSION, &bChipVersion);
@@ -377,6 +395,11 @@ phStatus_t DisplayCardTypeInfo(uint8_t *pUID)
         DEBUG_PRINTF("\nProduct: ICODE SLIX2\n");
         break;
 
+    case ISO15693_MFGID_DNA_STATE:          /* DNA Card state */
+        /* Print Product type */
+        DEBUG_PRINTF("\nProduct: ICODE DNA\n");
+        break;
+
     default:                                /* default */
         /* Print Product type */
         DEBUG_PRINTF("\nProduct: Unidentified Tag\n");
@@ -389,6 +412,83 @@ phStatus_t DisplayCardTypeInfo(uint8_t *pUID)
     return status;
 }
 
+/***********************************************************************************************
+ * \brief   Reads the first blocks of the tag repeatedly with the standard ISO15693 commands and
+ *          with the ICODE fast mode and displays the throughput of both per detected tag family.
+ * \param   none
+ * \return  status  Returns the function status
+ **********************************************************************************************/
+static phStatus_t ThroughputBenchmark(void)
+{
+    static const char * const aFamilyName[] = {"Unknown", "ICODE SLI", "ICODE SLIX", "ICODE SLIX2", "ICODE DNA"};
+    phStatus_t      status;
+    uint8_t         bFamily;
+    uint8_t         bMode;
+    uint8_t         bFastMode;
+    uint8_t         aData[BENCH_NUM_BLOCKS * PHAL_SLI_BLOCK_SIZE];
+    uint16_t        wDataLength;
+    uint16_t        wFrame;
+    uint32_t        dwNumBytes;
+    uint32_t        dwTimeUs;
+    struct timespec sStart;
+    struct timespec sEnd;
+
+    status = phalSli_DetectFamily(&salSli, &bFamily);
+    CHECK_SUCCESS(status);
+
+    DEBUG_PRINTF("\nThroughput benchmark for %s (%d blocks per frame, %d frames)",
+        aFamilyName[bFamily], BENCH_NUM_BLOCKS, BENCH_NUM_FRAMES);
+
+    for (bMode = PH_OFF; bMode <= PH_ON; bMode++)
+    {
+        /* Fast mode is only available for ICODE tags */
+        if ((bMode == PH_ON) && (bFamily == PHAL_SLI_FAMILY_UNKNOWN))
+        {
+            break;
+        }
+
+        status = phalSli_SetFastMode(&salSli, bMode);
+        CHECK_SUCCESS(status);
+
+        dwNumBytes = 0;
+        clock_gettime(CLOCK_MONOTONIC, &sStart);
+
+        for (wFrame = 0; wFrame < BENCH_NUM_FRAMES; wFrame++)
+        {
+            status = phalSli_ReadBlocks(&salSli, 0, BENCH_NUM_BLOCKS, aData, &wDataLength);
+            if (status != PH_ERR_SUCCESS)
+            {
+                break;
+            }
+            dwNumBytes += wDataLength;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &sEnd);
+        dwTimeUs = (uint32_t)((sEnd.tv_sec - sStart.tv_sec) * 1000000 + (sEnd.tv_nsec - sStart.tv_nsec) / 1000);
+
+        status = phalSli_GetFastMode(&salSli, &bFastMode);
+        CHECK_SUCCESS(status);
+
+        DEBUG_PRINTF("\n%s mode: %u bytes in %u us", (bMode == PH_ON) ? "Fast" : "Standard",
+            (unsigned int)dwNumBytes, (unsigned int)dwTimeUs);
+        if (dwTimeUs != 0)
+        {
+            DEBUG_PRINTF(", Throughput: %u bytes/s", (unsigned int)(((uint64_t)dwNumBytes * 1000000) / dwTimeUs));
+        }
+        if (bMode != bFastMode)
+        {
+            DEBUG_PRINTF(" (fell back to standard commands)");
+        }
+        if (wFrame != BENCH_NUM_FRAMES)
+        {
+            DEBUG_PRINTF("\nRead failed after %d frames", wFrame);
+            return status;
+        }
+    }
+
+    return PH_ERR_SUCCESS;
+}
+
 /***********************************************************************************************
  * \brief   This function demonstrates the Type V (ISO 15693) card detection, Block Read and Write operation.
  * \param   *pParams
@@ -501,6 +601,18 @@ void NfcrdlibEx5_ISO15693(void *pParams)
                         DEBUG_PRINTF ("\nWrite Success");
                         DEBUG_PRINTF("\n\n --- End of Write Operation ---");
 
+                        /* Standard versus fast mode read throughput */
+                        DEBUG_PRINTF("\n");
+                        status = ThroughputBenchmark();
+                        if(status != PH_ERR_SUCCESS)
+                        {
+                            /* Print Error info */
+                            DEBUG_PRINTF ("\nThroughput benchmark Failed!!!");
+                            DEBUG_PRINTF("\nExecution aborted!!!\n");
+                            break;
+                        }
+                        DEBUG_PRINTF("\n\n --- End of Throughput Benchmark ---");
+
                         DEBUG_PRINTF("\n\n --- End of Example ---\n\n");
                     }while(0);
                 }
@@ -16,6 +16,7 @@
  * Example Source for NfcrdlibEx9_NTagI2c that uses the NTag I2C implementation.
  * This example will load/configure Discovery loop for NTag I2C, uses POLL mode to detect the NTag I2C card.
  * Displays detected NTag I2C card information like UID, ATQA, SAK, Product, Version Info, Page Read and Write status.
+ * If an NTag I2C plus is in pass-through mode, data is streamed through its SRAM and the throughput is displayed.
  * Example will activate the device at index zero whenever multiple NTag I2C cards are detected.
 
  * Please refer Readme.txt file for Hardware Pin Configuration, Software Configuration and steps to build and
@@ -59,13 +60,22 @@
 
 #include <phacDiscLoop.h>
 
+#include <stdint.h>
+#include <time.h>
+
 #define DATA_BUFFER_LEN         16         /* Buffer length */
 
 /* Tag Version info macros */
 #define NTAG_I2C_1K_VERSION     0x13       /* Tag Version: 1k */
 #define NTAG_I2C_2K_VERSION     0x15       /* Tag Version: 2k */
 
+#define NTAG_I2C_PLUS_MINOR_VERSION 0x02   /* Tag Version: minor product version of NTag I2C plus, the product subtype (0x05) is the same for NTag I2C */
+
 #define PTHRU_ON_OFF            (1 << 6)   /* NC_REG Pass-through bit */
+#define TRANSFER_DIR            (1 << 0)   /* NC_REG Transfer direction bit, set for RF to I2C */
+
+#define PTHRU_STREAM_LEN        1024       /* Number of bytes streamed in pass-through mode */
+#define PTHRU_MAX_POLLS         200        /* Session register polls per SRAM frame before giving up */
 
 /*******************************************************************************
 **   Global Variable Declaration
@@ -100,6 +110,8 @@ const uint8_t GI[] = { 0x46,0x66,0x6D,
 
 static uint8_t    aData[50];              /* ATR response holder */
 
+static uint8_t    aStreamBuffer[PTHRU_STREAM_LEN];  /* Pass-through stream data */
+
 /***********************************************************************************************
  * \brief   Print a given array of integers on the console
  * \param   *pBuff   Buffer Reference
@@ -119,6 +131,52 @@ static void PRINT_BUFF(uint8_t *pBuff, uint8_t size)
 #define  PRINT_BUFF(x, y)
 #endif /* DEBUG */
 
+/***********************************************************************************************
+ * \brief   Streams PTHRU_STREAM_LEN bytes through the SRAM of an NTag I2C plus in pass-through mode
+ *          in the direction configured by the I2C host and displays the sustained throughput.
+ * \param   bNcReg   NC_REG session register value
+ * \return  status  Returns the function status
+ **********************************************************************************************/
+static phStatus_t PassThroughStream(uint8_t bNcReg)
+{
+    phStatus_t                  status;
+    phalMful_PassThroughStats_t sStats;
+    struct timespec             sStart;
+    struct timespec             sEnd;
+    uint32_t                    dwTimeUs;
+    uint16_t                    wIndex;
+
+    clock_gettime(CLOCK_MONOTONIC, &sStart);
+
+    if (bNcReg & TRANSFER_DIR)
+    {
+        DEBUG_PRINTF("\nStreaming %d bytes from RF to I2C", PTHRU_STREAM_LEN);
+        for (wIndex = 0; wIndex < PTHRU_STREAM_LEN; wIndex++)
+        {
+            aStreamBuffer[wIndex] = (uint8_t)wIndex;
+        }
+        status = phalMful_PassThroughWrite(&salMful, aStreamBuffer, PTHRU_STREAM_LEN, PTHRU_MAX_POLLS, &sStats);
+    }
+    else
+    {
+        DEBUG_PRINTF("\nStreaming %d bytes from I2C to RF", PTHRU_STREAM_LEN);
+        status = phalMful_PassThroughRead(&salMful, aStreamBuffer, PTHRU_STREAM_LEN, PTHRU_MAX_POLLS, &sStats);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &sEnd);
+    dwTimeUs = (uint32_t)((sEnd.tv_sec - sStart.tv_sec) * 1000000 + (sEnd.tv_nsec - sStart.tv_nsec) / 1000);
+
+    DEBUG_PRINTF("\nTransferred %u bytes in %u frames, %u session register polls",
+        (unsigned int)sStats.dwNumBytes, (unsigned int)sStats.wNumFrames, (unsigned int)sStats.dwNumPolls);
+    if (dwTimeUs != 0)
+    {
+        DEBUG_PRINTF("\nTime: %u us, Throughput: %u bytes/s",
+            (unsigned int)dwTimeUs, (unsigned int)(((uint64_t)sStats.dwNumBytes * 1000000) / dwTimeUs));
+    }
+
+    return status;
+}
+
 /***********************************************************************************************
  * \brief   This function will enable the required polling and configuration for discovery loop.
  * \param   none
@@ -336,6 +394,7 @@ void NfcrdlibEx9_NTagI2C(void *pParams)
     uint16_t    numOfBytes;
     uint8_t     bSectorNum;
     uint8_t     bMoreCardsAvailable;
+    uint8_t     bIsPlus;
 
     /* Initialize library */
     status = NfcRdLibInit();
@@ -415,9 +474,15 @@ void NfcrdlibEx9_NTagI2C(void *pParams)
                             }
 
                             /* Check for Tag Info */
+                            bIsPlus = 0;
                             if((bDataBuffer[0] == 0x00) && (bDataBuffer[1] == 0x04) && (bDataBuffer[2] == 0x04))
                             {
                                 DEBUG_PRINTF ("\nProduct: NTag I2C ");
+                                bIsPlus = (bDataBuffer[5] == NTAG_I2C_PLUS_MINOR_VERSION);
+                                if (bIsPlus)
+                                {
+                                    DEBUG_PRINTF ("plus ");
+                                }
                                 if(bDataBuffer[6] == NTAG_I2C_1K_VERSION)
                                 {
                                     DEBUG_PRINTF ("1k Version ");
@@ -461,6 +526,20 @@ void NfcrdlibEx9_NTagI2C(void *pParams)
                             if ((bDataBuffer[0] & PTHRU_ON_OFF))
                             {
                                 DEBUG_PRINTF ("\nTag is Configured in Pass-through Mode");
+
+                                /* NTag I2C plus supports FAST_WRITE, stream through the SRAM */
+                                if (bIsPlus)
+                                {
+                                    status = PassThroughStream(bDataBuffer[0]);
+                                    if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+                                    {
+                                        DEBUG_PRINTF ("\nPass-through Stream Failed");
+                                    }
+                                    DEBUG_PRINTF("\n\n --- End of Example --- \n\n");
+                                    DEBUG_PRINTF("\nPlease Remove the Card\n\n");
+                                    break;
+                                }
+
                                 DEBUG_PRINTF ("\nCan not perform Sector/Page Read Write Operation");
                                 DEBUG_PRINTF("\n\nExecution aborted!!!\n");
                                 break;
@@ -24,6 +24,7 @@
 #ifdef NXPBUILD__PH_OSAL_POSIX
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <pthread.h>
 #include <semaphore.h>
 #include <signal.h>
@@ -31,6 +32,7 @@
 #include <unistd.h>
 
 #include "phOsal_Posix_Int.h"
+#include "phOsal_Posix_Thread.h"
 
 /* -------------------------------------------------------------------------------------
  * RTOS SEMAPHORES RELATED API's
@@ -67,6 +69,33 @@ typedef struct nxp_thread nxp_thread_t;
 
 static nxp_thread_t threadLut[E_PH_OSAL_EVT_DEST_NONE];
 
+/* Event context bound to the calling thread, used instead of its threadLut entry */
+static __thread nxp_thread_t* pBoundEventCtx = NULL;
+
+static phStatus_t phOsal_Posix_Event_Signal(nxp_thread_t* pt, phOsal_EventType_t eEvtType)
+{
+    int ret = 0;
+
+    //Lock mutex
+    ret = pthread_mutex_lock(&(pt->mutex));
+    if( ret != 0 )
+    {
+        return PH_ADD_COMPCODE(PH_ERR_OSAL_ERROR, PH_COMP_OSAL);
+    }
+
+    //Set event types
+    pt->eventMask |= eEvtType;
+
+    ret = pthread_mutex_unlock(&pt->mutex);
+    if( ret != 0 )
+    {
+        return PH_ADD_COMPCODE(PH_ERR_OSAL_ERROR, PH_COMP_OSAL);
+    }
+
+    phOsal_Semaphore_Give(pt->sem);
+    return PH_ERR_SUCCESS;
+}
+
 phStatus_t phOsal_Event_Init(void)
 {
     /* phOsal_Event_Init is most properly called by the main thread - the LIB thread */
@@ -85,33 +114,13 @@ phStatus_t phOsal_Event_Post(
                        phOsal_EventDestination_t eDest
                        )
 {
-	int ret = 0;
-
     /* map DEST_LIB to DEST_HAL, as both are sharing the same thread */
     if (eDest == E_PH_OSAL_EVT_DEST_LIB)
     {
         eDest = E_PH_OSAL_EVT_DEST_HAL;
     }
-    nxp_thread_t* pt = &threadLut[eDest];
-	//Lock mutex
-    ret = pthread_mutex_lock(&(pt->mutex));
-    if( ret != 0 )
-    {
-        return PH_ADD_COMPCODE(PH_ERR_OSAL_ERROR, PH_COMP_OSAL);
-    }
-
-    //Set event types
-    pt->eventMask |= eEvtType;
-
-
-    ret = pthread_mutex_unlock(&pt->mutex);
-    if( ret != 0 )
-    {
-        return PH_ADD_COMPCODE(PH_ERR_OSAL_ERROR, PH_COMP_OSAL);
-    }
 
-    phOsal_Semaphore_Give(pt->sem);
-    return PH_ERR_SUCCESS;
+    return phOsal_Posix_Event_Signal(&threadLut[eDest], eEvtType);
 }
 
 static nxp_thread_t* GetCurrentThread()
@@ -119,6 +128,11 @@ static nxp_thread_t* GetCurrentThread()
     int i;
     pthread_t currentThread = pthread_self();
 
+    if (pBoundEventCtx != NULL)
+    {
+        return pBoundEventCtx;
+    }
+
     for (i = 0; i < E_PH_OSAL_EVT_DEST_NONE; i++)
     {
         if (threadLut[i].thread == currentThread)
@@ -157,6 +171,11 @@ phStatus_t phOsal_Event_Consume(
 
     nxp_thread_t *currentThread = GetCurrentThread();
 
+    if (NULL == currentThread)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_OSAL_ERROR, PH_COMP_OSAL);
+    }
+
 	//Lock mutex
     ret = pthread_mutex_lock(&(currentThread->mutex));
     if( ret != 0 )
@@ -780,6 +799,69 @@ void phOsal_Posix_Thread_Join_Extra(pthread_t *thread, void** returnCode)
 {
     pthread_join(*thread, returnCode);
 }
+
+phStatus_t phOsal_Posix_EventCtx_Create(phOsal_Posix_EventCtxHandle_t* pEventCtx)
+{
+    nxp_thread_t* pt;
+
+    if (pEventCtx == NULL)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_OSAL);
+    }
+
+    pt = calloc(1, sizeof(nxp_thread_t));
+    if (pt == NULL)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_RESOURCE_ERROR, PH_COMP_OSAL);
+    }
+
+    pt->sem = phOsal_Semaphore_Create(255, 0);
+    if (NULL == pt->sem)
+    {
+        free(pt);
+        return PH_ADD_COMPCODE(PH_ERR_OSAL_ERROR, PH_COMP_OSAL);
+    }
+
+    if (pthread_mutex_init(&(pt->mutex), NULL) != 0)
+    {
+        phOsal_Semaphore_Delete(pt->sem);
+        free(pt);
+        return PH_ADD_COMPCODE(PH_ERR_OSAL_ERROR, PH_COMP_OSAL);
+    }
+
+    *pEventCtx = pt;
+    return PH_ERR_SUCCESS;
+}
+
+phStatus_t phOsal_Posix_EventCtx_Delete(phOsal_Posix_EventCtxHandle_t eventCtx)
+{
+    if (eventCtx == NULL)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_OSAL);
+    }
+
+    pthread_mutex_destroy(&(eventCtx->mutex));
+    phOsal_Semaphore_Delete(eventCtx->sem);
+    free(eventCtx);
+
+    return PH_ERR_SUCCESS;
+}
+
+void phOsal_Posix_EventCtx_Bind(phOsal_Posix_EventCtxHandle_t eventCtx)
+{
+    pBoundEventCtx = eventCtx;
+}
+
+phStatus_t phOsal_Posix_EventCtx_Post(phOsal_Posix_EventCtxHandle_t eventCtx, phOsal_EventType_t eEvtType)
+{
+    if (eventCtx == NULL)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_OSAL);
+    }
+
+    return phOsal_Posix_Event_Signal(eventCtx, eEvtType);
+}
+
 #endif  /* NXPBUILD__PH_OSAL_POSIX */
 
 
@@ -9,6 +9,9 @@
 
 #include <stdint.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 static void timer_callback(phOsal_TimerHandle_t xTimerHandle);
 static phPlatform_DataParams_t* _pParams;
@@ -183,6 +186,94 @@ phStatus_t phPlatform_Timer_Stop(phPlatform_DataParams_t  *pDataParams,
     return phOsal_Timer_Stop(pDataParams->gTimers[dwTimerId].osalHdle);
 }
 
+phStatus_t phPlatform_File_Map(phPlatform_DataParams_t  *pDataParams,
+                               const char               *pPath,
+                               uint32_t                  dwSize,
+                               uint8_t                 **ppData
+                               )
+{
+    int fd;
+    struct stat sStat;
+    void *pMap;
+
+    (void)pDataParams;
+
+    if ((pPath == NULL) || (ppData == NULL) || (dwSize == 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PLATFORM);
+    }
+
+    fd = open(pPath, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        return PH_ADD_COMPCODE(PH_PLATFORM_ERR_FILE, PH_COMP_PLATFORM);
+    }
+
+    //Extend the file, pages beyond end of file are not backed
+    if ((fstat(fd, &sStat) != 0)
+        || ((sStat.st_size < (off_t)dwSize) && (ftruncate(fd, (off_t)dwSize) != 0)))
+    {
+        close(fd);
+        return PH_ADD_COMPCODE(PH_PLATFORM_ERR_FILE, PH_COMP_PLATFORM);
+    }
+
+    pMap = mmap(NULL, dwSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    //Mapping stays valid after the descriptor is closed
+    close(fd);
+
+    if (pMap == MAP_FAILED)
+    {
+        return PH_ADD_COMPCODE(PH_PLATFORM_ERR_FILE, PH_COMP_PLATFORM);
+    }
+
+    *ppData = (uint8_t *)pMap;
+    return PH_ERR_SUCCESS;
+}
+
+phStatus_t phPlatform_File_Sync(phPlatform_DataParams_t  *pDataParams,
+                                uint8_t                  *pData,
+                                uint32_t                  dwOffset,
+                                uint32_t                  dwLength
+                                )
+{
+    uintptr_t dwPageSize;
+    uintptr_t dwStart;
+    uintptr_t dwEnd;
+
+    (void)pDataParams;
+
+    if ((pData == NULL) || (dwLength == 0))
+    {
+        return PH_ERR_SUCCESS;
+    }
+
+    //msync needs a page aligned start address
+    dwPageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+    dwStart = ((uintptr_t)pData + dwOffset) & ~(dwPageSize - 1);
+    dwEnd = (uintptr_t)pData + dwOffset + dwLength;
+
+    if (msync((void *)dwStart, (size_t)(dwEnd - dwStart), MS_ASYNC) != 0)
+    {
+        return PH_ADD_COMPCODE(PH_PLATFORM_ERR_FILE, PH_COMP_PLATFORM);
+    }
+    return PH_ERR_SUCCESS;
+}
+
+phStatus_t phPlatform_File_Unmap(phPlatform_DataParams_t  *pDataParams,
+                                 uint8_t                  *pData,
+                                 uint32_t                  dwSize
+                                 )
+{
+    (void)pDataParams;
+
+    if (munmap(pData, dwSize) != 0)
+    {
+        return PH_ADD_COMPCODE(PH_PLATFORM_ERR_FILE, PH_COMP_PLATFORM);
+    }
+    return PH_ERR_SUCCESS;
+}
+
 void timer_callback(phOsal_TimerHandle_t xTimerHandle)
 {
 	int i = 0;
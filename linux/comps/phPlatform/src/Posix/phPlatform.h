@@ -94,6 +94,7 @@ phStatus_t phPlatform_Init(phPlatform_DataParams_t  *pDataParams);    /**<[In] D
 
 #define PH_PLATFORM_ERR_NO_FREE_TIMER     (PH_ERR_CUSTOM_BEGIN + 0)   /**< Error condition indicating that no timer is available for allocation. */
 #define PH_PLATFORM_ERR_INVALID_TIMER     (PH_ERR_CUSTOM_BEGIN + 1)   /**< Indicates that the timer ID that was supplied was invalid. */
+#define PH_PLATFORM_ERR_FILE              (PH_ERR_CUSTOM_BEGIN + 2)   /**< Indicates that a file could not be opened, mapped or synchronized. */
 
 /*@}*/
 
@@ -210,6 +211,52 @@ phStatus_t phPlatform_Timer_ExecCallback(phPlatform_DataParams_t   *pDataParams,
                                          uint32_t                   dwTimerId                  /**< [In] Timer Id */
                                          );
 
+/**
+* \brief Map a file into memory (shared mapping).
+*
+* The file is created if it does not exist and extended to dwSize if it is
+* smaller. Writes to the mapping update the file; they are written back by
+* the operating system or on \ref phPlatform_File_Sync. The mapping can be used
+* directly as elementary file of the T4T card emulation.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_PLATFORM_ERR_FILE File could not be opened or mapped.
+*/
+phStatus_t phPlatform_File_Map(phPlatform_DataParams_t    *pDataParams,                        /**< [In] Pointer to this layers parameter structure. */
+                               const char                 *pPath,                              /**< [In] Path of the file. */
+                               uint32_t                    dwSize,                             /**< [In] Size of the mapping in bytes. */
+                               uint8_t                   **ppData                              /**< [Out] Start of the mapping. */
+                               );
+
+/**
+* \brief Schedule write-back of a range of a mapped file.
+*
+* The write-back is asynchronous; this function does not wait for the data to
+* reach the storage.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_PLATFORM_ERR_FILE Range could not be synchronized.
+*/
+phStatus_t phPlatform_File_Sync(phPlatform_DataParams_t   *pDataParams,                        /**< [In] Pointer to this layers parameter structure. */
+                                uint8_t                   *pData,                              /**< [In] Start of the mapping. */
+                                uint32_t                   dwOffset,                           /**< [In] Offset of the range. */
+                                uint32_t                   dwLength                            /**< [In] Length of the range. */
+                                );
+
+/**
+* \brief Unmap a file mapped with \ref phPlatform_File_Map.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_PLATFORM_ERR_FILE Mapping could not be removed.
+*/
+phStatus_t phPlatform_File_Unmap(phPlatform_DataParams_t  *pDataParams,                        /**< [In] Pointer to this layers parameter structure. */
+                                 uint8_t                  *pData,                              /**< [In] Start of the mapping. */
+                                 uint32_t                  dwSize                              /**< [In] Size of the mapping in bytes. */
+                                 );
+
 /** @} */
 #endif /* NXPBUILD__PH_PLATFORM */
 
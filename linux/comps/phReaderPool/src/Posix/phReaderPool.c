@@ -0,0 +1,274 @@
+/*
+*         Copyright (c), NXP Semiconductors
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Reader pool of the Linux platform: several readers polled by a pool of worker threads.
+*
+*/
+
+#include <ph_Status.h>
+#include <phhalHw.h>
+#include <phacDiscLoop.h>
+#include <phReaderPool.h>
+
+#include <errno.h>
+#include <time.h>
+
+static void * phReaderPool_Int_Worker(void * arg);
+
+phStatus_t phReaderPool_Init(
+    phReaderPool_DataParams_t * pDataParams,
+    pphReaderPool_DeviceHandler_t pDeviceHandler,
+    void * pContext
+    )
+{
+    if (pDataParams == NULL)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PLATFORM);
+    }
+
+    pDataParams->bNumReaders = 0;
+    pDataParams->bReadyHead = 0;
+    pDataParams->bReadyCount = 0;
+    pDataParams->bEventHead = 0;
+    pDataParams->bEventCount = 0;
+    pDataParams->dwEventsDropped = 0;
+    pDataParams->bNumWorkers = 0;
+    pDataParams->bRunning = PH_OFF;
+    pDataParams->pDeviceHandler = pDeviceHandler;
+    pDataParams->pContext = pContext;
+
+    if ((pthread_mutex_init(&pDataParams->mutex, NULL) != 0) ||
+        (pthread_cond_init(&pDataParams->readyCond, NULL) != 0) ||
+        (pthread_cond_init(&pDataParams->eventCond, NULL) != 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_RESOURCE_ERROR, PH_COMP_PLATFORM);
+    }
+
+    return PH_ERR_SUCCESS;
+}
+
+phStatus_t phReaderPool_AddReader(
+    phReaderPool_DataParams_t * pDataParams,
+    phacDiscLoop_Sw_DataParams_t * pDiscLoop,
+    phOsal_Posix_EventCtxHandle_t pEventCtx,
+    uint8_t * pReaderId
+    )
+{
+    phReaderPool_Reader_t * pReader;
+
+    if ((pDiscLoop == NULL) || (pEventCtx == NULL) ||
+        (pDataParams->bNumReaders >= PH_READER_POOL_MAX_READERS))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PLATFORM);
+    }
+
+    if (pDataParams->bRunning == PH_ON)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_PLATFORM);
+    }
+
+    pReader = &pDataParams->aReaders[pDataParams->bNumReaders];
+    pReader->pDiscLoop = pDiscLoop;
+    pReader->pEventCtx = pEventCtx;
+    pReader->dwCycle = 0;
+
+    *pReaderId = pDataParams->bNumReaders++;
+
+    return PH_ERR_SUCCESS;
+}
+
+phStatus_t phReaderPool_Start(
+    phReaderPool_DataParams_t * pDataParams,
+    uint8_t bNumWorkers
+    )
+{
+    uint8_t bIndex;
+
+    if ((bNumWorkers == 0) || (bNumWorkers > PH_READER_POOL_MAX_WORKERS))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PLATFORM);
+    }
+
+    if ((pDataParams->bRunning == PH_ON) || (pDataParams->bNumReaders == 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_PLATFORM);
+    }
+
+    /* All readers are ready for their first cycle */
+    for (bIndex = 0; bIndex < pDataParams->bNumReaders; bIndex++)
+    {
+        pDataParams->aReadyQueue[bIndex] = bIndex;
+    }
+    pDataParams->bReadyHead = 0;
+    pDataParams->bReadyCount = pDataParams->bNumReaders;
+    pDataParams->bRunning = PH_ON;
+
+    for (bIndex = 0; bIndex < bNumWorkers; bIndex++)
+    {
+        if (pthread_create(&pDataParams->aWorkers[bIndex], NULL, phReaderPool_Int_Worker, pDataParams) != 0)
+        {
+            (void)phReaderPool_Stop(pDataParams);
+            return PH_ADD_COMPCODE(PH_ERR_RESOURCE_ERROR, PH_COMP_PLATFORM);
+        }
+        pDataParams->bNumWorkers++;
+    }
+
+    return PH_ERR_SUCCESS;
+}
+
+phStatus_t phReaderPool_GetEvent(
+    phReaderPool_DataParams_t * pDataParams,
+    phReaderPool_Event_t * pEvent,
+    uint32_t dwTimeoutMs
+    )
+{
+    struct timespec sDeadline;
+    int ret = 0;
+
+    clock_gettime(CLOCK_REALTIME, &sDeadline);
+    sDeadline.tv_sec += dwTimeoutMs / 1000U;
+    sDeadline.tv_nsec += (long)(dwTimeoutMs % 1000U) * 1000000L;
+    if (sDeadline.tv_nsec >= 1000000000L)
+    {
+        sDeadline.tv_sec++;
+        sDeadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&pDataParams->mutex);
+    while ((pDataParams->bEventCount == 0) && (ret != ETIMEDOUT))
+    {
+        ret = pthread_cond_timedwait(&pDataParams->eventCond, &pDataParams->mutex, &sDeadline);
+    }
+
+    if (pDataParams->bEventCount == 0)
+    {
+        pthread_mutex_unlock(&pDataParams->mutex);
+        return PH_ADD_COMPCODE(PH_ERR_IO_TIMEOUT, PH_COMP_PLATFORM);
+    }
+
+    *pEvent = pDataParams->aEvents[pDataParams->bEventHead];
+    pDataParams->bEventHead = (uint8_t)((pDataParams->bEventHead + 1U) % PH_READER_POOL_EVENT_QUEUE_SIZE);
+    pDataParams->bEventCount--;
+    pthread_mutex_unlock(&pDataParams->mutex);
+
+    return PH_ERR_SUCCESS;
+}
+
+phStatus_t phReaderPool_Stop(
+    phReaderPool_DataParams_t * pDataParams
+    )
+{
+    uint8_t bIndex;
+
+    pthread_mutex_lock(&pDataParams->mutex);
+    pDataParams->bRunning = PH_OFF;
+    pthread_cond_broadcast(&pDataParams->readyCond);
+    pthread_mutex_unlock(&pDataParams->mutex);
+
+    /* Release the workers blocked in an RF wait */
+    for (bIndex = 0; bIndex < pDataParams->bNumReaders; bIndex++)
+    {
+        (void)phOsal_Posix_EventCtx_Post(pDataParams->aReaders[bIndex].pEventCtx, E_PH_OSAL_EVT_ABORT);
+    }
+
+    for (bIndex = 0; bIndex < pDataParams->bNumWorkers; bIndex++)
+    {
+        pthread_join(pDataParams->aWorkers[bIndex], NULL);
+    }
+    pDataParams->bNumWorkers = 0;
+
+    return PH_ERR_SUCCESS;
+}
+
+static void phReaderPool_Int_PushEvent(
+    phReaderPool_DataParams_t * pDataParams,
+    phReaderPool_Event_t * pEvent
+    )
+{
+    uint8_t bTail;
+
+    /* Keep the newest events when the application does not keep up */
+    if (pDataParams->bEventCount == PH_READER_POOL_EVENT_QUEUE_SIZE)
+    {
+        pDataParams->bEventHead = (uint8_t)((pDataParams->bEventHead + 1U) % PH_READER_POOL_EVENT_QUEUE_SIZE);
+        pDataParams->bEventCount--;
+        pDataParams->dwEventsDropped++;
+    }
+
+    bTail = (uint8_t)((pDataParams->bEventHead + pDataParams->bEventCount) % PH_READER_POOL_EVENT_QUEUE_SIZE);
+    pDataParams->aEvents[bTail] = *pEvent;
+    pDataParams->bEventCount++;
+    pthread_cond_signal(&pDataParams->eventCond);
+}
+
+static void * phReaderPool_Int_Worker(void * arg)
+{
+    phReaderPool_DataParams_t * pDataParams = (phReaderPool_DataParams_t *)arg;
+    phReaderPool_Reader_t * pReader;
+    phReaderPool_Event_t sEvent;
+    uint8_t bReaderId;
+
+    while (true)
+    {
+        pthread_mutex_lock(&pDataParams->mutex);
+        while ((pDataParams->bRunning == PH_ON) && (pDataParams->bReadyCount == 0))
+        {
+            pthread_cond_wait(&pDataParams->readyCond, &pDataParams->mutex);
+        }
+        if (pDataParams->bRunning != PH_ON)
+        {
+            pthread_mutex_unlock(&pDataParams->mutex);
+            break;
+        }
+        bReaderId = pDataParams->aReadyQueue[pDataParams->bReadyHead];
+        pDataParams->bReadyHead = (uint8_t)((pDataParams->bReadyHead + 1U) % PH_READER_POOL_MAX_READERS);
+        pDataParams->bReadyCount--;
+        pthread_mutex_unlock(&pDataParams->mutex);
+
+        pReader = &pDataParams->aReaders[bReaderId];
+        sEvent.bReaderId = bReaderId;
+        sEvent.wHandlerStatus = PH_ERR_SUCCESS;
+        sEvent.wTechDetected = 0;
+        sEvent.dwCycle = pReader->dwCycle++;
+
+        /* The HAL of this reader waits for its RF events on the reader's context */
+        phOsal_Posix_EventCtx_Bind(pReader->pEventCtx);
+
+        (void)phacDiscLoop_SetConfig(pReader->pDiscLoop, PHAC_DISCLOOP_CONFIG_NEXT_POLL_STATE, PHAC_DISCLOOP_POLL_STATE_DETECTION);
+        sEvent.wStatus = phacDiscLoop_Run(pReader->pDiscLoop, PHAC_DISCLOOP_ENTRY_POINT_POLL);
+        (void)phacDiscLoop_GetConfig(pReader->pDiscLoop, PHAC_DISCLOOP_CONFIG_TECH_DETECTED, &sEvent.wTechDetected);
+
+        if ((pDataParams->pDeviceHandler != NULL) &&
+            ((sEvent.wStatus & PH_ERR_MASK) != PHAC_DISCLOOP_NO_TECH_DETECTED) &&
+            ((sEvent.wStatus & PH_ERR_MASK) != PHAC_DISCLOOP_LPCD_NO_TECH_DETECTED) &&
+            ((sEvent.wStatus & PH_COMP_MASK) == PH_COMP_AC_DISCLOOP))
+        {
+            sEvent.wHandlerStatus = pDataParams->pDeviceHandler(bReaderId, pReader->pDiscLoop,
+                sEvent.wStatus, pDataParams->pContext);
+        }
+
+        (void)phhalHw_FieldOff(pReader->pDiscLoop->pHalDataParams);
+        phOsal_Posix_EventCtx_Bind(NULL);
+
+        pthread_mutex_lock(&pDataParams->mutex);
+        phReaderPool_Int_PushEvent(pDataParams, &sEvent);
+        pDataParams->aReadyQueue[(pDataParams->bReadyHead + pDataParams->bReadyCount) % PH_READER_POOL_MAX_READERS] = bReaderId;
+        pDataParams->bReadyCount++;
+        pthread_cond_signal(&pDataParams->readyCond);
+        pthread_mutex_unlock(&pDataParams->mutex);
+    }
+
+    return NULL;
+}
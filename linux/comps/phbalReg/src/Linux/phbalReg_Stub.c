@@ -34,25 +34,10 @@
 #define CFG_SPI_BITS_PER_WORD 8
 #define CFG_SPI_FREQ 5000000
 
-struct data
-{
-	//Pin/bus numbers
-	size_t spiBus;
-	size_t spiCsPinNum;
-	size_t busyPinNum;
-
-	//File descriptors
-	int spiFd;
-	int i2cFd;
-	int busyPinFd;
-};
-
-static struct data _data;
-
 //Definitions of internal functions
 
-static int spi_transfer(const uint8_t* out, uint8_t* in, size_t length);
-static int wait_not_busy();
+static int spi_transfer(phbalReg_Stub_DataParams_t * pDataParams, const uint8_t* out, uint8_t* in, size_t length);
+static int wait_not_busy(phbalReg_Stub_DataParams_t * pDataParams);
 
 //Pin definitions
 phStatus_t phbalReg_Stub_Init(
@@ -69,12 +54,15 @@ phStatus_t phbalReg_Stub_Init(
 
     pDataParams->wId = PH_COMP_BAL | PHBAL_REG_STUB_ID;
     pDataParams->bMultiRegRW = PH_OFF;
-    _data.spiFd = -1;
+    pDataParams->dwSpiFd = -1;
+    pDataParams->dwBusyPinFd = -1;
+    pDataParams->dwTxBytes = 0;
+    pDataParams->dwRxBytes = 0;
 
     //Set default bus/pin numbers
-    _data.spiBus = CFG_DEFAULT_SPI_BUS;
-    _data.spiCsPinNum = CFG_DEFAULT_SPI_CS_PIN;
-    _data.busyPinNum = CFG_DEFAULT_BUSY_PIN;
+    pDataParams->wSpiBus = CFG_DEFAULT_SPI_BUS;
+    pDataParams->wSpiCsPin = CFG_DEFAULT_SPI_CS_PIN;
+    pDataParams->wBusyPin = CFG_DEFAULT_BUSY_PIN;
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_BAL);
 }
@@ -104,9 +92,9 @@ phStatus_t phbalReg_Stub_SetPort(
         return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_BAL);
 	}
 
-	_data.spiBus = x;
-	_data.spiCsPinNum = y;
-	_data.busyPinNum = z;
+	pDataParams->wSpiBus = (uint16_t)x;
+	pDataParams->wSpiCsPin = (uint16_t)y;
+	pDataParams->wBusyPin = (uint16_t)z;
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_BAL);
 }
@@ -117,16 +105,16 @@ phStatus_t phbalReg_Stub_OpenPort(
 {
 	int ret = 0;
 	int fd = 0;
-	char spi[16];
+	char spi[32];
 
 	uint32_t mode = CFG_SPI_MODE;
 	uint8_t bits = CFG_SPI_BITS_PER_WORD;
 	uint32_t speed = CFG_SPI_FREQ;
 
-	snprintf(spi, sizeof(spi), CFG_SPI_DIR "%lu.%lu", _data.spiBus, _data.spiCsPinNum);
+	snprintf(spi, sizeof(spi), CFG_SPI_DIR "%u.%u", pDataParams->wSpiBus, pDataParams->wSpiCsPin);
 
-	_data.spiFd = open(spi, O_RDWR);
-	if(_data.spiFd < 0)
+	pDataParams->dwSpiFd = open(spi, O_RDWR);
+	if(pDataParams->dwSpiFd < 0)
 	{
 		return PH_ADD_COMPCODE(PH_ERR_INTERNAL_ERROR, PH_COMP_BAL);
 	}
@@ -134,20 +122,20 @@ phStatus_t phbalReg_Stub_OpenPort(
 	//If successful, configure SPI bus using ioctls
 
 	//Set mode
-	ret = ioctl(_data.spiFd, SPI_IOC_WR_MODE, &mode);
+	ret = ioctl(pDataParams->dwSpiFd, SPI_IOC_WR_MODE, &mode);
 	if( ret < 0 )
 	{
 		goto cleanup;
 	}
 
 	//Set
-	ret = ioctl(_data.spiFd, SPI_IOC_WR_BITS_PER_WORD, &bits);
+	ret = ioctl(pDataParams->dwSpiFd, SPI_IOC_WR_BITS_PER_WORD, &bits);
 	if( ret < 0 )
 	{
 		goto cleanup;
 	}
 
-	ret = ioctl(_data.spiFd, SPI_IOC_WR_MAX_SPEED_HZ, &speed);
+	ret = ioctl(pDataParams->dwSpiFd, SPI_IOC_WR_MAX_SPEED_HZ, &speed);
 	if( ret < 0 )
 	{
 		goto cleanup;
@@ -156,28 +144,28 @@ phStatus_t phbalReg_Stub_OpenPort(
 	if( pDataParams->wHalType == PHBAL_REG_HAL_HW_PN5180 )
 	{
 		//Export GPIO function
-		ret = gpio_export(_data.busyPinNum);
+		ret = gpio_export(pDataParams->wBusyPin);
 		if( ret < 0 )
 		{
 			goto cleanup;
 		}
 
 		//Configure as input
-		ret = gpio_set_direction(_data.busyPinNum, false);
+		ret = gpio_set_direction(pDataParams->wBusyPin, false);
 		if( ret < 0 )
 		{
 			goto cleanup;
 		}
 
 		//Watch falling edge
-		ret = gpio_set_edge(_data.busyPinNum, false, true);
+		ret = gpio_set_edge(pDataParams->wBusyPin, false, true);
 		if( ret < 0 )
 		{
 			goto cleanup;
 		}
 
-		_data.busyPinFd = gpio_open(_data.busyPinNum, O_RDONLY);
-		if( _data.busyPinFd < 0 )
+		pDataParams->dwBusyPinFd = gpio_open(pDataParams->wBusyPin, O_RDONLY);
+		if( pDataParams->dwBusyPinFd < 0 )
 		{
 			goto cleanup;
 		}
@@ -196,21 +184,21 @@ phStatus_t phbalReg_Stub_ClosePort(
                                    phbalReg_Stub_DataParams_t * pDataParams
                                    )
 {
-	if(_data.spiFd >= 0)
+	if(pDataParams->dwSpiFd >= 0)
 	{
-		close(_data.spiFd);
+		close(pDataParams->dwSpiFd);
 	}
-	_data.spiFd = -1;
+	pDataParams->dwSpiFd = -1;
 
 	if( pDataParams->wHalType == PHBAL_REG_HAL_HW_PN5180 )
 	{
-		if(_data.busyPinFd >= 0)
+		if(pDataParams->dwBusyPinFd >= 0)
 		{
-			close(_data.busyPinFd);
+			close(pDataParams->dwBusyPinFd);
 		}
-		_data.busyPinFd = -1;
+		pDataParams->dwBusyPinFd = -1;
 
-		gpio_unexport(_data.busyPinNum);
+		gpio_unexport(pDataParams->wBusyPin);
 	}
 
     return PH_ERR_SUCCESS;
@@ -243,7 +231,7 @@ phStatus_t phbalReg_Stub_Exchange(
 	    {
 	    	//Perform a "MultiRegRead" exchange
 	    	//This is a read operation
-			ret = spi_transfer(pTxBuffer, pRxBuffer, wTxLength);
+			ret = spi_transfer(pDataParams, pTxBuffer, pRxBuffer, wTxLength);
 			if(ret)
 			{
                             printf("spi_transfer fail\n");
@@ -268,7 +256,7 @@ phStatus_t phbalReg_Stub_Exchange(
 
 			while( pos < wTxLength )
 			{
-				ret = spi_transfer(pTxBuffer, NULL, 2);
+				ret = spi_transfer(pDataParams, pTxBuffer, NULL, 2);
 				if(ret)
 				{
 				    printf("spi_transfer fail 2\n");	
@@ -292,14 +280,14 @@ phStatus_t phbalReg_Stub_Exchange(
 	if( pDataParams->wHalType == PHBAL_REG_HAL_HW_PN5180 )
 	{
 		//If PN5180, wait for busy line to be released
-		ret = wait_not_busy();
+		ret = wait_not_busy(pDataParams);
 		if(ret)
 		{
 			return PH_ADD_COMPCODE(PH_ERR_INTERNAL_ERROR, PH_COMP_BAL);
 		}
 
 		//Transmit first
-		ret = spi_transfer(pTxBuffer, NULL, wTxLength);
+		ret = spi_transfer(pDataParams, pTxBuffer, NULL, wTxLength);
 		if(ret)
 		{
                     printf("spi_transfer fail 3\n");		
@@ -310,13 +298,13 @@ phStatus_t phbalReg_Stub_Exchange(
 		if( pRxBuffer != NULL )
 		{
 			//Wait again
-			ret = wait_not_busy();
+			ret = wait_not_busy(pDataParams);
 			if(ret)
 			{
 				return PH_ADD_COMPCODE(PH_ERR_INTERNAL_ERROR, PH_COMP_BAL);
 			}
 
-			ret = spi_transfer(NULL, pRxBuffer, wRxBufSize);
+			ret = spi_transfer(pDataParams, NULL, pRxBuffer, wRxBufSize);
 			if(ret)
 			{
                             printf("spi_transfer fail 4\n");		
@@ -332,7 +320,7 @@ phStatus_t phbalReg_Stub_Exchange(
 	else
 	{
 		//Transfer everything at once
-		ret = spi_transfer(pTxBuffer, pRxBuffer, wTxLength);
+		ret = spi_transfer(pDataParams, pTxBuffer, pRxBuffer, wTxLength);
 		if(ret)
 		{
                     printf("spi_transfer fail 5\n");		
@@ -419,7 +407,7 @@ phStatus_t phbalReg_Stub_GetConfig(
 }
 
 //Internal functions
-int spi_transfer(const uint8_t* out, uint8_t* in, size_t length)
+int spi_transfer(phbalReg_Stub_DataParams_t * pDataParams, const uint8_t* out, uint8_t* in, size_t length)
 {
 	int ret = 0;
 	struct spi_ioc_transfer transfer = {0};
@@ -437,27 +425,37 @@ int spi_transfer(const uint8_t* out, uint8_t* in, size_t length)
 	transfer.delay_usecs = 0;
 
 	//Execute the transfer
-	ret = ioctl(_data.spiFd, SPI_IOC_MESSAGE(1), &transfer);
+	ret = ioctl(pDataParams->dwSpiFd, SPI_IOC_MESSAGE(1), &transfer);
 	if( ret < 0 )
 	{
 		return -1;
 	}
 
+	//Update bus statistics
+	if( out != NULL )
+	{
+		pDataParams->dwTxBytes += length;
+	}
+	if( in != NULL )
+	{
+		pDataParams->dwRxBytes += length;
+	}
+
 	return 0;
 }
 
-int wait_not_busy()
+int wait_not_busy(phbalReg_Stub_DataParams_t * pDataParams)
 {
 	int ret = 0;
 	struct pollfd pollfd;
 	char c = 0;
 
-	pollfd.fd = _data.busyPinFd;
+	pollfd.fd = pDataParams->dwBusyPinFd;
 	pollfd.events = POLLPRI;
 
 	//Read value -- seek otherwise subsequent reads fail (return '\n' for instance)
-	lseek(_data.busyPinFd, 0, SEEK_SET);
-	ret = read(_data.busyPinFd, &c, 1);
+	lseek(pDataParams->dwBusyPinFd, 0, SEEK_SET);
+	ret = read(pDataParams->dwBusyPinFd, &c, 1);
 	if( ret != 1 )
 	{
 		return -1;
@@ -475,8 +473,8 @@ int wait_not_busy()
 	}
 
 	//Re-Read value
-	lseek(_data.busyPinFd, 0, SEEK_SET);
-	ret = read(_data.busyPinFd, &c, 1);
+	lseek(pDataParams->dwBusyPinFd, 0, SEEK_SET);
+	ret = read(pDataParams->dwBusyPinFd, &c, 1);
 	if( ret != 1 )
 	{
 		return -1;
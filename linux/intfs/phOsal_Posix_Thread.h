@@ -3,6 +3,7 @@
 
 #include <ph_Status.h>
 #include <phOsal.h>
+#include <pthread.h>
 
 
 extern phStatus_t phOsal_Posix_Thread_Create(phOsal_EventDestination_t threadName, void *(*start_routine) (void *), void *arg);
@@ -14,5 +15,28 @@ extern phStatus_t phOsal_Posix_Thread_Create_Extra(pthread_t *thread, void *(*st
 
 extern void phOsal_Posix_Thread_Join_Extra(pthread_t *thread, void** returnCode);
 
+/**
+ * Event context of one reader. The HAL of a reader waits for its RF events on the
+ * context bound to the calling thread, so a reader can be driven from any thread
+ * and several readers can be driven in parallel.
+ */
+typedef struct nxp_thread * phOsal_Posix_EventCtxHandle_t;
+
+/** Creates an event context with no pending events. */
+extern phStatus_t phOsal_Posix_EventCtx_Create(phOsal_Posix_EventCtxHandle_t* pEventCtx);
+
+/** Deletes an event context; it must not be bound to any thread. */
+extern phStatus_t phOsal_Posix_EventCtx_Delete(phOsal_Posix_EventCtxHandle_t eventCtx);
+
+/**
+ * Binds an event context to the calling thread. Event waits and consumes of this
+ * thread then use the context instead of the E_PH_OSAL_EVT_DEST_* thread table.
+ * NULL unbinds.
+ */
+extern void phOsal_Posix_EventCtx_Bind(phOsal_Posix_EventCtxHandle_t eventCtx);
+
+/** Posts events (e.g. E_PH_OSAL_EVT_RF from the reader's IRQ, or E_PH_OSAL_EVT_ABORT) to an event context. */
+extern phStatus_t phOsal_Posix_EventCtx_Post(phOsal_Posix_EventCtxHandle_t eventCtx, phOsal_EventType_t eEvtType);
+
 
 #endif /* PHOSAL_POSIX_THREAD_H_ */
@@ -0,0 +1,179 @@
+/*
+*         Copyright (c), NXP Semiconductors
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Reader pool of the Linux platform: several readers polled by a pool of worker threads.
+*
+*/
+
+#ifndef PHREADERPOOL_H
+#define PHREADERPOOL_H
+
+#include <ph_Status.h>
+#include <phOsal.h>
+#include <phacDiscLoop.h>
+#include <pthread.h>
+#include <phOsal_Posix_Thread.h>
+
+#ifdef  __cplusplus
+extern "C" {
+#endif    /* __cplusplus */
+
+/** \defgroup phReaderPool Component : Posix
+* \brief Runs the discovery loop of N readers on M worker threads.
+*
+* Every reader has its own BAL/HAL/discovery loop stack and its own OSAL event context
+* (see #phOsal_Posix_EventCtx_Create and phhwConfig_Reader_t). A worker takes the next
+* ready reader, binds its event context, runs one poll cycle, switches the field off and
+* queues a #phReaderPool_Event_t for the application. While a worker waits for the RF
+* events of one reader the other workers keep polling the other readers.
+*
+* A reader blocked in an RF wait is aborted by posting #E_PH_OSAL_EVT_ABORT to its event
+* context with #phOsal_Posix_EventCtx_Post; #phReaderPool_Stop does so for all readers.
+* @{
+*/
+
+#define PH_READER_POOL_MAX_READERS      8U      /**< Maximum number of readers in a pool. */
+#define PH_READER_POOL_MAX_WORKERS      8U      /**< Maximum number of worker threads of a pool. */
+#define PH_READER_POOL_EVENT_QUEUE_SIZE 32U     /**< Number of events queued before the oldest is dropped. */
+
+/**
+* \brief Result of one poll cycle of one reader.
+*/
+typedef struct
+{
+    uint8_t     bReaderId;          /**< Reader as returned by #phReaderPool_AddReader. */
+    phStatus_t  wStatus;            /**< Status of phacDiscLoop_Run. */
+    phStatus_t  wHandlerStatus;     /**< Status of the device handler, #PH_ERR_SUCCESS if it was not called. */
+    uint16_t    wTechDetected;      /**< Value of #PHAC_DISCLOOP_CONFIG_TECH_DETECTED after the cycle. */
+    uint32_t    dwCycle;            /**< Number of the cycle for this reader, starting at 0. */
+} phReaderPool_Event_t;
+
+/**
+* \brief Called on the worker thread, with the reader's event context bound, after a
+* poll cycle that detected a technology. The field is still on, so the handler can
+* exchange with the activated device.
+*/
+typedef phStatus_t (*pphReaderPool_DeviceHandler_t)(
+    uint8_t bReaderId,                              /**< [In] Reader that detected a device. */
+    phacDiscLoop_Sw_DataParams_t * pDiscLoop,       /**< [In] Discovery loop of the reader. */
+    phStatus_t wDiscLoopStatus,                     /**< [In] Status of phacDiscLoop_Run. */
+    void * pContext                                 /**< [In] Context given to #phReaderPool_Init. */
+    );
+
+typedef struct
+{
+    phacDiscLoop_Sw_DataParams_t * pDiscLoop;
+    phOsal_Posix_EventCtxHandle_t pEventCtx;
+    uint32_t dwCycle;
+} phReaderPool_Reader_t;
+
+/**
+* \brief Reader pool parameter structure
+*/
+typedef struct
+{
+    phReaderPool_Reader_t aReaders[PH_READER_POOL_MAX_READERS];     /**< Registered readers. */
+    uint8_t bNumReaders;                                            /**< Number of registered readers. */
+    uint8_t aReadyQueue[PH_READER_POOL_MAX_READERS];                /**< Readers waiting for a worker. */
+    uint8_t bReadyHead;
+    uint8_t bReadyCount;
+    phReaderPool_Event_t aEvents[PH_READER_POOL_EVENT_QUEUE_SIZE];  /**< Events waiting for the application. */
+    uint8_t bEventHead;
+    uint8_t bEventCount;
+    uint32_t dwEventsDropped;                                       /**< Events dropped because the queue was full. */
+    pthread_t aWorkers[PH_READER_POOL_MAX_WORKERS];
+    uint8_t bNumWorkers;
+    uint8_t bRunning;
+    pthread_mutex_t mutex;
+    pthread_cond_t readyCond;
+    pthread_cond_t eventCond;
+    pphReaderPool_DeviceHandler_t pDeviceHandler;
+    void * pContext;
+} phReaderPool_DataParams_t;
+
+/**
+* \brief Initialize a reader pool with no readers.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_RESOURCE_ERROR Pool mutex or conditions could not be created.
+*/
+phStatus_t phReaderPool_Init(
+    phReaderPool_DataParams_t * pDataParams,            /**< [In] Pointer to this layer's parameter structure. */
+    pphReaderPool_DeviceHandler_t pDeviceHandler,       /**< [In] Device handler, may be NULL. */
+    void * pContext                                     /**< [In] Passed to the device handler. */
+    );
+
+/**
+* \brief Add a reader to a stopped pool. The discovery loop must be configured for
+* polling and its HAL must signal its RF events to pEventCtx.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Pool full or invalid reader.
+* \retval #PH_ERR_USE_CONDITION Pool is running.
+*/
+phStatus_t phReaderPool_AddReader(
+    phReaderPool_DataParams_t * pDataParams,            /**< [In] Pointer to this layer's parameter structure. */
+    phacDiscLoop_Sw_DataParams_t * pDiscLoop,           /**< [In] Discovery loop of the reader. */
+    phOsal_Posix_EventCtxHandle_t pEventCtx,            /**< [In] Event context of the reader. */
+    uint8_t * pReaderId                                 /**< [Out] Id of the reader in the events. */
+    );
+
+/**
+* \brief Start polling all readers on bNumWorkers worker threads.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid number of workers.
+* \retval #PH_ERR_USE_CONDITION Pool is running or has no reader.
+* \retval #PH_ERR_RESOURCE_ERROR A worker thread could not be created.
+*/
+phStatus_t phReaderPool_Start(
+    phReaderPool_DataParams_t * pDataParams,            /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t bNumWorkers                                 /**< [In] Number of worker threads, 1 to #PH_READER_POOL_MAX_WORKERS. */
+    );
+
+/**
+* \brief Take the oldest event of the pool, waiting up to dwTimeoutMs for one.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_IO_TIMEOUT No event within dwTimeoutMs.
+*/
+phStatus_t phReaderPool_GetEvent(
+    phReaderPool_DataParams_t * pDataParams,            /**< [In] Pointer to this layer's parameter structure. */
+    phReaderPool_Event_t * pEvent,                      /**< [Out] Oldest event. */
+    uint32_t dwTimeoutMs                                /**< [In] Time to wait for an event. */
+    );
+
+/**
+* \brief Stop the workers. Readers waiting for RF events are aborted. Queued events
+* can still be read with #phReaderPool_GetEvent.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phReaderPool_Stop(
+    phReaderPool_DataParams_t * pDataParams             /**< [In] Pointer to this layer's parameter structure. */
+    );
+
+/** @} */
+
+#ifdef __cplusplus
+} /* Extern C */
+#endif
+
+#endif /* PHREADERPOOL_H */
@@ -156,6 +156,12 @@
 /* CID Manager components */
 //#define NXPBUILD__PH_CIDMANAGER_SW              /**< Software CID Manager */
 
+/* Crypto components */
+#define NXPBUILD__PH_CRYPTOSYM_SW               /**< Software Symmetric Crypto */
+
+/* CryptoRng components */
+#define NXPBUILD__PH_CRYPTORNG_SW               /**< Software Random Number Generator */
+
 /* KeyStore components */
 #define NXPBUILD__PH_KEYSTORE_SW                /**< Software KeyStore */
 /*#define NXPBUILD__PH_KEYSTORE_RC663 */            /**< RC663 KeyStore */
@@ -44,393 +44,169 @@
 #error ** Mismatch reader device - PN512 and RC663 are enabled together **
 #endif
 
-static void* irq_pin_helper(void*);
-
-static struct
-{
-#if defined NXPBUILD__PHHAL_HW_RC523
-	int irq;
-	int nrst;
+#if defined NXPBUILD__PHHAL_HW_RC663
+#define PHHW_CONFIG_RESET_ASSERT    "1" /* RC663 PDOWN pin is active high */
+#define PHHW_CONFIG_RESET_RELEASE   "0"
+#else
+#define PHHW_CONFIG_RESET_ASSERT    "0"
+#define PHHW_CONFIG_RESET_RELEASE   "1"
 #endif
 
-#if defined NXPBUILD__PHHAL_HW_PN5180
-	int irq;
-	int nrst;
+#ifndef PIN_CS_IN
+#define PIN_CS_IN           PHHW_CONFIG_PIN_UNUSED
 #endif
-
-#if defined NXPBUILD__PHHAL_HW_RC663
-	int irq;
-	int nrst;
-	int ifsel0;
-	int ifsel1;
+#ifndef PIN_IFSEL0
+#define PIN_IFSEL0          PHHW_CONFIG_PIN_UNUSED
+#endif
+#ifndef PIN_IFSEL1
+#define PIN_IFSEL1          PHHW_CONFIG_PIN_UNUSED
 #endif
 
-	volatile bool irq_pending;
+static void* irq_pin_helper(void*);
 
-	pthread_t irqThread;
-} _data;
+/* Reader wired as described by the pin macros, used by the single reader API */
+static phhwConfig_Reader_t _data;
 
-/* =============================================================================
- * Function:    Set_Interface_Link
- *
- * brief:
- *   Initialize interface link
- *
- * ---------------------------------------------------------------------------*/
-int Set_Interface_Link(void)
+static int phhwConfig_Int_SetupPin(int32_t dwPin, bool bOutput, int mode, int32_t * pFd)
 {
-	int ret = 0;
-#if defined NXPBUILD__PHHAL_HW_RC523
-	//Configure all these pins
-	_data.irq = _data.nrst = -1;
-
-	//Export them
-	ret = gpio_export(PIN_CS_IN);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	ret = gpio_export(PIN_IRQ);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	ret = gpio_export(PIN_NRST);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	//Set pin directions
-	ret = gpio_set_direction(PIN_CS_IN, false);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	ret = gpio_set_direction(PIN_IRQ, false);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	ret = gpio_set_direction(PIN_NRST, true);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	_data.irq = gpio_open(PIN_IRQ, O_RDONLY);
-	if(_data.irq < 0)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	_data.nrst = gpio_open(PIN_NRST, O_WRONLY);
-	if(_data.nrst < 0)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-#endif /* NXPBUILD__PHHAL_HW_RC523 */
-
-#if defined NXPBUILD__PHHAL_HW_RC663
-	//Configure all these pins
-	_data.irq = _data.nrst = -1;
-
-	//Export them
-	ret = gpio_export(PIN_CS_IN);
-	if(ret)
+	if(dwPin == PHHW_CONFIG_PIN_UNUSED)
 	{
-		Cleanup_Interface_Link();
-		return -1;
+		return 0;
 	}
 
-	ret = gpio_export(PIN_IRQ);
-	if(ret)
+	if(gpio_export(dwPin))
 	{
-		Cleanup_Interface_Link();
 		return -1;
 	}
 
-	ret = gpio_export(PIN_NRST);
-	if(ret)
+	if(gpio_set_direction(dwPin, bOutput))
 	{
-		Cleanup_Interface_Link();
 		return -1;
 	}
 
-	ret = gpio_export(PIN_IFSEL0);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-	
-	ret = gpio_export(PIN_IFSEL1);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-
-	//Set pin directions
-	ret = gpio_set_direction(PIN_CS_IN, false);
-	if(ret)
+	if(pFd != NULL)
 	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	ret = gpio_set_direction(PIN_IRQ, false);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	ret = gpio_set_direction(PIN_NRST, true);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	ret = gpio_set_direction(PIN_IFSEL0, true);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-	
-	ret = gpio_set_direction(PIN_IFSEL1, true);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-
-	_data.irq = gpio_open(PIN_IRQ, O_RDONLY);
-	if(_data.irq < 0)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	_data.nrst = gpio_open(PIN_NRST, O_WRONLY);
-	if(_data.nrst < 0)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	_data.ifsel0 = gpio_open(PIN_IFSEL0, O_WRONLY);
-	if(_data.ifsel0 < 0)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
-
-	_data.ifsel1 = gpio_open(PIN_IFSEL1, O_WRONLY);
-	if(_data.ifsel1 < 0)
-	{
-		Cleanup_Interface_Link();
-		return -1;
+		*pFd = gpio_open(dwPin, mode);
+		if(*pFd < 0)
+		{
+			return -1;
+		}
 	}
 
-	write(_data.ifsel0, "0", 1);
-	write(_data.ifsel1, "1", 1);
-	
-
-#endif /* NXPBUILD__PHHAL_HW_RC663 */
-
-
-
-#if defined NXPBUILD__PHHAL_HW_PN5180
-	//Configure all these pins
-	_data.irq = _data.nrst = -1;
-
-	//Export them
+	return 0;
+}
 
-	ret = gpio_export(PIN_IRQ);
-	if(ret)
+static void phhwConfig_Int_ReleasePin(int32_t dwPin, int32_t * pFd)
+{
+	if(*pFd >= 0)
 	{
-		Cleanup_Interface_Link();
-		return -1;
+		close(*pFd);
+		*pFd = -1;
 	}
 
-	ret = gpio_export(PIN_NRST);
-	if(ret)
+	if(dwPin != PHHW_CONFIG_PIN_UNUSED)
 	{
-		Cleanup_Interface_Link();
-		return -1;
+		gpio_unexport(dwPin);
 	}
+}
 
-	//Set pin directions
-	ret = gpio_set_direction(PIN_IRQ, false);
-	if(ret)
-	{
-		Cleanup_Interface_Link();
-		return -1;
-	}
+/* =============================================================================
+ * Function:    phhwConfig_Reader_Init
+ *
+ * brief:
+ *   Describe how one reader is wired. IFSEL pins are unused unless set after
+ *   this call. Events of the reader go to pEventCtx, or to the HAL thread when
+ *   it is NULL.
+ *
+ * ---------------------------------------------------------------------------*/
+void phhwConfig_Reader_Init(phhwConfig_Reader_t * pReader, int32_t dwCsInPin, int32_t dwIrqPin,
+	int32_t dwResetPin, phOsal_Posix_EventCtxHandle_t pEventCtx)
+{
+	pReader->dwCsInPin = dwCsInPin;
+	pReader->dwIrqPin = dwIrqPin;
+	pReader->dwResetPin = dwResetPin;
+	pReader->dwIfSel0Pin = PHHW_CONFIG_PIN_UNUSED;
+	pReader->dwIfSel1Pin = PHHW_CONFIG_PIN_UNUSED;
+	pReader->dwIrqFd = -1;
+	pReader->dwResetFd = -1;
+	pReader->dwIfSel0Fd = -1;
+	pReader->dwIfSel1Fd = -1;
+	pReader->pEventCtx = pEventCtx;
+}
 
-	ret = gpio_set_direction(PIN_NRST, true);
-	if(ret)
+/* =============================================================================
+ * Function:    phhwConfig_Reader_SetInterfaceLink
+ *
+ * brief:
+ *   Initialize interface link of one reader
+ *
+ * ---------------------------------------------------------------------------*/
+int phhwConfig_Reader_SetInterfaceLink(phhwConfig_Reader_t * pReader)
+{
+	if(phhwConfig_Int_SetupPin(pReader->dwCsInPin, false, O_RDONLY, NULL) ||
+		phhwConfig_Int_SetupPin(pReader->dwIrqPin, false, O_RDONLY, &pReader->dwIrqFd) ||
+		phhwConfig_Int_SetupPin(pReader->dwResetPin, true, O_WRONLY, &pReader->dwResetFd) ||
+		phhwConfig_Int_SetupPin(pReader->dwIfSel0Pin, true, O_WRONLY, &pReader->dwIfSel0Fd) ||
+		phhwConfig_Int_SetupPin(pReader->dwIfSel1Pin, true, O_WRONLY, &pReader->dwIfSel1Fd))
 	{
-		Cleanup_Interface_Link();
+		phhwConfig_Reader_CleanupInterfaceLink(pReader);
 		return -1;
 	}
 
-	_data.irq = gpio_open(PIN_IRQ, O_RDONLY);
-	if(_data.irq < 0)
+	//Select SPI host interface
+	if(pReader->dwIfSel0Fd >= 0)
 	{
-		Cleanup_Interface_Link();
-		return -1;
+		write(pReader->dwIfSel0Fd, "0", 1);
 	}
-
-	_data.nrst = gpio_open(PIN_NRST, O_WRONLY);
-	if(_data.nrst < 0)
+	if(pReader->dwIfSel1Fd >= 0)
 	{
-		Cleanup_Interface_Link();
-		return -1;
+		write(pReader->dwIfSel1Fd, "1", 1);
 	}
 
-#endif /* NXPBUILD__PHHAL_HW_PN5180 */
-
 	//Perform reset
-	Reset_reader_device();
+	phhwConfig_Reader_Reset(pReader);
 
 	return 0;
 }
 
-void Cleanup_Interface_Link(void)
+void phhwConfig_Reader_CleanupInterfaceLink(phhwConfig_Reader_t * pReader)
 {
-#if defined NXPBUILD__PHHAL_HW_RC523
-	//Close open file descriptors
-	if(_data.irq >= 0)
-	{
-		close(_data.irq);
-		_data.irq = -1;
-	}
-	if(_data.nrst >= 0)
-	{
-		close(_data.nrst);
-		_data.nrst = -1;
-	}
-
-	//Unexport all
-	gpio_unexport(PIN_CS_IN);
-	gpio_unexport(PIN_IRQ);
-	gpio_unexport(PIN_NRST);
-#endif
-
-#if defined NXPBUILD__PHHAL_HW_RC663
-	//Close open file descriptors
-	if(_data.irq >= 0)
-	{
-		close(_data.irq);
-		_data.irq = -1;
-	}
-	if(_data.nrst >= 0)
+	//Close open file descriptors and unexport all
+	phhwConfig_Int_ReleasePin(pReader->dwIrqPin, &pReader->dwIrqFd);
+	phhwConfig_Int_ReleasePin(pReader->dwResetPin, &pReader->dwResetFd);
+	phhwConfig_Int_ReleasePin(pReader->dwIfSel0Pin, &pReader->dwIfSel0Fd);
+	phhwConfig_Int_ReleasePin(pReader->dwIfSel1Pin, &pReader->dwIfSel1Fd);
+	if(pReader->dwCsInPin != PHHW_CONFIG_PIN_UNUSED)
 	{
-		close(_data.nrst);
-		_data.nrst = -1;
+		gpio_unexport(pReader->dwCsInPin);
 	}
-	if(_data.ifsel0 >= 0)
-	{
-		close(_data.ifsel0);
-		_data.ifsel0 = -1;
-	}
-	if(_data.ifsel1 >= 0)
-	{
-		close(_data.ifsel1);
-		_data.ifsel1 = -1;
-	}
-
-	//Unexport all
-	gpio_unexport(PIN_CS_IN);
-	gpio_unexport(PIN_IRQ);
-	gpio_unexport(PIN_NRST);
-	gpio_unexport(PIN_IFSEL0);
-	gpio_unexport(PIN_IFSEL1);
-#endif
-
-
-
-#if defined NXPBUILD__PHHAL_HW_PN5180
-	//Close open file descriptors
-	if(_data.irq >= 0)
-	{
-		close(_data.irq);
-		_data.irq = -1;
-	}
-	if(_data.nrst >= 0)
-	{
-		close(_data.nrst);
-		_data.nrst = -1;
-	}
-
-	//Unexport all
-	gpio_unexport(PIN_IRQ);
-	gpio_unexport(PIN_NRST);
-#endif
 }
 
 /*==============================================================================
- * Function:    Reset_reader_device
+ * Function:    phhwConfig_Reader_Reset
  *
- * brief:   This function resets an attached reader IC. In PIN_RESET macro is a
- *          correct pin .
+ * brief:   This function resets one attached reader IC through its reset pin.
  *
  * ---------------------------------------------------------------------------*/
-void Reset_reader_device(void)
+void phhwConfig_Reader_Reset(phhwConfig_Reader_t * pReader)
 {
-#if defined NXPBUILD__PHHAL_HW_RC523
-	write(_data.nrst, "0", 1);
-	usleep(10000); //Wait 10 ms
-	write(_data.nrst, "1", 1);
-	usleep(10000); //Wait 10 ms
-#endif
-
-#if defined NXPBUILD__PHHAL_HW_RC663
-	write(_data.nrst, "1", 1);
+	write(pReader->dwResetFd, PHHW_CONFIG_RESET_ASSERT, 1);
 	usleep(10000); //Wait 10 ms
-	write(_data.nrst, "0", 1);
+	write(pReader->dwResetFd, PHHW_CONFIG_RESET_RELEASE, 1);
 	usleep(10000); //Wait 10 ms
-#endif
-
-
-#if defined NXPBUILD__PHHAL_HW_PN5180
-	write(_data.nrst, "0", 1);
-	usleep(10000); //Wait 10 ms
-	write(_data.nrst, "1", 1);
-	usleep(10000); //Wait 10 ms
-#endif
 }
 
-int Set_Interrupt(void)
+int phhwConfig_Reader_SetInterrupt(phhwConfig_Reader_t * pReader)
 {
 	//This function will start a thread that will call a callback function whenever IRQ pin drops
 	int ret = 0;
     /* configure IRQ pin to react on rising edge only */
-	ret = gpio_set_edge(PIN_IRQ, true, false);
+	ret = gpio_set_edge(pReader->dwIrqPin, true, false);
 	if(ret)
 	{
 		return -1;
 	}
-    ret = pthread_create(&_data.irqThread, NULL, irq_pin_helper, NULL);
+    ret = pthread_create(&pReader->irqThread, NULL, irq_pin_helper, pReader);
     if(ret)
     {
         return -1;
@@ -443,18 +219,17 @@ int Set_Interrupt(void)
 	return 0;
 }
 
-void Cleanup_Interrupt()
+void phhwConfig_Reader_CleanupInterrupt(phhwConfig_Reader_t * pReader)
 {
-	pthread_join(_data.irqThread, NULL);
+	pthread_join(pReader->irqThread, NULL);
 }
 
-void Exit_Interrupt()
+void phhwConfig_Reader_ExitInterrupt(phhwConfig_Reader_t * pReader)
 {
-	pthread_cancel(_data.irqThread);
+	pthread_cancel(pReader->irqThread);
 }
 
-
-void Configure_Device(phhalHw_Nfc_Ic_DataParams_t* pHal)
+void phhwConfig_Reader_ConfigureDevice(phhwConfig_Reader_t * pReader, phhalHw_Nfc_Ic_DataParams_t* pHal)
 {
 #ifdef NXPBUILD__PHHAL_HW_RC523
     /* Add DG: Configure IRQ pin - required for Explore-NFC board */
@@ -471,7 +246,7 @@ void Configure_Device(phhalHw_Nfc_Ic_DataParams_t* pHal)
 	phhalHw_Pn5180_Instr_WriteE2Prom(&pHal->sHal, 0x1a, &param, 1); //Configure IRQ pin polarity & clearing method (IRQ pin active high, NON auto-clear)
         /* another read required before reset, to ensure parameter is written. Otherwise the reset could happen whilst write operation is still ongoing (takes ~3ms) */
         phhalHw_Pn5180_Instr_ReadE2Prom(&pHal->sHal, 0x1a, &param, 1);
-        Reset_reader_device();
+        phhwConfig_Reader_Reset(pReader);
     }
 #endif
 
@@ -486,6 +261,61 @@ void Configure_Device(phhalHw_Nfc_Ic_DataParams_t* pHal)
 #endif
 }
 
+/* =============================================================================
+ * Single reader API, wired as described by the pin macros
+ * ---------------------------------------------------------------------------*/
+int Set_Interface_Link(void)
+{
+	phhwConfig_Reader_Init(&_data, PIN_CS_IN, PIN_IRQ, PIN_NRST, NULL);
+	_data.dwIfSel0Pin = PIN_IFSEL0;
+	_data.dwIfSel1Pin = PIN_IFSEL1;
+
+	return phhwConfig_Reader_SetInterfaceLink(&_data);
+}
+
+void Cleanup_Interface_Link(void)
+{
+	phhwConfig_Reader_CleanupInterfaceLink(&_data);
+}
+
+void Reset_reader_device(void)
+{
+	phhwConfig_Reader_Reset(&_data);
+}
+
+int Set_Interrupt(void)
+{
+	return phhwConfig_Reader_SetInterrupt(&_data);
+}
+
+void Cleanup_Interrupt()
+{
+	phhwConfig_Reader_CleanupInterrupt(&_data);
+}
+
+void Exit_Interrupt()
+{
+	phhwConfig_Reader_ExitInterrupt(&_data);
+}
+
+void Configure_Device(phhalHw_Nfc_Ic_DataParams_t* pHal)
+{
+	phhwConfig_Reader_ConfigureDevice(&_data, pHal);
+}
+
+static phStatus_t phhwConfig_Int_PostIrq(phhwConfig_Reader_t * pReader)
+{
+	if(pReader->pEventCtx != NULL)
+	{
+		return phOsal_Posix_EventCtx_Post(pReader->pEventCtx, E_PH_OSAL_EVT_RF);
+	}
+
+	return phOsal_Event_Post(
+			E_PH_OSAL_EVT_RF,
+			E_PH_OSAL_EVT_SRC_ISR,
+			E_PH_OSAL_EVT_DEST_HAL);
+}
+
 /*==============================================================================
  * Function:    CLIF_IRQHandler
  *
@@ -496,23 +326,21 @@ void Configure_Device(phhalHw_Nfc_Ic_DataParams_t* pHal)
  * ---------------------------------------------------------------------------*/
 void* irq_pin_helper(void* param)
 {
+	phhwConfig_Reader_t * pReader = (phhwConfig_Reader_t *)param;
 	int ret = 0;
 	struct pollfd pollfd;
 	char c = 0;
 	phStatus_t status = 0;
-	pollfd.fd = _data.irq;
+	pollfd.fd = pReader->dwIrqFd;
 	pollfd.events = POLLPRI;
 
 	//Initial status: If pin is already high, post an event
-	read(_data.irq, &c, 1);
-	lseek(_data.irq, 0, SEEK_SET);
+	read(pReader->dwIrqFd, &c, 1);
+	lseek(pReader->dwIrqFd, 0, SEEK_SET);
 
 	if( c == '1' )
 	{
-		status = phOsal_Event_Post(
-				E_PH_OSAL_EVT_RF,
-				E_PH_OSAL_EVT_SRC_ISR,
-				E_PH_OSAL_EVT_DEST_HAL);
+		status = phhwConfig_Int_PostIrq(pReader);
 		CHECK_STATUS(status);
 	}
 
@@ -525,15 +353,11 @@ void* irq_pin_helper(void* param)
 		}
 
 		//Do a dummy read to acknowledge the event, before posting the event (to avoid race condition)
-		read(_data.irq, &c, 1);
-		lseek(_data.irq, 0, SEEK_SET);
+		read(pReader->dwIrqFd, &c, 1);
+		lseek(pReader->dwIrqFd, 0, SEEK_SET);
 
-                status = phOsal_Event_Post(
-				E_PH_OSAL_EVT_RF,
-				E_PH_OSAL_EVT_SRC_ISR,
-				E_PH_OSAL_EVT_DEST_HAL);
+		status = phhwConfig_Int_PostIrq(pReader);
 		CHECK_STATUS(status);
-
 	}
 
 	return NULL;
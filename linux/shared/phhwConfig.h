@@ -20,6 +20,8 @@
 #include <phhalHw.h>
 #include <ph_NxpBuild.h>
 #include <phOsal.h>
+#include <pthread.h>
+#include <phOsal_Posix_Thread.h>
 
 /*******************************************************************************
  **    Global macros and definitions
@@ -125,6 +127,39 @@
 /*******************************************************************************
  **    Function prototypes
  ******************************************************************************/
+/*******************************************************************************
+ * Per reader configuration, for several readers attached to one host. Each
+ * reader has its own SPI bus or chip select (see phbalReg_Stub_DataParams_t),
+ * its own IRQ and reset pins and its own OSAL event context.
+ ******************************************************************************/
+#define PHHW_CONFIG_PIN_UNUSED  (-1)
+
+typedef struct
+{
+    int32_t dwCsInPin;      /**< Chip select input GPIO or #PHHW_CONFIG_PIN_UNUSED. */
+    int32_t dwIrqPin;       /**< IRQ GPIO. */
+    int32_t dwResetPin;     /**< Reset / power down GPIO. */
+    int32_t dwIfSel0Pin;    /**< RC663 IFSEL0 GPIO or #PHHW_CONFIG_PIN_UNUSED. */
+    int32_t dwIfSel1Pin;    /**< RC663 IFSEL1 GPIO or #PHHW_CONFIG_PIN_UNUSED. */
+    int32_t dwIrqFd;
+    int32_t dwResetFd;
+    int32_t dwIfSel0Fd;
+    int32_t dwIfSel1Fd;
+    pthread_t irqThread;
+    phOsal_Posix_EventCtxHandle_t pEventCtx; /**< Receives the RF events of the IRQ pin; NULL posts to the HAL thread. */
+} phhwConfig_Reader_t;
+
+void phhwConfig_Reader_Init(phhwConfig_Reader_t * pReader, int32_t dwCsInPin, int32_t dwIrqPin,
+    int32_t dwResetPin, phOsal_Posix_EventCtxHandle_t pEventCtx);
+int phhwConfig_Reader_SetInterfaceLink(phhwConfig_Reader_t * pReader);
+void phhwConfig_Reader_CleanupInterfaceLink(phhwConfig_Reader_t * pReader);
+int phhwConfig_Reader_SetInterrupt(phhwConfig_Reader_t * pReader);
+void phhwConfig_Reader_CleanupInterrupt(phhwConfig_Reader_t * pReader);
+void phhwConfig_Reader_ExitInterrupt(phhwConfig_Reader_t * pReader);
+void phhwConfig_Reader_Reset(phhwConfig_Reader_t * pReader);
+void phhwConfig_Reader_ConfigureDevice(phhwConfig_Reader_t * pReader, phhalHw_Nfc_Ic_DataParams_t* pHal);
+
+/* Single reader API, wired as described by the pin macros above */
 int Set_Interface_Link(void);
 void Cleanup_Interface_Link(void);
 int Set_Interrupt();
@@ -0,0 +1,173 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Random Number Generator Component of Reader Library Framework.
+*
+*/
+
+#include <ph_Status.h>
+#include <ph_RefDefs.h>
+#include <phCryptoSym.h>
+#include <phCryptoRng.h>
+#include <string.h>
+
+#ifdef NXPBUILD__PH_CRYPTORNG_SW
+
+#include "phCryptoRng_Sw.h"
+
+/* Increment V as a 128 bit big endian counter. */
+static void phCryptoRng_Sw_IncrementV(
+    phCryptoRng_Sw_DataParams_t * pDataParams
+    )
+{
+    uint8_t PH_MEMLOC_REM bIndex = PH_CRYPTOSYM_AES_BLOCK_SIZE;
+
+    do
+    {
+        bIndex--;
+        pDataParams->aV[bIndex]++;
+    } while ((pDataParams->aV[bIndex] == 0) && (bIndex > 0));
+}
+
+/* Encrypt the next counter value into pBlock. */
+static phStatus_t phCryptoRng_Sw_NextBlock(
+    phCryptoRng_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock
+    )
+{
+    phCryptoRng_Sw_IncrementV(pDataParams);
+    return phCryptoSym_Encrypt(
+        pDataParams->pCryptoDataParams,
+        PH_CRYPTOSYM_CIPHER_MODE_ECB,
+        pDataParams->aV,
+        PH_CRYPTOSYM_AES_BLOCK_SIZE,
+        pBlock);
+}
+
+/* CTR_DRBG_Update: derive a new Key and V, mixing in pData (zero padded to the seed length). */
+static phStatus_t phCryptoRng_Sw_Update(
+    phCryptoRng_Sw_DataParams_t * pDataParams,
+    const uint8_t * pData,
+    uint8_t bDataLength
+    )
+{
+    phStatus_t PH_MEMLOC_REM statusTmp;
+    uint8_t    PH_MEMLOC_BUF aTemp[PH_CRYPTORNG_SW_SEED_LENGTH];
+    uint8_t    PH_MEMLOC_REM bIndex;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoRng_Sw_NextBlock(pDataParams, &aTemp[0]));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoRng_Sw_NextBlock(pDataParams, &aTemp[PH_CRYPTOSYM_AES_BLOCK_SIZE]));
+
+    for (bIndex = 0; bIndex < bDataLength; bIndex++)
+    {
+        aTemp[bIndex] ^= pData[bIndex];
+    }
+
+    memcpy(pDataParams->aKey, &aTemp[0], PH_CRYPTOSYM_AES_BLOCK_SIZE); /* PRQA S 3200 */
+    memcpy(pDataParams->aV, &aTemp[PH_CRYPTOSYM_AES_BLOCK_SIZE], PH_CRYPTOSYM_AES_BLOCK_SIZE); /* PRQA S 3200 */
+    memset(aTemp, 0x00, sizeof(aTemp)); /* PRQA S 3200 */
+
+    return phCryptoSym_LoadKeyDirect(pDataParams->pCryptoDataParams, pDataParams->aKey, PH_CRYPTOSYM_KEY_TYPE_AES128);
+}
+
+phStatus_t phCryptoRng_Sw_Init(
+                               phCryptoRng_Sw_DataParams_t * pDataParams,
+                               uint16_t wSizeOfDataParams,
+                               void * pCryptoDataParams
+                               )
+{
+    if (sizeof(phCryptoRng_Sw_DataParams_t) != wSizeOfDataParams)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTORNG);
+    }
+    PH_ASSERT_NULL (pDataParams);
+    PH_ASSERT_NULL (pCryptoDataParams);
+
+    pDataParams->wId                = PH_COMP_CRYPTORNG | PH_CRYPTORNG_SW_ID;
+    pDataParams->pCryptoDataParams  = pCryptoDataParams;
+    memset(pDataParams->aKey, 0x00, PH_CRYPTOSYM_AES_BLOCK_SIZE); /* PRQA S 3200 */
+    memset(pDataParams->aV, 0x00, PH_CRYPTOSYM_AES_BLOCK_SIZE); /* PRQA S 3200 */
+    pDataParams->bState             = PH_OFF;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTORNG);
+}
+
+phStatus_t phCryptoRng_Sw_Seed(
+                               phCryptoRng_Sw_DataParams_t * pDataParams,
+                               const uint8_t * pSeed,
+                               uint8_t bSeedLength
+                               )
+{
+    phStatus_t PH_MEMLOC_REM statusTmp;
+    uint8_t    PH_MEMLOC_REM bChunk;
+
+    /* Instantiate from an all zero Key and V, reseed from the current state. */
+    if (pDataParams->bState == PH_OFF)
+    {
+        memset(pDataParams->aKey, 0x00, PH_CRYPTOSYM_AES_BLOCK_SIZE); /* PRQA S 3200 */
+        memset(pDataParams->aV, 0x00, PH_CRYPTOSYM_AES_BLOCK_SIZE); /* PRQA S 3200 */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_SetConfig(
+            pDataParams->pCryptoDataParams,
+            PH_CRYPTOSYM_CONFIG_KEEP_IV,
+            PH_CRYPTOSYM_VALUE_KEEP_IV_OFF));
+        PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_LoadKeyDirect(
+            pDataParams->pCryptoDataParams,
+            pDataParams->aKey,
+            PH_CRYPTOSYM_KEY_TYPE_AES128));
+    }
+
+    do
+    {
+        bChunk = (bSeedLength > PH_CRYPTORNG_SW_SEED_LENGTH) ? PH_CRYPTORNG_SW_SEED_LENGTH : bSeedLength;
+        PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoRng_Sw_Update(pDataParams, pSeed, bChunk));
+        pSeed = &pSeed[bChunk];
+        bSeedLength = bSeedLength - bChunk;
+    } while (bSeedLength > 0);
+
+    pDataParams->bState = PH_ON;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTORNG);
+}
+
+phStatus_t phCryptoRng_Sw_Rnd(
+                              phCryptoRng_Sw_DataParams_t * pDataParams,
+                              uint16_t wNoOfRndBytes,
+                              uint8_t * pRnd
+                              )
+{
+    phStatus_t PH_MEMLOC_REM statusTmp;
+    uint8_t    PH_MEMLOC_BUF aBlock[PH_CRYPTOSYM_AES_BLOCK_SIZE];
+    uint16_t   PH_MEMLOC_REM wChunk;
+
+    if (pDataParams->bState != PH_ON)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_CRYPTORNG);
+    }
+
+    while (wNoOfRndBytes > 0)
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoRng_Sw_NextBlock(pDataParams, aBlock));
+        wChunk = (wNoOfRndBytes > PH_CRYPTOSYM_AES_BLOCK_SIZE) ? PH_CRYPTOSYM_AES_BLOCK_SIZE : wNoOfRndBytes;
+        memcpy(pRnd, aBlock, wChunk); /* PRQA S 3200 */
+        pRnd = &pRnd[wChunk];
+        wNoOfRndBytes = (uint16_t)(wNoOfRndBytes - wChunk);
+    }
+    memset(aBlock, 0x00, sizeof(aBlock)); /* PRQA S 3200 */
+
+    /* Backtracking resistance: the state used for this output is replaced. */
+    return phCryptoRng_Sw_Update(pDataParams, NULL, 0);
+}
+
+#endif /* NXPBUILD__PH_CRYPTORNG_SW */
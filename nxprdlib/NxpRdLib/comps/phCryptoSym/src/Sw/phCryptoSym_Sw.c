@@ -0,0 +1,526 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Symmetric Cryptography Component of Reader Library Framework.
+*
+*/
+
+#include <ph_Status.h>
+#include <ph_RefDefs.h>
+#include <phCryptoSym.h>
+#include <phKeyStore.h>
+#include <string.h>
+
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+
+#include "phCryptoSym_Sw.h"
+#include "phCryptoSym_Sw_Aes.h"
+#include "phCryptoSym_Sw_Des.h"
+
+static uint8_t phCryptoSym_Sw_GetBlockSize(
+    uint16_t wKeyType
+    )
+{
+    switch (wKeyType)
+    {
+    case PH_CRYPTOSYM_KEY_TYPE_AES128:
+    case PH_CRYPTOSYM_KEY_TYPE_AES192:
+    case PH_CRYPTOSYM_KEY_TYPE_AES256:
+        return PH_CRYPTOSYM_AES_BLOCK_SIZE;
+
+    case PH_CRYPTOSYM_KEY_TYPE_DES:
+    case PH_CRYPTOSYM_KEY_TYPE_2K3DES:
+    case PH_CRYPTOSYM_KEY_TYPE_3K3DES:
+        return PH_CRYPTOSYM_DES_BLOCK_SIZE;
+
+    default:
+        return 0;
+    }
+}
+
+static void phCryptoSym_Sw_EncryptBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock
+    )
+{
+    if (phCryptoSym_Sw_GetBlockSize(pDataParams->wKeyType) == PH_CRYPTOSYM_AES_BLOCK_SIZE)
+    {
+        phCryptoSym_Sw_Aes_EncryptBlock(pDataParams, pBlock);
+    }
+    else
+    {
+        phCryptoSym_Sw_Des_EncryptBlock(pDataParams, pBlock);
+    }
+}
+
+static void phCryptoSym_Sw_DecryptBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock
+    )
+{
+    if (phCryptoSym_Sw_GetBlockSize(pDataParams->wKeyType) == PH_CRYPTOSYM_AES_BLOCK_SIZE)
+    {
+        phCryptoSym_Sw_Aes_DecryptBlock(pDataParams, pBlock);
+    }
+    else
+    {
+        phCryptoSym_Sw_Des_DecryptBlock(pDataParams, pBlock);
+    }
+}
+
+static void phCryptoSym_Sw_Xor(
+    uint8_t * pTarget,
+    const uint8_t * pSource,
+    uint8_t bLength
+    )
+{
+    uint8_t PH_MEMLOC_REM bIndex;
+
+    for (bIndex = 0; bIndex < bLength; bIndex++)
+    {
+        pTarget[bIndex] ^= pSource[bIndex];
+    }
+}
+
+/* Validates wOption and the buffer length of Encrypt and Decrypt, returns the block size. */
+static phStatus_t phCryptoSym_Sw_CheckCipherParams(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint16_t wOption,
+    uint16_t wBufferLength,
+    uint8_t * pBlockSize
+    )
+{
+    *pBlockSize = phCryptoSym_Sw_GetBlockSize(pDataParams->wKeyType);
+    if (*pBlockSize == 0)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_KEY, PH_COMP_CRYPTOSYM);
+    }
+
+    if ((wOption & (uint16_t)~(PH_CRYPTOSYM_CIPHER_MODE_MASK | PH_EXCHANGE_BUFFERED_BIT | PH_EXCHANGE_LEAVE_BUFFER_BIT)) ||
+        (((wOption & PH_CRYPTOSYM_CIPHER_MODE_MASK) != PH_CRYPTOSYM_CIPHER_MODE_ECB) &&
+        ((wOption & PH_CRYPTOSYM_CIPHER_MODE_MASK) != PH_CRYPTOSYM_CIPHER_MODE_CBC)) ||
+        (wBufferLength % *pBlockSize))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+/* A completed operation without KEEP_IV starts the next one from a zero IV. */
+static void phCryptoSym_Sw_CompleteIv(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint16_t wOption
+    )
+{
+    if ((!(wOption & PH_EXCHANGE_BUFFERED_BIT)) && (pDataParams->wKeepIV == PH_CRYPTOSYM_VALUE_KEEP_IV_OFF))
+    {
+        memset(pDataParams->pIV, 0x00, PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE); /* PRQA S 3200 */
+    }
+}
+
+/* CMAC sub key: one bit left shift, reduced by Rb (0x87 for 128 bit, 0x1B for 64 bit blocks). */
+static void phCryptoSym_Sw_CmacShift(
+    const uint8_t * pInput,
+    uint8_t * pOutput,
+    uint8_t bBlockSize
+    )
+{
+    uint8_t PH_MEMLOC_REM bMsb = (uint8_t)(0U - (pInput[0] >> 7));
+    uint8_t PH_MEMLOC_REM bIndex;
+
+    for (bIndex = 0; bIndex < (bBlockSize - 1); bIndex++)
+    {
+        pOutput[bIndex] = (uint8_t)((pInput[bIndex] << 1) | (pInput[bIndex + 1] >> 7));
+    }
+    pOutput[bBlockSize - 1] = (uint8_t)((pInput[bBlockSize - 1] << 1) ^
+        (bMsb & ((bBlockSize == PH_CRYPTOSYM_AES_BLOCK_SIZE) ? 0x87U : 0x1BU)));
+}
+
+phStatus_t phCryptoSym_Sw_Init(
+                               phCryptoSym_Sw_DataParams_t * pDataParams,
+                               uint16_t wSizeOfDataParams,
+                               void * pKeyStoreDataParams
+                               )
+{
+    if (sizeof(phCryptoSym_Sw_DataParams_t) != wSizeOfDataParams)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+    }
+    PH_ASSERT_NULL (pDataParams);
+
+    pDataParams->wId                    = PH_COMP_CRYPTOSYM | PH_CRYPTOSYM_SW_ID;
+    pDataParams->pKeyStoreDataParams    = pKeyStoreDataParams;
+    pDataParams->wKeepIV                = PH_CRYPTOSYM_VALUE_KEEP_IV_OFF;
+    pDataParams->bHwAcceleration        = phCryptoSym_Sw_Aes_HwAvailable();
+
+    return phCryptoSym_Sw_InvalidateKey(pDataParams);
+}
+
+phStatus_t phCryptoSym_Sw_InvalidateKey(
+                                        phCryptoSym_Sw_DataParams_t * pDataParams
+                                        )
+{
+    memset(pDataParams->pKeySchedule, 0x00, PH_CRYPTOSYM_SW_KEY_SCHEDULE_SIZE); /* PRQA S 3200 */
+    memset(pDataParams->pIV, 0x00, PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE); /* PRQA S 3200 */
+    memset(pDataParams->pCMACSubKey1, 0x00, PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE); /* PRQA S 3200 */
+    memset(pDataParams->pCMACSubKey2, 0x00, PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE); /* PRQA S 3200 */
+    memset(pDataParams->pCMACBuffer, 0x00, PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE); /* PRQA S 3200 */
+    pDataParams->bCMACBufferLength = 0;
+    pDataParams->bCMACSubKeysInitialized = PH_OFF;
+    pDataParams->wKeyType = PH_CRYPTOSYM_KEY_TYPE_INVALID;
+    pDataParams->bRounds = 0;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_Encrypt(
+                                  phCryptoSym_Sw_DataParams_t * pDataParams,
+                                  uint16_t wOption,
+                                  const uint8_t * pPlainBuffer,
+                                  uint16_t wBufferLength,
+                                  uint8_t * pEncryptedBuffer
+                                  )
+{
+    phStatus_t PH_MEMLOC_REM statusTmp;
+    uint8_t    PH_MEMLOC_REM bBlockSize;
+    uint16_t   PH_MEMLOC_REM wIndex;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Sw_CheckCipherParams(pDataParams, wOption, wBufferLength, &bBlockSize));
+
+    for (wIndex = 0; wIndex < wBufferLength; wIndex = wIndex + bBlockSize)
+    {
+        memmove(&pEncryptedBuffer[wIndex], &pPlainBuffer[wIndex], bBlockSize); /* PRQA S 3200 */
+        if ((wOption & PH_CRYPTOSYM_CIPHER_MODE_MASK) == PH_CRYPTOSYM_CIPHER_MODE_CBC)
+        {
+            phCryptoSym_Sw_Xor(&pEncryptedBuffer[wIndex], pDataParams->pIV, bBlockSize);
+            phCryptoSym_Sw_EncryptBlock(pDataParams, &pEncryptedBuffer[wIndex]);
+            memcpy(pDataParams->pIV, &pEncryptedBuffer[wIndex], bBlockSize); /* PRQA S 3200 */
+        }
+        else
+        {
+            phCryptoSym_Sw_EncryptBlock(pDataParams, &pEncryptedBuffer[wIndex]);
+        }
+    }
+
+    if ((wOption & PH_CRYPTOSYM_CIPHER_MODE_MASK) == PH_CRYPTOSYM_CIPHER_MODE_CBC)
+    {
+        phCryptoSym_Sw_CompleteIv(pDataParams, wOption);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_Decrypt(
+                                  phCryptoSym_Sw_DataParams_t * pDataParams,
+                                  uint16_t wOption,
+                                  const uint8_t * pEncryptedBuffer,
+                                  uint16_t wBufferLength,
+                                  uint8_t * pPlainBuffer
+                                  )
+{
+    phStatus_t PH_MEMLOC_REM statusTmp;
+    uint8_t    PH_MEMLOC_REM bBlockSize;
+    uint16_t   PH_MEMLOC_REM wIndex;
+    uint8_t    PH_MEMLOC_REM aCipher[PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE];
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Sw_CheckCipherParams(pDataParams, wOption, wBufferLength, &bBlockSize));
+
+    for (wIndex = 0; wIndex < wBufferLength; wIndex = wIndex + bBlockSize)
+    {
+        /* keep the cipher block, input and output may overlap */
+        memcpy(aCipher, &pEncryptedBuffer[wIndex], bBlockSize); /* PRQA S 3200 */
+        memcpy(&pPlainBuffer[wIndex], aCipher, bBlockSize); /* PRQA S 3200 */
+        phCryptoSym_Sw_DecryptBlock(pDataParams, &pPlainBuffer[wIndex]);
+        if ((wOption & PH_CRYPTOSYM_CIPHER_MODE_MASK) == PH_CRYPTOSYM_CIPHER_MODE_CBC)
+        {
+            phCryptoSym_Sw_Xor(&pPlainBuffer[wIndex], pDataParams->pIV, bBlockSize);
+            memcpy(pDataParams->pIV, aCipher, bBlockSize); /* PRQA S 3200 */
+        }
+    }
+
+    if ((wOption & PH_CRYPTOSYM_CIPHER_MODE_MASK) == PH_CRYPTOSYM_CIPHER_MODE_CBC)
+    {
+        phCryptoSym_Sw_CompleteIv(pDataParams, wOption);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_CalculateMac(
+                                       phCryptoSym_Sw_DataParams_t * pDataParams,
+                                       uint16_t wOption,
+                                       const uint8_t * pData,
+                                       uint16_t wDataLength,
+                                       uint8_t * pMac,
+                                       uint8_t * pMacLength
+                                       )
+{
+    uint8_t  PH_MEMLOC_REM bBlockSize;
+    uint8_t  PH_MEMLOC_REM bMode = (uint8_t)(wOption & PH_CRYPTOSYM_CIPHER_MODE_MASK);
+    uint8_t  PH_MEMLOC_REM bLength;
+    uint8_t  PH_MEMLOC_REM aLast[PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE];
+
+    *pMacLength = 0;
+
+    bBlockSize = phCryptoSym_Sw_GetBlockSize(pDataParams->wKeyType);
+    if (bBlockSize == 0)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_KEY, PH_COMP_CRYPTOSYM);
+    }
+    if ((wOption & (uint16_t)~(PH_CRYPTOSYM_CIPHER_MODE_MASK | PH_EXCHANGE_BUFFERED_BIT | PH_EXCHANGE_LEAVE_BUFFER_BIT)) ||
+        ((bMode != PH_CRYPTOSYM_MAC_MODE_CMAC) && (bMode != PH_CRYPTOSYM_MAC_MODE_CBCMAC)))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    /* A new MAC calculation drops any pending input */
+    if (!(wOption & PH_EXCHANGE_LEAVE_BUFFER_BIT))
+    {
+        pDataParams->bCMACBufferLength = 0;
+    }
+
+    while (wDataLength > 0)
+    {
+        /* A full pending block is only chained once more input follows, the last block is special */
+        if (pDataParams->bCMACBufferLength == bBlockSize)
+        {
+            phCryptoSym_Sw_Xor(pDataParams->pIV, pDataParams->pCMACBuffer, bBlockSize);
+            phCryptoSym_Sw_EncryptBlock(pDataParams, pDataParams->pIV);
+            pDataParams->bCMACBufferLength = 0;
+        }
+
+        bLength = bBlockSize - pDataParams->bCMACBufferLength;
+        if (wDataLength < bLength)
+        {
+            bLength = (uint8_t)wDataLength;
+        }
+        memcpy(&pDataParams->pCMACBuffer[pDataParams->bCMACBufferLength], pData, bLength); /* PRQA S 3200 */
+        pDataParams->bCMACBufferLength = pDataParams->bCMACBufferLength + bLength;
+        pData += bLength;
+        wDataLength = wDataLength - bLength;
+    }
+
+    if (wOption & PH_EXCHANGE_BUFFERED_BIT)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+    }
+
+    /* Last block: padded and, for CMAC, combined with the sub key */
+    memset(aLast, 0x00, PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE); /* PRQA S 3200 */
+    memcpy(aLast, pDataParams->pCMACBuffer, pDataParams->bCMACBufferLength); /* PRQA S 3200 */
+
+    if (bMode == PH_CRYPTOSYM_MAC_MODE_CMAC)
+    {
+        if (pDataParams->bCMACSubKeysInitialized == PH_OFF)
+        {
+            memset(pDataParams->pCMACSubKey2, 0x00, PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE); /* PRQA S 3200 */
+            phCryptoSym_Sw_EncryptBlock(pDataParams, pDataParams->pCMACSubKey2);
+            phCryptoSym_Sw_CmacShift(pDataParams->pCMACSubKey2, pDataParams->pCMACSubKey1, bBlockSize);
+            phCryptoSym_Sw_CmacShift(pDataParams->pCMACSubKey1, pDataParams->pCMACSubKey2, bBlockSize);
+            pDataParams->bCMACSubKeysInitialized = PH_ON;
+        }
+
+        if (pDataParams->bCMACBufferLength == bBlockSize)
+        {
+            phCryptoSym_Sw_Xor(aLast, pDataParams->pCMACSubKey1, bBlockSize);
+        }
+        else
+        {
+            aLast[pDataParams->bCMACBufferLength] = 0x80;
+            phCryptoSym_Sw_Xor(aLast, pDataParams->pCMACSubKey2, bBlockSize);
+        }
+    }
+
+    phCryptoSym_Sw_Xor(pDataParams->pIV, aLast, bBlockSize);
+    phCryptoSym_Sw_EncryptBlock(pDataParams, pDataParams->pIV);
+    memcpy(pMac, pDataParams->pIV, bBlockSize); /* PRQA S 3200 */
+    *pMacLength = bBlockSize;
+
+    pDataParams->bCMACBufferLength = 0;
+    phCryptoSym_Sw_CompleteIv(pDataParams, wOption);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_LoadIv(
+                                 phCryptoSym_Sw_DataParams_t * pDataParams,
+                                 const uint8_t * pIV,
+                                 uint8_t bIVLength
+                                 )
+{
+    if (bIVLength != phCryptoSym_Sw_GetBlockSize(pDataParams->wKeyType))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    memcpy(pDataParams->pIV, pIV, bIVLength); /* PRQA S 3200 */
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_LoadKey(
+                                  phCryptoSym_Sw_DataParams_t * pDataParams,
+                                  uint16_t wKeyNo,
+                                  uint16_t wKeyVersion,
+                                  uint16_t wKeyType
+                                  )
+{
+#ifdef NXPBUILD__PH_KEYSTORE
+    phStatus_t PH_MEMLOC_REM status;
+    uint8_t    PH_MEMLOC_REM aKey[PH_CRYPTOSYM_SW_MAX_KEY_SIZE];
+    uint16_t   PH_MEMLOC_REM wStoredKeyType;
+
+    if (pDataParams->pKeyStoreDataParams == NULL)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_CRYPTOSYM);
+    }
+
+    status = phKeyStore_GetKey(
+        pDataParams->pKeyStoreDataParams,
+        wKeyNo,
+        wKeyVersion,
+        (uint8_t)sizeof(aKey),
+        aKey,
+        &wStoredKeyType);
+
+    if (status == PH_ERR_SUCCESS)
+    {
+        status = (wStoredKeyType == wKeyType) ?
+            phCryptoSym_Sw_LoadKeyDirect(pDataParams, aKey, wKeyType) :
+            PH_ADD_COMPCODE(PH_ERR_KEY, PH_COMP_CRYPTOSYM);
+    }
+
+    /* do not leave the key on the stack */
+    memset(aKey, 0x00, sizeof(aKey)); /* PRQA S 3200 */
+
+    return status;
+#else
+    PH_UNUSED_VARIABLE(pDataParams);
+    PH_UNUSED_VARIABLE(wKeyNo);
+    PH_UNUSED_VARIABLE(wKeyVersion);
+    PH_UNUSED_VARIABLE(wKeyType);
+
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_CRYPTOSYM);
+#endif /* NXPBUILD__PH_KEYSTORE */
+}
+
+phStatus_t phCryptoSym_Sw_LoadKeyDirect(
+                                        phCryptoSym_Sw_DataParams_t * pDataParams,
+                                        const uint8_t * pKey,
+                                        uint16_t wKeyType
+                                        )
+{
+    phStatus_t PH_MEMLOC_REM statusTmp;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Sw_InvalidateKey(pDataParams));
+
+    switch (wKeyType)
+    {
+    case PH_CRYPTOSYM_KEY_TYPE_AES128:
+    case PH_CRYPTOSYM_KEY_TYPE_AES192:
+    case PH_CRYPTOSYM_KEY_TYPE_AES256:
+        PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Sw_Aes_KeyExpansion(pDataParams, pKey, (uint8_t)phCryptoSym_GetKeySize(wKeyType)));
+        break;
+
+    case PH_CRYPTOSYM_KEY_TYPE_DES:
+    case PH_CRYPTOSYM_KEY_TYPE_2K3DES:
+    case PH_CRYPTOSYM_KEY_TYPE_3K3DES:
+        PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Sw_Des_KeyExpansion(pDataParams, pKey, wKeyType));
+        break;
+
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    pDataParams->wKeyType = wKeyType;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_SetConfig(
+                                    phCryptoSym_Sw_DataParams_t * pDataParams,
+                                    uint16_t wConfig,
+                                    uint16_t wValue
+                                    )
+{
+    switch (wConfig)
+    {
+    case PH_CRYPTOSYM_CONFIG_KEEP_IV:
+        if ((wValue != PH_CRYPTOSYM_VALUE_KEEP_IV_OFF) && (wValue != PH_CRYPTOSYM_VALUE_KEEP_IV_ON))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_CRYPTOSYM);
+        }
+        pDataParams->wKeepIV = wValue;
+        break;
+
+    case PH_CRYPTOSYM_CONFIG_HW_ACCELERATION:
+        if (wValue == PH_OFF)
+        {
+            pDataParams->bHwAcceleration = PH_OFF;
+        }
+        else if ((wValue == PH_ON) && (phCryptoSym_Sw_Aes_HwAvailable() == PH_ON))
+        {
+            pDataParams->bHwAcceleration = PH_ON;
+        }
+        else
+        {
+            return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_CRYPTOSYM);
+        }
+        break;
+
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_GetConfig(
+                                    phCryptoSym_Sw_DataParams_t * pDataParams,
+                                    uint16_t wConfig,
+                                    uint16_t * pValue
+                                    )
+{
+    switch (wConfig)
+    {
+    case PH_CRYPTOSYM_CONFIG_KEY_TYPE:
+        *pValue = pDataParams->wKeyType;
+        break;
+
+    case PH_CRYPTOSYM_CONFIG_KEY_SIZE:
+        *pValue = phCryptoSym_GetKeySize(pDataParams->wKeyType);
+        break;
+
+    case PH_CRYPTOSYM_CONFIG_BLOCK_SIZE:
+        *pValue = phCryptoSym_Sw_GetBlockSize(pDataParams->wKeyType);
+        break;
+
+    case PH_CRYPTOSYM_CONFIG_KEEP_IV:
+        *pValue = pDataParams->wKeepIV;
+        break;
+
+    case PH_CRYPTOSYM_CONFIG_HW_ACCELERATION:
+        *pValue = pDataParams->bHwAcceleration;
+        break;
+
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
@@ -0,0 +1,345 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software AES block cipher of the Symmetric Cryptography Component.
+*
+* The software path computes the S-box from the GF(2^8) inverse instead of looking it up, on
+* four bytes packed into one word at a time. No table index or branch depends on key or data.
+*/
+
+#include <ph_Status.h>
+#include <ph_RefDefs.h>
+#include <phCryptoSym.h>
+
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+
+#include "phCryptoSym_Sw_Aes.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PH_CRYPTOSYM_SW_AES_NI          /* AES-NI, selected at run time. */
+#include <wmmintrin.h>
+#elif (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)) && !defined(__ARM_BIG_ENDIAN)
+#define PH_CRYPTOSYM_SW_AES_ARMV8       /* ARMv8 crypto extension, selected at compile time. */
+#include <arm_neon.h>
+#endif
+
+/* Multiply each of the four packed bytes by x in GF(2^8). */
+#define PH_CRYPTOSYM_SW_AES_XTIME(x)    ((((x) & 0x7F7F7F7FU) << 1) ^ ((((x) >> 7) & 0x01010101U) * 0x1BU))
+
+/* Rotate each of the four packed bytes left by n bits. */
+#define PH_CRYPTOSYM_SW_AES_ROTL8(x, n) ((((x) << (n)) & (0x01010101U * ((0xFFU << (n)) & 0xFFU))) | \
+                                        (((x) >> (8 - (n))) & (0x01010101U * (0xFFU >> (8 - (n))))))
+
+#define PH_CRYPTOSYM_SW_AES_ROTR32(x, n)    (((x) >> (n)) | ((x) << (32 - (n))))
+
+static uint32_t phCryptoSym_Sw_Aes_Load32(const uint8_t * pData)
+{
+    return (uint32_t)pData[0] | ((uint32_t)pData[1] << 8) | ((uint32_t)pData[2] << 16) | ((uint32_t)pData[3] << 24);
+}
+
+static void phCryptoSym_Sw_Aes_Store32(uint8_t * pData, uint32_t dwValue)
+{
+    pData[0] = (uint8_t)dwValue;
+    pData[1] = (uint8_t)(dwValue >> 8);
+    pData[2] = (uint8_t)(dwValue >> 16);
+    pData[3] = (uint8_t)(dwValue >> 24);
+}
+
+static uint32_t phCryptoSym_Sw_Aes_Mul(uint32_t dwA, uint32_t dwB)
+{
+    uint32_t PH_MEMLOC_REM dwResult = 0;
+    uint8_t  PH_MEMLOC_REM bIndex;
+
+    for (bIndex = 0; bIndex < 8; bIndex++)
+    {
+        dwResult ^= dwA & (((dwB >> bIndex) & 0x01010101U) * 0xFFU);
+        dwA = PH_CRYPTOSYM_SW_AES_XTIME(dwA);
+    }
+    return dwResult;
+}
+
+/* Multiplicative inverse of each packed byte as x^254, zero maps to zero. */
+static uint32_t phCryptoSym_Sw_Aes_Inverse(uint32_t dwX)
+{
+    uint32_t PH_MEMLOC_REM dwY;
+    uint8_t  PH_MEMLOC_REM bIndex;
+
+    /* x^3, then x^7, x^15, x^31, x^63 and x^127 */
+    dwY = phCryptoSym_Sw_Aes_Mul(phCryptoSym_Sw_Aes_Mul(dwX, dwX), dwX);
+    for (bIndex = 0; bIndex < 5; bIndex++)
+    {
+        dwY = phCryptoSym_Sw_Aes_Mul(phCryptoSym_Sw_Aes_Mul(dwY, dwY), dwX);
+    }
+    return phCryptoSym_Sw_Aes_Mul(dwY, dwY);
+}
+
+static uint32_t phCryptoSym_Sw_Aes_SubWord(uint32_t dwWord)
+{
+    dwWord = phCryptoSym_Sw_Aes_Inverse(dwWord);
+    return dwWord ^ PH_CRYPTOSYM_SW_AES_ROTL8(dwWord, 1) ^ PH_CRYPTOSYM_SW_AES_ROTL8(dwWord, 2) ^
+        PH_CRYPTOSYM_SW_AES_ROTL8(dwWord, 3) ^ PH_CRYPTOSYM_SW_AES_ROTL8(dwWord, 4) ^ 0x63636363U;
+}
+
+static uint32_t phCryptoSym_Sw_Aes_InvSubWord(uint32_t dwWord)
+{
+    return phCryptoSym_Sw_Aes_Inverse(PH_CRYPTOSYM_SW_AES_ROTL8(dwWord, 1) ^ PH_CRYPTOSYM_SW_AES_ROTL8(dwWord, 3) ^
+        PH_CRYPTOSYM_SW_AES_ROTL8(dwWord, 6) ^ 0x05050505U);
+}
+
+/* Column word holds row 0 in the least significant byte. */
+static uint32_t phCryptoSym_Sw_Aes_MixColumn(uint32_t dwColumn)
+{
+    uint32_t PH_MEMLOC_REM dwRot = PH_CRYPTOSYM_SW_AES_ROTR32(dwColumn, 8);
+
+    return PH_CRYPTOSYM_SW_AES_XTIME(dwColumn ^ dwRot) ^ dwRot ^
+        PH_CRYPTOSYM_SW_AES_ROTR32(dwColumn, 16) ^ PH_CRYPTOSYM_SW_AES_ROTR32(dwColumn, 24);
+}
+
+static uint32_t phCryptoSym_Sw_Aes_InvMixColumn(uint32_t dwColumn)
+{
+    uint32_t PH_MEMLOC_REM dwTmp = dwColumn ^ PH_CRYPTOSYM_SW_AES_ROTR32(dwColumn, 16);
+
+    dwTmp = PH_CRYPTOSYM_SW_AES_XTIME(dwTmp);
+    dwTmp = PH_CRYPTOSYM_SW_AES_XTIME(dwTmp);
+    return phCryptoSym_Sw_Aes_MixColumn(dwColumn ^ dwTmp);
+}
+
+#ifdef PH_CRYPTOSYM_SW_AES_NI
+
+__attribute__((target("aes,sse2")))
+static void phCryptoSym_Sw_Aes_EncryptBlockHw(const uint8_t * pKeySchedule, uint8_t bRounds, uint8_t * pBlock)
+{
+    __m128i PH_MEMLOC_REM xState;
+    uint8_t PH_MEMLOC_REM bRound;
+
+    xState = _mm_xor_si128(_mm_loadu_si128((const __m128i *)pBlock), _mm_loadu_si128((const __m128i *)pKeySchedule));
+    for (bRound = 1; bRound < bRounds; bRound++)
+    {
+        xState = _mm_aesenc_si128(xState, _mm_loadu_si128((const __m128i *)&pKeySchedule[bRound << 4]));
+    }
+    xState = _mm_aesenclast_si128(xState, _mm_loadu_si128((const __m128i *)&pKeySchedule[bRounds << 4]));
+    _mm_storeu_si128((__m128i *)pBlock, xState);
+}
+
+__attribute__((target("aes,sse2")))
+static void phCryptoSym_Sw_Aes_DecryptBlockHw(const uint8_t * pKeySchedule, uint8_t bRounds, uint8_t * pBlock)
+{
+    __m128i PH_MEMLOC_REM xState;
+    uint8_t PH_MEMLOC_REM bRound;
+
+    xState = _mm_xor_si128(_mm_loadu_si128((const __m128i *)pBlock), _mm_loadu_si128((const __m128i *)&pKeySchedule[bRounds << 4]));
+    for (bRound = bRounds - 1; bRound > 0; bRound--)
+    {
+        xState = _mm_aesdec_si128(xState, _mm_aesimc_si128(_mm_loadu_si128((const __m128i *)&pKeySchedule[bRound << 4])));
+    }
+    xState = _mm_aesdeclast_si128(xState, _mm_loadu_si128((const __m128i *)pKeySchedule));
+    _mm_storeu_si128((__m128i *)pBlock, xState);
+}
+
+#endif /* PH_CRYPTOSYM_SW_AES_NI */
+
+#ifdef PH_CRYPTOSYM_SW_AES_ARMV8
+
+static void phCryptoSym_Sw_Aes_EncryptBlockHw(const uint8_t * pKeySchedule, uint8_t bRounds, uint8_t * pBlock)
+{
+    uint8x16_t PH_MEMLOC_REM xState = vld1q_u8(pBlock);
+    uint8_t    PH_MEMLOC_REM bRound;
+
+    for (bRound = 0; bRound < (bRounds - 1); bRound++)
+    {
+        xState = vaesmcq_u8(vaeseq_u8(xState, vld1q_u8(&pKeySchedule[bRound << 4])));
+    }
+    xState = vaeseq_u8(xState, vld1q_u8(&pKeySchedule[(bRounds - 1) << 4]));
+    xState = veorq_u8(xState, vld1q_u8(&pKeySchedule[bRounds << 4]));
+    vst1q_u8(pBlock, xState);
+}
+
+static void phCryptoSym_Sw_Aes_DecryptBlockHw(const uint8_t * pKeySchedule, uint8_t bRounds, uint8_t * pBlock)
+{
+    uint8x16_t PH_MEMLOC_REM xState = vld1q_u8(pBlock);
+    uint8_t    PH_MEMLOC_REM bRound;
+
+    xState = vaesdq_u8(xState, vld1q_u8(&pKeySchedule[bRounds << 4]));
+    for (bRound = bRounds - 1; bRound > 0; bRound--)
+    {
+        xState = vaesdq_u8(vaesimcq_u8(xState), vaesimcq_u8(vld1q_u8(&pKeySchedule[bRound << 4])));
+    }
+    xState = veorq_u8(xState, vld1q_u8(pKeySchedule));
+    vst1q_u8(pBlock, xState);
+}
+
+#endif /* PH_CRYPTOSYM_SW_AES_ARMV8 */
+
+uint8_t phCryptoSym_Sw_Aes_HwAvailable(void)
+{
+#if defined(PH_CRYPTOSYM_SW_AES_NI)
+    __builtin_cpu_init();
+    return (__builtin_cpu_supports("aes")) ? PH_ON : PH_OFF;
+#elif defined(PH_CRYPTOSYM_SW_AES_ARMV8)
+    return PH_ON;
+#else
+    return PH_OFF;
+#endif
+}
+
+phStatus_t phCryptoSym_Sw_Aes_KeyExpansion(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    const uint8_t * pKey,
+    uint8_t bKeyLength
+    )
+{
+    uint8_t  PH_MEMLOC_REM bKeyWords = bKeyLength >> 2;
+    uint8_t  PH_MEMLOC_REM bIndex;
+    uint8_t  PH_MEMLOC_REM bRcon = 0x01;
+    uint32_t PH_MEMLOC_REM dwTmp;
+
+    if ((bKeyLength != 16) && (bKeyLength != 24) && (bKeyLength != 32))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    pDataParams->bRounds = bKeyWords + 6;
+
+    for (bIndex = 0; bIndex < bKeyWords; bIndex++)
+    {
+        phCryptoSym_Sw_Aes_Store32(&pDataParams->pKeySchedule[bIndex << 2], phCryptoSym_Sw_Aes_Load32(&pKey[bIndex << 2]));
+    }
+
+    for (; bIndex < ((pDataParams->bRounds + 1) << 2); bIndex++)
+    {
+        dwTmp = phCryptoSym_Sw_Aes_Load32(&pDataParams->pKeySchedule[(bIndex - 1) << 2]);
+        if ((bIndex % bKeyWords) == 0)
+        {
+            dwTmp = phCryptoSym_Sw_Aes_SubWord(PH_CRYPTOSYM_SW_AES_ROTR32(dwTmp, 8)) ^ bRcon;
+            bRcon = (uint8_t)((bRcon << 1) ^ ((bRcon >> 7) * 0x1BU));
+        }
+        else if ((bKeyWords > 6) && ((bIndex % bKeyWords) == 4))
+        {
+            dwTmp = phCryptoSym_Sw_Aes_SubWord(dwTmp);
+        }
+        else
+        {
+            /* word is used as is */
+        }
+        dwTmp ^= phCryptoSym_Sw_Aes_Load32(&pDataParams->pKeySchedule[(bIndex - bKeyWords) << 2]);
+        phCryptoSym_Sw_Aes_Store32(&pDataParams->pKeySchedule[bIndex << 2], dwTmp);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+void phCryptoSym_Sw_Aes_EncryptBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock
+    )
+{
+    uint32_t PH_MEMLOC_REM aState[4];
+    uint32_t PH_MEMLOC_REM aTmp[4];
+    uint8_t  PH_MEMLOC_REM bRound;
+    uint8_t  PH_MEMLOC_REM bColumn;
+
+#if defined(PH_CRYPTOSYM_SW_AES_NI) || defined(PH_CRYPTOSYM_SW_AES_ARMV8)
+    if (pDataParams->bHwAcceleration == PH_ON)
+    {
+        phCryptoSym_Sw_Aes_EncryptBlockHw(pDataParams->pKeySchedule, pDataParams->bRounds, pBlock);
+        return;
+    }
+#endif
+
+    for (bColumn = 0; bColumn < 4; bColumn++)
+    {
+        aState[bColumn] = phCryptoSym_Sw_Aes_Load32(&pBlock[bColumn << 2]) ^
+            phCryptoSym_Sw_Aes_Load32(&pDataParams->pKeySchedule[bColumn << 2]);
+    }
+
+    for (bRound = 1; bRound <= pDataParams->bRounds; bRound++)
+    {
+        for (bColumn = 0; bColumn < 4; bColumn++)
+        {
+            aState[bColumn] = phCryptoSym_Sw_Aes_SubWord(aState[bColumn]);
+        }
+        for (bColumn = 0; bColumn < 4; bColumn++)
+        {
+            /* ShiftRows: row r of this column comes from column + r */
+            aTmp[bColumn] = (aState[bColumn] & 0x000000FFU) | (aState[(bColumn + 1) & 3] & 0x0000FF00U) |
+                (aState[(bColumn + 2) & 3] & 0x00FF0000U) | (aState[(bColumn + 3) & 3] & 0xFF000000U);
+            if (bRound != pDataParams->bRounds)
+            {
+                aTmp[bColumn] = phCryptoSym_Sw_Aes_MixColumn(aTmp[bColumn]);
+            }
+        }
+        for (bColumn = 0; bColumn < 4; bColumn++)
+        {
+            aState[bColumn] = aTmp[bColumn] ^
+                phCryptoSym_Sw_Aes_Load32(&pDataParams->pKeySchedule[(bRound << 4) + (bColumn << 2)]);
+        }
+    }
+
+    for (bColumn = 0; bColumn < 4; bColumn++)
+    {
+        phCryptoSym_Sw_Aes_Store32(&pBlock[bColumn << 2], aState[bColumn]);
+    }
+}
+
+void phCryptoSym_Sw_Aes_DecryptBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock
+    )
+{
+    uint32_t PH_MEMLOC_REM aState[4];
+    uint32_t PH_MEMLOC_REM aTmp[4];
+    uint8_t  PH_MEMLOC_REM bRound;
+    uint8_t  PH_MEMLOC_REM bColumn;
+
+#if defined(PH_CRYPTOSYM_SW_AES_NI) || defined(PH_CRYPTOSYM_SW_AES_ARMV8)
+    if (pDataParams->bHwAcceleration == PH_ON)
+    {
+        phCryptoSym_Sw_Aes_DecryptBlockHw(pDataParams->pKeySchedule, pDataParams->bRounds, pBlock);
+        return;
+    }
+#endif
+
+    for (bColumn = 0; bColumn < 4; bColumn++)
+    {
+        aState[bColumn] = phCryptoSym_Sw_Aes_Load32(&pBlock[bColumn << 2]) ^
+            phCryptoSym_Sw_Aes_Load32(&pDataParams->pKeySchedule[(pDataParams->bRounds << 4) + (bColumn << 2)]);
+    }
+
+    for (bRound = pDataParams->bRounds; bRound > 0; bRound--)
+    {
+        for (bColumn = 0; bColumn < 4; bColumn++)
+        {
+            /* InvShiftRows: row r of this column comes from column - r */
+            aTmp[bColumn] = (aState[bColumn] & 0x000000FFU) | (aState[(bColumn + 3) & 3] & 0x0000FF00U) |
+                (aState[(bColumn + 2) & 3] & 0x00FF0000U) | (aState[(bColumn + 1) & 3] & 0xFF000000U);
+        }
+        for (bColumn = 0; bColumn < 4; bColumn++)
+        {
+            aState[bColumn] = phCryptoSym_Sw_Aes_InvSubWord(aTmp[bColumn]) ^
+                phCryptoSym_Sw_Aes_Load32(&pDataParams->pKeySchedule[((bRound - 1) << 4) + (bColumn << 2)]);
+            if (bRound != 1)
+            {
+                aState[bColumn] = phCryptoSym_Sw_Aes_InvMixColumn(aState[bColumn]);
+            }
+        }
+    }
+
+    for (bColumn = 0; bColumn < 4; bColumn++)
+    {
+        phCryptoSym_Sw_Aes_Store32(&pBlock[bColumn << 2], aState[bColumn]);
+    }
+}
+
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
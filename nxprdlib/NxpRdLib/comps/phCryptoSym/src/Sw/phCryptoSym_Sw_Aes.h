@@ -0,0 +1,56 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software AES block cipher of the Symmetric Cryptography Component.
+*
+*/
+
+#ifndef PHCRYPTOSYM_SW_AES_H
+#define PHCRYPTOSYM_SW_AES_H
+
+#include <ph_Status.h>
+#include <phCryptoSym.h>
+
+/**
+* Expand a 16, 24 or 32 byte key into the key schedule of pDataParams.
+*/
+phStatus_t phCryptoSym_Sw_Aes_KeyExpansion(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    const uint8_t * pKey,
+    uint8_t bKeyLength
+    );
+
+/**
+* Encrypt one 16 byte block in place.
+*/
+void phCryptoSym_Sw_Aes_EncryptBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock
+    );
+
+/**
+* Decrypt one 16 byte block in place.
+*/
+void phCryptoSym_Sw_Aes_DecryptBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock
+    );
+
+/**
+* Returns #PH_ON if the CPU provides AES instructions usable by this build.
+*/
+uint8_t phCryptoSym_Sw_Aes_HwAvailable(void);
+
+#endif /* PHCRYPTOSYM_SW_AES_H */
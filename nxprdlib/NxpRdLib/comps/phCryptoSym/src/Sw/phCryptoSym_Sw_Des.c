@@ -0,0 +1,316 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software DES and triple DES block cipher of the Symmetric Cryptography Component.
+*
+* Permutations only use public table positions. The S-boxes are read by scanning all 64 entries
+* with a mask, so no memory access depends on key or data.
+*/
+
+#include <ph_Status.h>
+#include <ph_RefDefs.h>
+#include <phCryptoSym.h>
+
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+
+#include "phCryptoSym_Sw_Des.h"
+
+/* Bit positions are numbered from 1 at the most significant bit, as in FIPS 46-3. */
+static const uint8_t PH_MEMLOC_CONST_ROM aDesIp[64] =
+{
+    58, 50, 42, 34, 26, 18, 10, 2, 60, 52, 44, 36, 28, 20, 12, 4,
+    62, 54, 46, 38, 30, 22, 14, 6, 64, 56, 48, 40, 32, 24, 16, 8,
+    57, 49, 41, 33, 25, 17,  9, 1, 59, 51, 43, 35, 27, 19, 11, 3,
+    61, 53, 45, 37, 29, 21, 13, 5, 63, 55, 47, 39, 31, 23, 15, 7
+};
+
+static const uint8_t PH_MEMLOC_CONST_ROM aDesP[32] =
+{
+    16,  7, 20, 21, 29, 12, 28, 17,  1, 15, 23, 26,  5, 18, 31, 10,
+     2,  8, 24, 14, 32, 27,  3,  9, 19, 13, 30,  6, 22, 11,  4, 25
+};
+
+static const uint8_t PH_MEMLOC_CONST_ROM aDesPc1[56] =
+{
+    57, 49, 41, 33, 25, 17,  9,  1, 58, 50, 42, 34, 26, 18,
+    10,  2, 59, 51, 43, 35, 27, 19, 11,  3, 60, 52, 44, 36,
+    63, 55, 47, 39, 31, 23, 15,  7, 62, 54, 46, 38, 30, 22,
+    14,  6, 61, 53, 45, 37, 29, 21, 13,  5, 28, 20, 12,  4
+};
+
+static const uint8_t PH_MEMLOC_CONST_ROM aDesPc2[48] =
+{
+    14, 17, 11, 24,  1,  5,  3, 28, 15,  6, 21, 10,
+    23, 19, 12,  4, 26,  8, 16,  7, 27, 20, 13,  2,
+    41, 52, 31, 37, 47, 55, 30, 40, 51, 45, 33, 48,
+    44, 49, 39, 56, 34, 53, 46, 42, 50, 36, 29, 32
+};
+
+static const uint8_t PH_MEMLOC_CONST_ROM aDesShifts[16] =
+{
+    1, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1
+};
+
+/* S-boxes, row (outer bits) major. */
+static const uint8_t PH_MEMLOC_CONST_ROM aDesSbox[8][64] =
+{
+    {
+        14,  4, 13,  1,  2, 15, 11,  8,  3, 10,  6, 12,  5,  9,  0,  7,
+         0, 15,  7,  4, 14,  2, 13,  1, 10,  6, 12, 11,  9,  5,  3,  8,
+         4,  1, 14,  8, 13,  6,  2, 11, 15, 12,  9,  7,  3, 10,  5,  0,
+        15, 12,  8,  2,  4,  9,  1,  7,  5, 11,  3, 14, 10,  0,  6, 13
+    },
+    {
+        15,  1,  8, 14,  6, 11,  3,  4,  9,  7,  2, 13, 12,  0,  5, 10,
+         3, 13,  4,  7, 15,  2,  8, 14, 12,  0,  1, 10,  6,  9, 11,  5,
+         0, 14,  7, 11, 10,  4, 13,  1,  5,  8, 12,  6,  9,  3,  2, 15,
+        13,  8, 10,  1,  3, 15,  4,  2, 11,  6,  7, 12,  0,  5, 14,  9
+    },
+    {
+        10,  0,  9, 14,  6,  3, 15,  5,  1, 13, 12,  7, 11,  4,  2,  8,
+        13,  7,  0,  9,  3,  4,  6, 10,  2,  8,  5, 14, 12, 11, 15,  1,
+        13,  6,  4,  9,  8, 15,  3,  0, 11,  1,  2, 12,  5, 10, 14,  7,
+         1, 10, 13,  0,  6,  9,  8,  7,  4, 15, 14,  3, 11,  5,  2, 12
+    },
+    {
+         7, 13, 14,  3,  0,  6,  9, 10,  1,  2,  8,  5, 11, 12,  4, 15,
+        13,  8, 11,  5,  6, 15,  0,  3,  4,  7,  2, 12,  1, 10, 14,  9,
+        10,  6,  9,  0, 12, 11,  7, 13, 15,  1,  3, 14,  5,  2,  8,  4,
+         3, 15,  0,  6, 10,  1, 13,  8,  9,  4,  5, 11, 12,  7,  2, 14
+    },
+    {
+         2, 12,  4,  1,  7, 10, 11,  6,  8,  5,  3, 15, 13,  0, 14,  9,
+        14, 11,  2, 12,  4,  7, 13,  1,  5,  0, 15, 10,  3,  9,  8,  6,
+         4,  2,  1, 11, 10, 13,  7,  8, 15,  9, 12,  5,  6,  3,  0, 14,
+        11,  8, 12,  7,  1, 14,  2, 13,  6, 15,  0,  9, 10,  4,  5,  3
+    },
+    {
+        12,  1, 10, 15,  9,  2,  6,  8,  0, 13,  3,  4, 14,  7,  5, 11,
+        10, 15,  4,  2,  7, 12,  9,  5,  6,  1, 13, 14,  0, 11,  3,  8,
+         9, 14, 15,  5,  2,  8, 12,  3,  7,  0,  4, 10,  1, 13, 11,  6,
+         4,  3,  2, 12,  9,  5, 15, 10, 11, 14,  1,  7,  6,  0,  8, 13
+    },
+    {
+         4, 11,  2, 14, 15,  0,  8, 13,  3, 12,  9,  7,  5, 10,  6,  1,
+        13,  0, 11,  7,  4,  9,  1, 10, 14,  3,  5, 12,  2, 15,  8,  6,
+         1,  4, 11, 13, 12,  3,  7, 14, 10, 15,  6,  8,  0,  5,  9,  2,
+         6, 11, 13,  8,  1,  4, 10,  7,  9,  5,  0, 15, 14,  2,  3, 12
+    },
+    {
+        13,  2,  8,  4,  6, 15, 11,  1, 10,  9,  3, 14,  5,  0, 12,  7,
+         1, 15, 13,  8, 10,  3,  7,  4, 12,  5,  6, 11,  0, 14,  9,  2,
+         7, 11,  4,  1,  9, 12, 14,  2,  0,  6, 10, 13, 15,  3,  5,  8,
+         2,  1, 14,  7,  4, 10,  8, 13, 15, 12,  9,  0,  3,  5,  6, 11
+    }
+};
+
+/* Bit p (1 = MSB) of the 64 bit value dwHigh:dwLow. */
+static uint32_t phCryptoSym_Sw_Des_GetBit(uint32_t dwHigh, uint32_t dwLow, uint8_t bPos)
+{
+    return (bPos <= 32) ? ((dwHigh >> (32 - bPos)) & 1U) : ((dwLow >> (64 - bPos)) & 1U);
+}
+
+static uint8_t phCryptoSym_Sw_Des_Sbox(uint8_t bBox, uint8_t bInput)
+{
+    uint8_t  PH_MEMLOC_REM bIndex = (uint8_t)((bInput & 0x20U) | ((bInput & 0x01U) << 4) | ((bInput >> 1) & 0x0FU));
+    uint8_t  PH_MEMLOC_REM bResult = 0;
+    uint8_t  PH_MEMLOC_REM bEntry;
+    uint32_t PH_MEMLOC_REM dwMask;
+
+    for (bEntry = 0; bEntry < 64; bEntry++)
+    {
+        /* all ones only for the wanted entry */
+        dwMask = ((uint32_t)(bEntry ^ bIndex) - 1U) >> 8;
+        bResult |= (uint8_t)(aDesSbox[bBox][bEntry] & dwMask);
+    }
+    return bResult;
+}
+
+static uint32_t phCryptoSym_Sw_Des_F(uint32_t dwRight, const uint8_t * pSubKey)
+{
+    uint32_t PH_MEMLOC_REM dwSboxOut = 0;
+    uint32_t PH_MEMLOC_REM dwResult = 0;
+    uint8_t  PH_MEMLOC_REM bGroup;
+    uint8_t  PH_MEMLOC_REM bShift;
+    uint8_t  PH_MEMLOC_REM bIndex;
+
+    for (bGroup = 0; bGroup < 8; bGroup++)
+    {
+        /* Expansion E: group j takes bits 4j .. 4j + 5 (1 = MSB, wrapping around) */
+        bShift = (bGroup == 0) ? 31U : (uint8_t)((bGroup << 2) - 1U);
+        bIndex = (uint8_t)((((dwRight << bShift) | (dwRight >> (32 - bShift))) >> 26) & 0x3FU);
+        dwSboxOut |= (uint32_t)phCryptoSym_Sw_Des_Sbox(bGroup, bIndex ^ pSubKey[bGroup]) << (28 - (bGroup << 2));
+    }
+
+    for (bIndex = 0; bIndex < 32; bIndex++)
+    {
+        dwResult |= ((dwSboxOut >> (32 - aDesP[bIndex])) & 1U) << (31 - bIndex);
+    }
+    return dwResult;
+}
+
+static void phCryptoSym_Sw_Des_KeySchedule(const uint8_t * pKey, uint8_t * pSubKeys)
+{
+    uint32_t PH_MEMLOC_REM dwHigh;
+    uint32_t PH_MEMLOC_REM dwLow;
+    uint32_t PH_MEMLOC_REM dwC = 0;
+    uint32_t PH_MEMLOC_REM dwD = 0;
+    uint8_t  PH_MEMLOC_REM bRound;
+    uint8_t  PH_MEMLOC_REM bIndex;
+    uint8_t  PH_MEMLOC_REM bPos;
+
+    dwHigh = ((uint32_t)pKey[0] << 24) | ((uint32_t)pKey[1] << 16) | ((uint32_t)pKey[2] << 8) | pKey[3];
+    dwLow = ((uint32_t)pKey[4] << 24) | ((uint32_t)pKey[5] << 16) | ((uint32_t)pKey[6] << 8) | pKey[7];
+
+    /* PC1, parity bits are dropped */
+    for (bIndex = 0; bIndex < 28; bIndex++)
+    {
+        dwC |= phCryptoSym_Sw_Des_GetBit(dwHigh, dwLow, aDesPc1[bIndex]) << (27 - bIndex);
+        dwD |= phCryptoSym_Sw_Des_GetBit(dwHigh, dwLow, aDesPc1[bIndex + 28]) << (27 - bIndex);
+    }
+
+    for (bRound = 0; bRound < 16; bRound++)
+    {
+        dwC = ((dwC << aDesShifts[bRound]) | (dwC >> (28 - aDesShifts[bRound]))) & 0x0FFFFFFFU;
+        dwD = ((dwD << aDesShifts[bRound]) | (dwD >> (28 - aDesShifts[bRound]))) & 0x0FFFFFFFU;
+
+        /* PC2 into 8 groups of 6 bits */
+        for (bIndex = 0; bIndex < 48; bIndex++)
+        {
+            if ((bIndex % 6) == 0)
+            {
+                pSubKeys[(bRound << 3) + (bIndex / 6)] = 0;
+            }
+            bPos = aDesPc2[bIndex];
+            pSubKeys[(bRound << 3) + (bIndex / 6)] |= (uint8_t)(((bPos <= 28) ?
+                ((dwC >> (28 - bPos)) & 1U) : ((dwD >> (56 - bPos)) & 1U)) << (5 - (bIndex % 6)));
+        }
+    }
+}
+
+static void phCryptoSym_Sw_Des_Crypt(const uint8_t * pSubKeys, uint8_t bDecrypt, uint8_t * pBlock)
+{
+    uint32_t PH_MEMLOC_REM dwHigh;
+    uint32_t PH_MEMLOC_REM dwLow;
+    uint32_t PH_MEMLOC_REM dwLeft = 0;
+    uint32_t PH_MEMLOC_REM dwRight = 0;
+    uint32_t PH_MEMLOC_REM dwTmp;
+    uint8_t  PH_MEMLOC_REM bRound;
+    uint8_t  PH_MEMLOC_REM bIndex;
+
+    dwHigh = ((uint32_t)pBlock[0] << 24) | ((uint32_t)pBlock[1] << 16) | ((uint32_t)pBlock[2] << 8) | pBlock[3];
+    dwLow = ((uint32_t)pBlock[4] << 24) | ((uint32_t)pBlock[5] << 16) | ((uint32_t)pBlock[6] << 8) | pBlock[7];
+
+    /* IP */
+    for (bIndex = 0; bIndex < 32; bIndex++)
+    {
+        dwLeft |= phCryptoSym_Sw_Des_GetBit(dwHigh, dwLow, aDesIp[bIndex]) << (31 - bIndex);
+        dwRight |= phCryptoSym_Sw_Des_GetBit(dwHigh, dwLow, aDesIp[bIndex + 32]) << (31 - bIndex);
+    }
+
+    for (bRound = 0; bRound < 16; bRound++)
+    {
+        dwTmp = dwRight;
+        dwRight = dwLeft ^ phCryptoSym_Sw_Des_F(dwRight, &pSubKeys[(bDecrypt ? (15 - bRound) : bRound) << 3]);
+        dwLeft = dwTmp;
+    }
+
+    /* IP^-1 on R16:L16, bit i of the input goes to position IP[i] */
+    dwHigh = 0;
+    dwLow = 0;
+    for (bIndex = 0; bIndex < 64; bIndex++)
+    {
+        dwTmp = (bIndex < 32) ? ((dwRight >> (31 - bIndex)) & 1U) : ((dwLeft >> (63 - bIndex)) & 1U);
+        if (aDesIp[bIndex] <= 32)
+        {
+            dwHigh |= dwTmp << (32 - aDesIp[bIndex]);
+        }
+        else
+        {
+            dwLow |= dwTmp << (64 - aDesIp[bIndex]);
+        }
+    }
+
+    for (bIndex = 0; bIndex < 4; bIndex++)
+    {
+        pBlock[bIndex] = (uint8_t)(dwHigh >> (24 - (bIndex << 3)));
+        pBlock[bIndex + 4] = (uint8_t)(dwLow >> (24 - (bIndex << 3)));
+    }
+}
+
+phStatus_t phCryptoSym_Sw_Des_KeyExpansion(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    const uint8_t * pKey,
+    uint16_t wKeyType
+    )
+{
+    uint8_t PH_MEMLOC_REM bNumKeys;
+    uint8_t PH_MEMLOC_REM bIndex;
+
+    switch (wKeyType)
+    {
+    case PH_CRYPTOSYM_KEY_TYPE_DES:
+        bNumKeys = 1;
+        break;
+    case PH_CRYPTOSYM_KEY_TYPE_2K3DES:
+        bNumKeys = 2;
+        break;
+    case PH_CRYPTOSYM_KEY_TYPE_3K3DES:
+        bNumKeys = 3;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    for (bIndex = 0; bIndex < bNumKeys; bIndex++)
+    {
+        phCryptoSym_Sw_Des_KeySchedule(&pKey[bIndex << 3], &pDataParams->pKeySchedule[bIndex * PH_CRYPTOSYM_SW_DES_SUBKEYS_SIZE]);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+void phCryptoSym_Sw_Des_EncryptBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock
+    )
+{
+    /* 2K3DES uses K1 for the third stage */
+    uint8_t PH_MEMLOC_REM bThird = (pDataParams->wKeyType == PH_CRYPTOSYM_KEY_TYPE_3K3DES) ? 2U : 0U;
+
+    phCryptoSym_Sw_Des_Crypt(pDataParams->pKeySchedule, PH_OFF, pBlock);
+    if (pDataParams->wKeyType != PH_CRYPTOSYM_KEY_TYPE_DES)
+    {
+        phCryptoSym_Sw_Des_Crypt(&pDataParams->pKeySchedule[PH_CRYPTOSYM_SW_DES_SUBKEYS_SIZE], PH_ON, pBlock);
+        phCryptoSym_Sw_Des_Crypt(&pDataParams->pKeySchedule[bThird * PH_CRYPTOSYM_SW_DES_SUBKEYS_SIZE], PH_OFF, pBlock);
+    }
+}
+
+void phCryptoSym_Sw_Des_DecryptBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock
+    )
+{
+    uint8_t PH_MEMLOC_REM bThird = (pDataParams->wKeyType == PH_CRYPTOSYM_KEY_TYPE_3K3DES) ? 2U : 0U;
+
+    if (pDataParams->wKeyType != PH_CRYPTOSYM_KEY_TYPE_DES)
+    {
+        phCryptoSym_Sw_Des_Crypt(&pDataParams->pKeySchedule[bThird * PH_CRYPTOSYM_SW_DES_SUBKEYS_SIZE], PH_ON, pBlock);
+        phCryptoSym_Sw_Des_Crypt(&pDataParams->pKeySchedule[PH_CRYPTOSYM_SW_DES_SUBKEYS_SIZE], PH_OFF, pBlock);
+    }
+    phCryptoSym_Sw_Des_Crypt(pDataParams->pKeySchedule, PH_ON, pBlock);
+}
+
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
@@ -0,0 +1,53 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software DES and triple DES block cipher of the Symmetric Cryptography Component.
+*
+*/
+
+#ifndef PHCRYPTOSYM_SW_DES_H
+#define PHCRYPTOSYM_SW_DES_H
+
+#include <ph_Status.h>
+#include <phCryptoSym.h>
+
+#define PH_CRYPTOSYM_SW_DES_SUBKEYS_SIZE    128U    /**< Size of the sub keys of one DES key, 16 rounds x 8 groups. */
+
+/**
+* Derive the sub keys of a DES, 2K3DES or 3K3DES key into the key schedule of pDataParams.
+*/
+phStatus_t phCryptoSym_Sw_Des_KeyExpansion(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    const uint8_t * pKey,
+    uint16_t wKeyType
+    );
+
+/**
+* Encrypt one 8 byte block in place, EDE for triple DES.
+*/
+void phCryptoSym_Sw_Des_EncryptBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock
+    );
+
+/**
+* Decrypt one 8 byte block in place, DED for triple DES.
+*/
+void phCryptoSym_Sw_Des_DecryptBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock
+    );
+
+#endif /* PHCRYPTOSYM_SW_DES_H */
@@ -106,6 +106,41 @@ phTools_Q_t *phTools_Q_Receive(uint32_t dwBlockTime)
     return phTools_Q_PopInt(&gpphTools_Q_Msgs, gphTools_Q_MsgMutex, dwBlockTime, PH_ON);
 }
 
+phTools_Q_t *phTools_Q_Peek(void)
+{
+    phTools_Q_t *psMsgQueue;
+
+    /* Do not wait on a producer that is still queuing fragments. */
+    if(phOsal_Mutex_Take(gphTools_Q_MsgMutex, 0))
+    {
+        return NULL;
+    }
+    psMsgQueue = gpphTools_Q_Msgs;
+    (void)phOsal_Mutex_Give(gphTools_Q_MsgMutex);
+
+    return psMsgQueue;
+}
+
+phTools_Q_t *phTools_Q_ReceiveIf(phTools_Q_t *psMsgQueue)
+{
+    phTools_Q_t *psHead = NULL;
+
+    if(phOsal_Mutex_Take(gphTools_Q_MsgMutex, 0))
+    {
+        return NULL;
+    }
+
+    /* Dequeue only if the head is still the expected message and its semaphore count is available. */
+    if((psMsgQueue != NULL) && (gpphTools_Q_Msgs == psMsgQueue) && (!phOsal_Semaphore_Take(gphTools_Q_MsgSema, 0)))
+    {
+        psHead = gpphTools_Q_Msgs;
+        gpphTools_Q_Msgs = psHead->pNext;
+    }
+    (void)phOsal_Mutex_Give(gphTools_Q_MsgMutex);
+
+    return psHead;
+}
+
 phTools_Q_t *phTools_Q_Get(uint32_t dwBlockTime, uint8_t bPriority)
 {
     phTools_Q_t *pEmptyMsg = phTools_Q_PopInt(&gpphTools_Q_PoolHead, gphTools_Q_Mutex, dwBlockTime, bPriority);
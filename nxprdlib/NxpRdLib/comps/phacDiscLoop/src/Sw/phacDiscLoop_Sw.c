@@ -48,6 +48,8 @@ phStatus_t phacDiscLoop_Sw_Init(
                                 void * pHalDataParams
                                 )
 {
+    uint8_t PH_MEMLOC_COUNT bTechIndex;
+
     if (sizeof(phacDiscLoop_Sw_DataParams_t) != wSizeOfDataParams)
     {
         return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AC_DISCLOOP);
@@ -75,6 +77,9 @@ phStatus_t phacDiscLoop_Sw_Init(
 
     /* Default listen and poll mode technologies */
     pDataParams->bPollState               = PHAC_DISCLOOP_POLL_STATE_DETECTION;
+    pDataParams->bPasPollBailOut          = 0x00;
+    pDataParams->bPasPollResumeCfg        = 0x00;
+    pDataParams->bPasPollResumeTechs      = 0x00;
 
 #ifdef NXPBUILD__PHHAL_HW_RC523
     /* Poll for Type A, Type B, Type F212 and F424 */
@@ -103,6 +108,7 @@ phStatus_t phacDiscLoop_Sw_Init(
 
     pDataParams->bNumOfCards              = 0x00;
     pDataParams->bDetectedTechs           = 0x00;
+    pDataParams->bPolledTechs             = 0x00;
     pDataParams->bCollPend                = 0x00;
 
     /* Poll device limits */
@@ -124,6 +130,29 @@ phStatus_t phacDiscLoop_Sw_Init(
     pDataParams->waPasPollGTimeUs[PHAC_DISCLOOP_TECH_TYPE_F424]      = PHAC_DISCLOOP_B_TO_F_DEFAULT_GT;
     pDataParams->wActPollGTimeUs                                     = PHAC_DISCLOOP_TYPEA_DEFAULT_GT;
 
+    /* Poll all technologies in every cycle */
+    for (bTechIndex = 0; bTechIndex < PHAC_DISCLOOP_PASS_POLL_MAX_TECHS_SUPPORTED; bTechIndex++)
+    {
+        pDataParams->baPasPollPeriod[bTechIndex]    = PHAC_DISCLOOP_DEFAULT_POLL_PERIOD;
+        pDataParams->baPasPollCurPeriod[bTechIndex] = PHAC_DISCLOOP_DEFAULT_POLL_PERIOD;
+        pDataParams->baPasPollCountDown[bTechIndex] = 0x00;
+    }
+    pDataParams->bPasPollAdaptive                                    = PH_OFF;
+    pDataParams->pFilterTable                                        = NULL;
+    pDataParams->bNumFilterEntries                                   = 0;
+    pDataParams->bFilterHalt                                         = PH_OFF;
+    pDataParams->bI3P4AutoDataRate                                   = PH_OFF;
+    pDataParams->bI3P4DataRateErrLimit                               = PHAC_DISCLOOP_I3P4_DEFAULT_DATARATE_ERR_LIMIT;
+    pDataParams->baI3P4MaxDataRate[0]                                = PHAC_DISCLOOP_SW_I3P4_MAX_DRI;
+    pDataParams->baI3P4MaxDataRate[1]                                = PHAC_DISCLOOP_SW_I3P4_MAX_DRI;
+    pDataParams->bI3P4DataRateTech                                   = 0xFF;
+    pDataParams->baI3P4NegDri[0]                                     = 0x00;
+    pDataParams->baI3P4NegDri[1]                                     = 0x00;
+    pDataParams->baI3P4NegDsi[0]                                     = 0x00;
+    pDataParams->baI3P4NegDsi[1]                                     = 0x00;
+    pDataParams->bP2PAutoNegotiate                                   = PH_OFF;
+    pDataParams->bP2PMaxDataRate                                     = PHAC_DISCLOOP_SW_P2P_MAX_DATARATE;
+
 #ifdef NXPBUILD__PHAC_DISCLOOP_TYPEA_TAGS
     pDataParams->sTypeATargetInfo.bTotalTagsFound        = 0;
 
@@ -201,6 +230,8 @@ phStatus_t phacDiscLoop_Sw_Run(
     {
     case PHAC_DISCLOOP_ENTRY_POINT_POLL:
 
+        pDataParams->bPolledTechs = 0x00;
+
         /* Perform LPCD if Enabled. */
         if ((pDataParams->bLpcdEnabled)
             && (pDataParams->bPollState == PHAC_DISCLOOP_POLL_STATE_DETECTION))
@@ -295,6 +326,7 @@ phStatus_t phacDiscLoop_Sw_SetConfig(
                                      )
 {
     phStatus_t  PH_MEMLOC_REM status = PH_ERR_SUCCESS;
+    uint8_t     PH_MEMLOC_COUNT bTechIndex;
 
     switch(wConfig)
     {
@@ -328,6 +360,7 @@ phStatus_t phacDiscLoop_Sw_SetConfig(
 
     case PHAC_DISCLOOP_CONFIG_PAS_POLL_TECH_CFG:
         pDataParams->bPasPollTechCfg = (uint8_t)wValue;
+        pDataParams->bPasPollResumeTechs = 0x00;
         break;
 
     case PHAC_DISCLOOP_CONFIG_ANTI_COLL:
@@ -482,6 +515,105 @@ phStatus_t phacDiscLoop_Sw_SetConfig(
         pDataParams->bLpcdEnabled = (uint8_t)wValue;
         break;
 
+    case PHAC_DISCLOOP_CONFIG_TYPEA_POLL_PERIOD:
+    case PHAC_DISCLOOP_CONFIG_TYPEB_POLL_PERIOD:
+    case PHAC_DISCLOOP_CONFIG_TYPEF212_POLL_PERIOD:
+    case PHAC_DISCLOOP_CONFIG_TYPEF424_POLL_PERIOD:
+    case PHAC_DISCLOOP_CONFIG_TYPEV_POLL_PERIOD:
+    case PHAC_DISCLOOP_CONFIG_18000P3M3_POLL_PERIOD:
+        if ((wValue == 0) || (wValue > 255))
+        {
+            return PH_ADD_COMPCODE(
+                PH_ERR_INVALID_PARAMETER,
+                PH_COMP_AC_DISCLOOP);
+        }
+        bTechIndex = (uint8_t)(wConfig - PHAC_DISCLOOP_CONFIG_TYPEA_POLL_PERIOD);
+        pDataParams->baPasPollPeriod[bTechIndex]    = (uint8_t)wValue;
+        pDataParams->baPasPollCurPeriod[bTechIndex] = (uint8_t)wValue;
+        /* Poll the technology in next cycle with the new period */
+        pDataParams->baPasPollCountDown[bTechIndex] = 0x00;
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_POLL_ADAPTIVE:
+        if (wValue == 0)
+        {
+            pDataParams->bPasPollAdaptive = PH_OFF;
+        }
+        else
+        {
+            pDataParams->bPasPollAdaptive = PH_ON;
+        }
+
+        /* Restart all technologies from their configured period */
+        for (bTechIndex = 0; bTechIndex < PHAC_DISCLOOP_PASS_POLL_MAX_TECHS_SUPPORTED; bTechIndex++)
+        {
+            pDataParams->baPasPollCurPeriod[bTechIndex] = pDataParams->baPasPollPeriod[bTechIndex];
+            pDataParams->baPasPollCountDown[bTechIndex] = 0x00;
+        }
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_BAIL_OUT_RESUME:
+        if (wValue & ~(PHAC_DISCLOOP_POS_BIT_MASK_A |  PHAC_DISCLOOP_POS_BIT_MASK_B
+            | PHAC_DISCLOOP_POS_BIT_MASK_F424 | PHAC_DISCLOOP_POS_BIT_MASK_F212
+            | PHAC_DISCLOOP_POS_BIT_MASK_V))
+        {
+            /* Invalid bail out option set */
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AC_DISCLOOP);
+        }
+
+        pDataParams->bPasPollResumeCfg = (uint8_t)wValue;
+        pDataParams->bPasPollResumeTechs = 0x00;
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_FILTER_HALT:
+        if (wValue == 0)
+        {
+            pDataParams->bFilterHalt = PH_OFF;
+        }
+        else
+        {
+            pDataParams->bFilterHalt = PH_ON;
+        }
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_I3P4_AUTO_DATARATE:
+        if (wValue == 0)
+        {
+            pDataParams->bI3P4AutoDataRate = PH_OFF;
+        }
+        else
+        {
+            pDataParams->bI3P4AutoDataRate = PH_ON;
+        }
+
+        /* Allow the highest data rate again */
+        pDataParams->baI3P4MaxDataRate[0] = PHAC_DISCLOOP_SW_I3P4_MAX_DRI;
+        pDataParams->baI3P4MaxDataRate[1] = PHAC_DISCLOOP_SW_I3P4_MAX_DRI;
+        pDataParams->bI3P4DataRateTech = 0xFF;
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_I3P4_DATARATE_ERR_LIMIT:
+        if (wValue > 0xFF)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AC_DISCLOOP);
+        }
+        pDataParams->bI3P4DataRateErrLimit = (uint8_t)wValue;
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_P2P_AUTO_NEGOTIATE:
+        if (wValue == 0)
+        {
+            pDataParams->bP2PAutoNegotiate = PH_OFF;
+        }
+        else
+        {
+            pDataParams->bP2PAutoNegotiate = PH_ON;
+        }
+
+        /* Allow the highest data rate again */
+        pDataParams->bP2PMaxDataRate = PHAC_DISCLOOP_SW_P2P_MAX_DATARATE;
+        break;
+
 #ifdef NXPBUILD__PHAC_DISCLOOP_TYPEA_TAGS
     case PHAC_DISCLOOP_CONFIG_TYPEA_DEVICE_LIMIT:
         if((! (pDataParams->bPasPollTechCfg & PHAC_DISCLOOP_POS_BIT_MASK_A)) ||
@@ -496,7 +628,9 @@ phStatus_t phacDiscLoop_Sw_SetConfig(
 
 #ifdef NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P4_TAGS
     case PHAC_DISCLOOP_CONFIG_TYPEA_I3P4_FSDI:
-            if (wValue > 8)
+            /* Extended frame sizes are only allowed in ISO mode */
+            if ((wValue > PHPAL_I14443P4_FRAMESIZE_MAX) ||
+                ((pDataParams->bOpeMode != RD_LIB_MODE_ISO) && (wValue > PHPAL_I14443P4_EMVCO_FRAMESIZE_MAX)))
             {
                 return PH_ADD_COMPCODE(
                     PH_ERR_INVALID_PARAMETER,
@@ -618,7 +752,9 @@ phStatus_t phacDiscLoop_Sw_SetConfig(
       break;
 
     case PHAC_DISCLOOP_CONFIG_TYPEB_FSDI:
-      if (wValue > 0xff)
+      /* Extended frame sizes are only allowed in ISO mode */
+      if ((wValue > PHPAL_I14443P4_FRAMESIZE_MAX) ||
+          ((pDataParams->bOpeMode != RD_LIB_MODE_ISO) && (wValue > PHPAL_I14443P4_EMVCO_FRAMESIZE_MAX)))
       {
           return PH_ADD_COMPCODE(
               PH_ERR_INVALID_PARAMETER,
@@ -877,6 +1013,43 @@ phStatus_t phacDiscLoop_Sw_GetConfig(
         *pValue = pDataParams->wActPollGTimeUs;
         break;
 
+    case PHAC_DISCLOOP_CONFIG_TYPEA_POLL_PERIOD:
+    case PHAC_DISCLOOP_CONFIG_TYPEB_POLL_PERIOD:
+    case PHAC_DISCLOOP_CONFIG_TYPEF212_POLL_PERIOD:
+    case PHAC_DISCLOOP_CONFIG_TYPEF424_POLL_PERIOD:
+    case PHAC_DISCLOOP_CONFIG_TYPEV_POLL_PERIOD:
+    case PHAC_DISCLOOP_CONFIG_18000P3M3_POLL_PERIOD:
+        *pValue = pDataParams->baPasPollPeriod[wConfig - PHAC_DISCLOOP_CONFIG_TYPEA_POLL_PERIOD];
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_POLL_ADAPTIVE:
+        *pValue = pDataParams->bPasPollAdaptive;
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_FILTER_HALT:
+        *pValue = pDataParams->bFilterHalt;
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_BAIL_OUT_RESUME:
+        *pValue = pDataParams->bPasPollResumeCfg;
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_I3P4_AUTO_DATARATE:
+        *pValue = pDataParams->bI3P4AutoDataRate;
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_I3P4_DATARATE_ERR_LIMIT:
+        *pValue = pDataParams->bI3P4DataRateErrLimit;
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_P2P_AUTO_NEGOTIATE:
+        *pValue = pDataParams->bP2PAutoNegotiate;
+        break;
+
+    case PHAC_DISCLOOP_CONFIG_POLLED_TECHS:
+        *pValue = pDataParams->bPolledTechs;
+        break;
+
 #ifdef NXPBUILD__PHAC_DISCLOOP_TYPEA_TAGS
     case PHAC_DISCLOOP_CONFIG_GTA_VALUE_US:
         *pValue = pDataParams->waPasPollGTimeUs[PHAC_DISCLOOP_TECH_TYPE_A];
@@ -900,11 +1073,25 @@ phStatus_t phacDiscLoop_Sw_GetConfig(
         break;
 
     case PHAC_DISCLOOP_CONFIG_TYPEA_I3P4_DSI:
-        *pValue = pDataParams->sTypeATargetInfo.sTypeA_I3P4.bDsi;
+        if ((pDataParams->bI3P4AutoDataRate == PH_ON) && (pDataParams->bOpeMode != RD_LIB_MODE_EMVCO))
+        {
+            *pValue = pDataParams->baI3P4NegDsi[0];
+        }
+        else
+        {
+            *pValue = pDataParams->sTypeATargetInfo.sTypeA_I3P4.bDsi;
+        }
         break;
 
     case PHAC_DISCLOOP_CONFIG_TYPEA_I3P4_DRI:
-        *pValue = pDataParams->sTypeATargetInfo.sTypeA_I3P4.bDri;
+        if ((pDataParams->bI3P4AutoDataRate == PH_ON) && (pDataParams->bOpeMode != RD_LIB_MODE_EMVCO))
+        {
+            *pValue = pDataParams->baI3P4NegDri[0];
+        }
+        else
+        {
+            *pValue = pDataParams->sTypeATargetInfo.sTypeA_I3P4.bDri;
+        }
         break;
 #endif /* NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P4_TAGS */
 
@@ -947,6 +1134,28 @@ phStatus_t phacDiscLoop_Sw_GetConfig(
      case PHAC_DISCLOOP_CONFIG_TYPEB_DEVICE_LIMIT:
         *pValue = pDataParams->baPasConDevLim[PHAC_DISCLOOP_TECH_TYPE_B];
         break;
+
+     case PHAC_DISCLOOP_CONFIG_TYPEB_DRI:
+        if ((pDataParams->bI3P4AutoDataRate == PH_ON) && (pDataParams->bOpeMode != RD_LIB_MODE_EMVCO))
+        {
+            *pValue = pDataParams->baI3P4NegDri[1];
+        }
+        else
+        {
+            *pValue = pDataParams->sTypeBTargetInfo.bDri;
+        }
+        break;
+
+     case PHAC_DISCLOOP_CONFIG_TYPEB_DSI:
+        if ((pDataParams->bI3P4AutoDataRate == PH_ON) && (pDataParams->bOpeMode != RD_LIB_MODE_EMVCO))
+        {
+            *pValue = pDataParams->baI3P4NegDsi[1];
+        }
+        else
+        {
+            *pValue = pDataParams->sTypeBTargetInfo.bDsi;
+        }
+        break;
  #endif /* NXPBUILD__PHAC_DISCLOOP_TYPEB_TAGS */
 
 #ifdef NXPBUILD__PHAC_DISCLOOP_TYPEF_TAGS
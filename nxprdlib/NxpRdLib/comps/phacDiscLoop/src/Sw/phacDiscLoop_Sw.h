@@ -33,6 +33,7 @@
 #define PHAC_DISCLOOP_SW_I3P4_MAX_CID                           14U    /**< Maximum permissible size of CID(Card IDentifier). */
 #define PHAC_DISCLOOP_SW_I3P4_MAX_DSI                            3U    /**< Maximum permissible size of DSI(Divisor Send Integer). */
 #define PHAC_DISCLOOP_SW_I3P4_MAX_DRI                            3U    /**< Maximum permissible size of DRI(Divisor Receive Integer). */
+#define PHAC_DISCLOOP_SW_P2P_MAX_DATARATE                        2U    /**< Highest NFC-DEP DSI/DRI (424 kbps) requested with PSL_REQ. */
 
 /* Default device limit for poll technologies */
 #define PHAC_DISCLOOP_TYPEA_DEFAULT_DEVICE_LIMIT              0x01U    /**< The default value loaded for device limit for Type A tags. */
@@ -50,6 +51,12 @@
 #define PHAC_DISCLOOP_TYPEV_DEFAULT_GT                        5200U    /**< Default guard time for Type V tech in Micro seconds.*/
 #define PHAC_DISCLOOP_I18000P3M3_DEFAULT_GT                  10000U    /**< Default guard time for 18000p3m3 tech in Micro seconds.*/
 
+/* Default polling period */
+#define PHAC_DISCLOOP_DEFAULT_POLL_PERIOD                     0x01U    /**< Default polling period of passive poll technologies in discovery loop cycles. */
+
+/* Default integrity error limit of automatic data rate negotiation */
+#define PHAC_DISCLOOP_I3P4_DEFAULT_DATARATE_ERR_LIMIT         0x03U    /**< Default number of integrity errors after which a lower ISO/IEC 14443-4 data rate is negotiated. */
+
 /* Rf Reset delay */
 #define PHAC_DISCLOOP_EMVCO_RESET_DELAY                       5100U    /**< Time during which device stops sending the carrier to perform a PICC Reset.*/
 /**
@@ -32,7 +32,9 @@
 #include <phacDiscLoop.h>
 #include <phpalI14443p3a.h>
 #include <phpalI14443p3b.h>
+#include <phpalI14443p4.h>
 #include <phpalI18092mPI.h>
+#include <phpalSli15693.h>
 
 #include "phacDiscLoop_Sw_Int_A.h"
 #include "phacDiscLoop_Sw_Int_B.h"
@@ -169,6 +171,7 @@ phStatus_t phacDiscLoop_Sw_Int_ActivePollMode(
 #if defined (NXPBUILD__PHAC_DISCLOOP_TYPEA_P2P_TAGS)    \
         || defined (NXPBUILD__PHAC_DISCLOOP_TYPEF_P2P_TAGS)
     phStatus_t PH_MEMLOC_REM   status;
+    uint8_t    PH_MEMLOC_REM   bLri;
 #endif
     uint8_t    PH_MEMLOC_COUNT bIndex;
 #ifdef NXPBUILD__PHAC_DISCLOOP_TYPEF_P2P_TAGS
@@ -196,17 +199,23 @@ phStatus_t phacDiscLoop_Sw_Int_ActivePollMode(
                 PH_CHECK_SUCCESS_FCT(status, phhalHw_Wait(pDataParams->pHalDataParams, PHHAL_HW_TIME_MICROSECONDS, pDataParams->wActPollGTimeUs));
 
                 /* Send ATR Request */
+                PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_P2PLri(pDataParams, pDataParams->sTypeATargetInfo.sTypeA_P2P.bLri, &bLri));
                 status = phpalI18092mPI_Atr(
                     pDataParams->pPal18092mPIDataParams,
                     pDataParams->sTypeATargetInfo.aTypeA_I3P3[0].aUid,
                     pDataParams->sTypeATargetInfo.sTypeA_P2P.bDid,
-                    pDataParams->sTypeATargetInfo.sTypeA_P2P.bLri,
+                    bLri,
                     pDataParams->sTypeATargetInfo.sTypeA_P2P.bNadEnable,
                     pDataParams->sTypeATargetInfo.sTypeA_P2P.bNad,
                     pDataParams->sTypeATargetInfo.sTypeA_P2P.pGi,
                     pDataParams->sTypeATargetInfo.sTypeA_P2P.bGiLength,
                     pDataParams->sTypeATargetInfo.sTypeA_P2P.pAtrRes,
                     &(pDataParams->sTypeATargetInfo.sTypeA_P2P.bAtrResLength));
+                if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+                {
+                    /* Switch to the highest common data rate */
+                    status = phacDiscLoop_Sw_Int_P2PPsl(pDataParams, pDataParams->sTypeATargetInfo.sTypeA_P2P.pAtrRes);
+                }
                 if((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
                 {
                     /* Set the corresponding detected bit */
@@ -255,11 +264,12 @@ phStatus_t phacDiscLoop_Sw_Int_ActivePollMode(
                 aNfcId3[9] = 0x00;
 
                 /* Send ATR Request */
+                PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_P2PLri(pDataParams, pDataParams->sTypeFTargetInfo.sTypeF_P2P.bLri, &bLri));
                 status = phpalI18092mPI_Atr(
                     pDataParams->pPal18092mPIDataParams,
                     aNfcId3,
                     pDataParams->sTypeFTargetInfo.sTypeF_P2P.bDid,
-                    pDataParams->sTypeFTargetInfo.sTypeF_P2P.bLri,
+                    bLri,
                     pDataParams->sTypeFTargetInfo.sTypeF_P2P.bNadEnable,
                     pDataParams->sTypeFTargetInfo.sTypeF_P2P.bNad,
                     pDataParams->sTypeFTargetInfo.sTypeF_P2P.pGi,
@@ -267,6 +277,11 @@ phStatus_t phacDiscLoop_Sw_Int_ActivePollMode(
                     pDataParams->sTypeFTargetInfo.sTypeF_P2P.pAtrRes,
                     &(pDataParams->sTypeFTargetInfo.sTypeF_P2P.bAtrResLength));
                 if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+                {
+                    /* Switch to the highest common data rate */
+                    status = phacDiscLoop_Sw_Int_P2PPsl(pDataParams, pDataParams->sTypeFTargetInfo.sTypeF_P2P.pAtrRes);
+                }
+                if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
                 {
                     /* Set the corresponding detected bit */
                     pDataParams->bDetectedTechs |= PH_ON << bIndex;
@@ -298,6 +313,7 @@ phStatus_t phacDiscLoop_Sw_Int_PollMode(
     uint8_t    PH_MEMLOC_REM bResolveTech;
     uint8_t    PH_MEMLOC_REM bTechType;
     uint8_t    PH_MEMLOC_REM bNumOfTechsFound = 0;
+    uint8_t    PH_MEMLOC_REM bDetectConfig;
 
     status = PH_ERR_INVALID_PARAMETER;
 
@@ -306,12 +322,52 @@ phStatus_t phacDiscLoop_Sw_Int_PollMode(
         if((pDataParams->bOpeMode == RD_LIB_MODE_NFC) ||
            (pDataParams->bOpeMode == RD_LIB_MODE_ISO))
         {
+            bDetectConfig = pDataParams->bPasPollTechCfg;
+
+            if (pDataParams->bPasPollResumeTechs)
+            {
+                /* Resume detection of technologies not polled in previous cycle */
+                bDetectConfig &= pDataParams->bPasPollResumeTechs;
+                pDataParams->bPasPollResumeTechs = 0x00;
+            }
+            else if (!pDataParams->bLpcdEnabled)
+            {
+                /* Poll only for technologies whose polling period has elapsed.
+                 * Card presence reported by LPCD polls for all technologies. */
+                bDetectConfig &= phacDiscLoop_Sw_Int_GetScheduledTechs(pDataParams);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
             /* Perform Technology detection Activity */
             status = phacDiscLoop_Sw_Int_TechDetectActivity(
                 pDataParams,
-                pDataParams->bPasPollBailOut,
-                pDataParams->bPasPollTechCfg,
+                (uint8_t)(pDataParams->bPasPollBailOut | pDataParams->bPasPollResumeCfg),
+                bDetectConfig,
                 &bNumOfTechsFound);
+
+            if (((status & PH_ERR_MASK) == PHAC_DISCLOOP_TECH_DETECTED) &&
+                (pDataParams->bDetectedTechs & pDataParams->bPasPollResumeCfg) &&
+                !(pDataParams->bDetectedTechs & pDataParams->bPasPollBailOut))
+            {
+                /* Technologies after the detected one are left for the next cycle */
+                pDataParams->bPasPollResumeTechs = (uint8_t)(bDetectConfig &
+                    ~((uint8_t)((pDataParams->bDetectedTechs << 1) - 1)));
+
+                /* Type F detected at 212 kbps is not polled at 424 kbps */
+                if (pDataParams->bDetectedTechs & PHAC_DISCLOOP_POS_BIT_MASK_F212)
+                {
+                    pDataParams->bPasPollResumeTechs &= (uint8_t)~PHAC_DISCLOOP_POS_BIT_MASK_F424;
+                }
+
+                /* In NFC mode, proprietary technologies are polled only if no NFC technology is detected */
+                if (pDataParams->bOpeMode == RD_LIB_MODE_NFC)
+                {
+                    pDataParams->bPasPollResumeTechs &= (uint8_t)((PH_ON << PHAC_DISCLOOP_POLL_MAX_NFC_TECHS_SUPPORTED) - 1);
+                }
+            }
         }
         else if(pDataParams->bOpeMode == RD_LIB_MODE_EMVCO)
         {
@@ -362,8 +418,16 @@ phStatus_t phacDiscLoop_Sw_Int_PollMode(
         status = phacDiscLoop_Sw_Int_ColsnReslnActivity(pDataParams, (bTechType - 1));
         if((status & PH_ERR_MASK) == PHAC_DISCLOOP_DEVICE_RESOLVED)
         {
-            /* Activation */
-            status = phacDiscLoop_Sw_Int_ActivateDevice(pDataParams, (bTechType - 1), 0x00);
+            if (phacDiscLoop_Sw_Int_CheckFilter(pDataParams, (bTechType - 1)) == PH_ON)
+            {
+                /* Activation */
+                status = phacDiscLoop_Sw_Int_ActivateDevice(pDataParams, (bTechType - 1), 0x00);
+            }
+            else
+            {
+                /* Rejected by pre-activation filter, skip activation */
+                status = phacDiscLoop_Sw_Int_RejectDevice(pDataParams, (bTechType - 1));
+            }
         }
     }
 
@@ -532,8 +596,15 @@ phStatus_t phacDiscLoop_Sw_Int_TechDetectActivity(
             }
 
             /* Perform Tech detection. */
+            pDataParams->bPolledTechs |= (uint8_t)(PH_ON << bTechIndex);
             status = pfDetTechs[bTechIndex](pDataParams);
 
+            /* Schedule next poll of this technology based on detection result. */
+            phacDiscLoop_Sw_Int_UpdateSchedule(
+                pDataParams,
+                bTechIndex,
+                (uint8_t)(((status & PH_ERR_MASK) == PHAC_DISCLOOP_TECH_DETECTED) ? PH_ON : PH_OFF));
+
             if ((status & PH_ERR_MASK) == PHAC_DISCLOOP_TECH_DETECTED)
             {
                 /*Set the corresponding detected bit. */
@@ -805,6 +876,546 @@ phStatus_t phacDiscLoop_Sw_Int_FieldOn(
     }
 }
 
+uint8_t phacDiscLoop_Sw_Int_GetScheduledTechs(
+                                              phacDiscLoop_Sw_DataParams_t * pDataParams
+                                              )
+{
+    uint8_t PH_MEMLOC_COUNT bTechIndex;
+    uint8_t PH_MEMLOC_REM   bScheduledTechs = 0x00;
+
+    for (bTechIndex = 0; bTechIndex < PHAC_DISCLOOP_PASS_POLL_MAX_TECHS_SUPPORTED; bTechIndex++)
+    {
+        if (pDataParams->baPasPollCountDown[bTechIndex] > 1)
+        {
+            /* Polling period not yet elapsed, skip this cycle */
+            pDataParams->baPasPollCountDown[bTechIndex]--;
+        }
+        else
+        {
+            bScheduledTechs |= (uint8_t)(PH_ON << bTechIndex);
+        }
+    }
+
+    return bScheduledTechs;
+}
+
+void phacDiscLoop_Sw_Int_UpdateSchedule(
+                                        phacDiscLoop_Sw_DataParams_t * pDataParams,
+                                        uint8_t bTechIndex,
+                                        uint8_t bDetected
+                                        )
+{
+    uint8_t PH_MEMLOC_REM bPeriod = pDataParams->baPasPollPeriod[bTechIndex];
+    uint8_t PH_MEMLOC_REM bCurPeriod = pDataParams->baPasPollCurPeriod[bTechIndex];
+
+    if (pDataParams->bPasPollAdaptive == PH_ON)
+    {
+        if (bDetected == PH_ON)
+        {
+            /* Technology present, poll in every cycle */
+            bCurPeriod = 1;
+        }
+        else if (bCurPeriod < (uint8_t)(bPeriod >> 1))
+        {
+            /* Back off towards the configured period */
+            bCurPeriod = (uint8_t)(bCurPeriod << 1);
+        }
+        else
+        {
+            bCurPeriod = bPeriod;
+        }
+    }
+    else
+    {
+        bCurPeriod = bPeriod;
+    }
+
+    pDataParams->baPasPollCurPeriod[bTechIndex] = bCurPeriod;
+    pDataParams->baPasPollCountDown[bTechIndex] = bCurPeriod;
+}
+
+static uint8_t phacDiscLoop_Sw_Int_GetFilterField(
+                                                  phacDiscLoop_Sw_DataParams_t * pDataParams,
+                                                  uint8_t bTechType,
+                                                  uint8_t bField,
+                                                  uint8_t ** ppField
+                                                  )
+{
+    uint8_t PH_MEMLOC_REM bFieldLen = 0x00;
+
+    switch (bTechType)
+    {
+#ifdef NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P3_TAGS
+    case PHAC_DISCLOOP_TECH_TYPE_A:
+        if (bField == PHAC_DISCLOOP_FILTER_FIELD_UID)
+        {
+            *ppField = pDataParams->sTypeATargetInfo.aTypeA_I3P3[0].aUid;
+            bFieldLen = pDataParams->sTypeATargetInfo.aTypeA_I3P3[0].bUidSize;
+        }
+        else if (bField == PHAC_DISCLOOP_FILTER_FIELD_ATQA)
+        {
+            *ppField = pDataParams->sTypeATargetInfo.aTypeA_I3P3[0].aAtqa;
+            bFieldLen = PHAC_DISCLOOP_I3P3A_MAX_ATQA_LENGTH;
+        }
+        else if (bField == PHAC_DISCLOOP_FILTER_FIELD_SAK)
+        {
+            *ppField = &pDataParams->sTypeATargetInfo.aTypeA_I3P3[0].aSak;
+            bFieldLen = 1;
+        }
+        else
+        {
+            /* Field not available for Type A */
+        }
+        break;
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P3_TAGS */
+
+#ifdef NXPBUILD__PHAC_DISCLOOP_TYPEB_TAGS
+    case PHAC_DISCLOOP_TECH_TYPE_B:
+        if (bField == PHAC_DISCLOOP_FILTER_FIELD_UID)
+        {
+            *ppField = pDataParams->sTypeBTargetInfo.aTypeB_I3P3[0].aPupi;
+            bFieldLen = PHAC_DISCLOOP_I3P3B_PUPI_LENGTH;
+        }
+        else if ((bField == PHAC_DISCLOOP_FILTER_FIELD_AFI) &&
+            (pDataParams->sTypeBTargetInfo.aTypeB_I3P3[0].bAtqBLength > (PHAC_DISCLOOP_I3P3B_PUPI_LENGTH + 1)))
+        {
+            /* ATQB: 0x50, PUPI, application data (AFI first), protocol info */
+            *ppField = &pDataParams->sTypeBTargetInfo.aTypeB_I3P3[0].aAtqB[PHAC_DISCLOOP_I3P3B_PUPI_LENGTH + 1];
+            bFieldLen = 1;
+        }
+        else
+        {
+            /* Field not available for Type B */
+        }
+        break;
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEB_TAGS */
+
+#ifdef NXPBUILD__PHAC_DISCLOOP_TYPEF_TAGS
+    case PHAC_DISCLOOP_TECH_TYPE_F212:
+    case PHAC_DISCLOOP_TECH_TYPE_F424:
+        if (bField == PHAC_DISCLOOP_FILTER_FIELD_UID)
+        {
+            *ppField = pDataParams->sTypeFTargetInfo.aTypeFTag[0].aIDmPMm;
+            bFieldLen = PHAC_DISCLOOP_FELICA_IDM_LENGTH;
+        }
+        else if (bField == PHAC_DISCLOOP_FILTER_FIELD_SYSTEM_CODE)
+        {
+            *ppField = pDataParams->sTypeFTargetInfo.aTypeFTag[0].aRD;
+            bFieldLen = PHAC_DISCLOOP_FELICA_RD_LENGTH;
+        }
+        else
+        {
+            /* Field not available for Type F */
+        }
+        break;
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEF_TAGS */
+
+#ifdef NXPBUILD__PHAC_DISCLOOP_TYPEV_TAGS
+    case PHAC_DISCLOOP_TECH_TYPE_V:
+        if (bField == PHAC_DISCLOOP_FILTER_FIELD_UID)
+        {
+            *ppField = pDataParams->sTypeVTargetInfo.aTypeV[0].aUid;
+            bFieldLen = PHPAL_SLI15693_UID_LENGTH;
+        }
+        else if (bField == PHAC_DISCLOOP_FILTER_FIELD_DSFID)
+        {
+            *ppField = &pDataParams->sTypeVTargetInfo.aTypeV[0].bDsfid;
+            bFieldLen = 1;
+        }
+        else
+        {
+            /* Field not available for Type V */
+        }
+        break;
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEV_TAGS */
+
+#ifdef NXPBUILD__PHAC_DISCLOOP_I18000P3M3_TAGS
+    case PHAC_DISCLOOP_TECH_TYPE_18000P3M3:
+        if (bField == PHAC_DISCLOOP_FILTER_FIELD_UID)
+        {
+            *ppField = pDataParams->sI18000p3m3TargetInfo.aI18000p3m3[0].aUii;
+            bFieldLen = (uint8_t)(pDataParams->sI18000p3m3TargetInfo.aI18000p3m3[0].wUiiLength >> 3);
+        }
+        break;
+#endif /* NXPBUILD__PHAC_DISCLOOP_I18000P3M3_TAGS */
+
+    default:
+        break;
+    }
+
+    return bFieldLen;
+}
+
+static uint8_t phacDiscLoop_Sw_Int_MatchFilter(
+                                               phacDiscLoop_Sw_DataParams_t * pDataParams,
+                                               const phacDiscLoop_Sw_Filter_t * pFilter
+                                               )
+{
+    uint8_t PH_MEMLOC_REM   *pField = NULL;
+    uint8_t PH_MEMLOC_REM   bFieldLen;
+    uint8_t PH_MEMLOC_COUNT bIndex;
+
+    bFieldLen = phacDiscLoop_Sw_Int_GetFilterField(pDataParams, pFilter->bTechType, pFilter->bField, &pField);
+
+    /* Field not available or shorter than the expected value */
+    if ((bFieldLen == 0) || (pFilter->bLength > bFieldLen) || (pFilter->bLength > PHAC_DISCLOOP_FILTER_MAX_LENGTH))
+    {
+        return PH_OFF;
+    }
+
+    for (bIndex = 0; bIndex < pFilter->bLength; bIndex++)
+    {
+        if ((pField[bIndex] & pFilter->aMask[bIndex]) != (pFilter->aValue[bIndex] & pFilter->aMask[bIndex]))
+        {
+            return PH_OFF;
+        }
+    }
+
+    return PH_ON;
+}
+
+uint8_t phacDiscLoop_Sw_Int_CheckFilter(
+                                        phacDiscLoop_Sw_DataParams_t * pDataParams,
+                                        uint8_t bTechType
+                                        )
+{
+    uint8_t PH_MEMLOC_COUNT bIndex;
+    uint8_t PH_MEMLOC_REM   bTechFiltered = PH_OFF;
+    uint8_t PH_MEMLOC_REM   bGroupMatch = PH_ON;
+
+    if (pDataParams->pFilterTable == NULL)
+    {
+        return PH_ON;
+    }
+
+    /* Type F entries apply to both baud rates */
+    if (bTechType == PHAC_DISCLOOP_TECH_TYPE_F424)
+    {
+        bTechType = PHAC_DISCLOOP_TECH_TYPE_F212;
+    }
+
+    for (bIndex = 0; bIndex < pDataParams->bNumFilterEntries; bIndex++)
+    {
+        if (((pDataParams->pFilterTable[bIndex].bTechType == PHAC_DISCLOOP_TECH_TYPE_F424) ?
+            PHAC_DISCLOOP_TECH_TYPE_F212 : pDataParams->pFilterTable[bIndex].bTechType) != bTechType)
+        {
+            continue;
+        }
+        bTechFiltered = PH_ON;
+
+        if (phacDiscLoop_Sw_Int_MatchFilter(pDataParams, &pDataParams->pFilterTable[bIndex]) == PH_OFF)
+        {
+            bGroupMatch = PH_OFF;
+        }
+
+        /* End of an AND'ed group of entries */
+        if (!(pDataParams->pFilterTable[bIndex].bOption & PHAC_DISCLOOP_FILTER_OPTION_AND_NEXT) ||
+            ((bIndex + 1) == pDataParams->bNumFilterEntries))
+        {
+            if (bGroupMatch == PH_ON)
+            {
+                return PH_ON;
+            }
+            bGroupMatch = PH_ON;
+        }
+    }
+
+    /* Technologies without filter entries are always activated */
+    return (uint8_t)((bTechFiltered == PH_ON) ? PH_OFF : PH_ON);
+}
+
+phStatus_t phacDiscLoop_Sw_Int_RejectDevice(
+                                            phacDiscLoop_Sw_DataParams_t * pDataParams,
+                                            uint8_t bTechType
+                                            )
+{
+    phStatus_t PH_MEMLOC_REM status = PH_ERR_SUCCESS;
+
+    if (pDataParams->bFilterHalt == PH_ON)
+    {
+        switch (bTechType)
+        {
+#ifdef NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P3_TAGS
+        case PHAC_DISCLOOP_TECH_TYPE_A:
+            if (!pDataParams->sTypeATargetInfo.bT1TFlag)
+            {
+                status = phpalI14443p3a_HaltA(pDataParams->pPal1443p3aDataParams);
+            }
+            break;
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P3_TAGS */
+
+#ifdef NXPBUILD__PHAC_DISCLOOP_TYPEB_TAGS
+        case PHAC_DISCLOOP_TECH_TYPE_B:
+            PH_CHECK_SUCCESS_FCT(status, phpalI14443p3b_SetSerialNo(
+                pDataParams->pPal1443p3bDataParams,
+                pDataParams->sTypeBTargetInfo.aTypeB_I3P3[0].aPupi));
+
+            status = phpalI14443p3b_HaltB(pDataParams->pPal1443p3bDataParams);
+            break;
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEB_TAGS */
+
+#ifdef NXPBUILD__PHAC_DISCLOOP_TYPEF_TAGS
+        case PHAC_DISCLOOP_TECH_TYPE_F212:
+        case PHAC_DISCLOOP_TECH_TYPE_F424:
+            /* FeliCa has no halt command, the card is only skipped */
+            break;
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEF_TAGS */
+
+#ifdef NXPBUILD__PHAC_DISCLOOP_TYPEV_TAGS
+        case PHAC_DISCLOOP_TECH_TYPE_V:
+            PH_CHECK_SUCCESS_FCT(status, phpalSli15693_SetSerialNo(
+                pDataParams->pPalSli15693DataParams,
+                pDataParams->sTypeVTargetInfo.aTypeV[0].aUid,
+                PHPAL_SLI15693_UID_LENGTH));
+
+            status = phpalSli15693_StayQuiet(pDataParams->pPalSli15693DataParams);
+            break;
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEV_TAGS */
+
+        default:
+            /* 18000P3M3 is only skipped */
+            break;
+        }
+
+        /* No response is expected to halt commands */
+        if (((status & PH_ERR_MASK) != PH_ERR_SUCCESS) && ((status & PH_ERR_MASK) != PH_ERR_IO_TIMEOUT))
+        {
+            return status;
+        }
+    }
+
+    return PH_ADD_COMPCODE(PHAC_DISCLOOP_DEVICE_FILTERED, PH_COMP_AC_DISCLOOP);
+}
+
+phStatus_t phacDiscLoop_Sw_Int_LimitFsdi(
+                                         phacDiscLoop_Sw_DataParams_t * pDataParams,
+                                         uint8_t bFsdi,
+                                         uint8_t * pFsdi
+                                         )
+{
+    static const uint16_t PH_MEMLOC_CONST_ROM aFsdTable[PHPAL_I14443P4_FRAMESIZE_MAX + 1] = {16, 24, 32, 40, 48, 64, 96, 128, 256, 512, 1024, 2048, 4096};
+    phStatus_t PH_MEMLOC_REM status;
+    uint16_t   PH_MEMLOC_REM wRxBufferSize;
+
+    PH_CHECK_SUCCESS_FCT(status, phhalHw_GetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_RXBUFFER_BUFSIZE, &wRxBufferSize));
+
+    if (bFsdi > PHPAL_I14443P4_FRAMESIZE_MAX)
+    {
+        bFsdi = PHPAL_I14443P4_FRAMESIZE_MAX;
+    }
+
+    /* The operation mode may have changed after FSDI was set, extended frame sizes are ISO only */
+    if ((pDataParams->bOpeMode != RD_LIB_MODE_ISO) && (bFsdi > PHPAL_I14443P4_EMVCO_FRAMESIZE_MAX))
+    {
+        bFsdi = PHPAL_I14443P4_EMVCO_FRAMESIZE_MAX;
+    }
+
+    /* Do not announce frames the HAL receive buffer cannot hold */
+    while ((bFsdi > 0) && (aFsdTable[bFsdi] > wRxBufferSize))
+    {
+        bFsdi--;
+    }
+
+    *pFsdi = bFsdi;
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AC_DISCLOOP);
+}
+
+#if defined (NXPBUILD__PHAC_DISCLOOP_TYPEA_P2P_TAGS)    \
+        || defined (NXPBUILD__PHAC_DISCLOOP_TYPEF_P2P_TAGS)
+phStatus_t phacDiscLoop_Sw_Int_P2PLri(
+                                      phacDiscLoop_Sw_DataParams_t * pDataParams,
+                                      uint8_t bLri,
+                                      uint8_t * pLri
+                                      )
+{
+    /* Frame sizes including the length byte and the start byte at 106 kbps */
+    static const uint16_t PH_MEMLOC_CONST_ROM aLrTable[4] = {66, 130, 194, 256};
+    phStatus_t PH_MEMLOC_REM status;
+    uint16_t   PH_MEMLOC_REM wRxBufferSize;
+
+    if (pDataParams->bP2PAutoNegotiate == PH_ON)
+    {
+        PH_CHECK_SUCCESS_FCT(status, phhalHw_GetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_RXBUFFER_BUFSIZE, &wRxBufferSize));
+
+        /* Request the largest LRi the HAL receive buffer can hold */
+        bLri = PHPAL_I18092MPI_FRAMESIZE_254;
+        while ((bLri > PHPAL_I18092MPI_FRAMESIZE_64) && (aLrTable[bLri] > wRxBufferSize))
+        {
+            bLri--;
+        }
+    }
+
+    *pLri = bLri;
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AC_DISCLOOP);
+}
+
+phStatus_t phacDiscLoop_Sw_Int_P2PPsl(
+                                      phacDiscLoop_Sw_DataParams_t * pDataParams,
+                                      uint8_t * pAtrRes
+                                      )
+{
+    phStatus_t PH_MEMLOC_REM status;
+    uint16_t   PH_MEMLOC_REM wTxDataRate;
+    uint16_t   PH_MEMLOC_REM wRxDataRate;
+    uint16_t   PH_MEMLOC_REM wFsl;
+    uint8_t    PH_MEMLOC_REM bDsi;
+    uint8_t    PH_MEMLOC_REM bDri;
+    uint8_t    PH_MEMLOC_COUNT bRate;
+
+    if (pDataParams->bP2PAutoNegotiate != PH_ON)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AC_DISCLOOP);
+    }
+
+    /* Data rates used for ATR */
+    PH_CHECK_SUCCESS_FCT(status, phhalHw_GetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_TXDATARATE_FRAMING, &wTxDataRate));
+    PH_CHECK_SUCCESS_FCT(status, phhalHw_GetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_RXDATARATE_FRAMING, &wRxDataRate));
+    wTxDataRate &= PHHAL_HW_RF_DATARATE_OPTION_MASK;
+    wRxDataRate &= PHHAL_HW_RF_DATARATE_OPTION_MASK;
+    if ((wTxDataRate > PHPAL_I18092MPI_DATARATE_424) || (wRxDataRate > PHPAL_I18092MPI_DATARATE_424))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AC_DISCLOOP);
+    }
+    bDsi = (uint8_t)wTxDataRate;
+    bDri = (uint8_t)wRxDataRate;
+
+    /* BRt lists the rates the target receives, BSt the rates it sends; bit 0 is 212 kbps, bit 1 is 424 kbps */
+    for (bRate = PHPAL_I18092MPI_DATARATE_212; bRate <= pDataParams->bP2PMaxDataRate; bRate++)
+    {
+        if ((pAtrRes[PHAC_DISCLOOP_P2P_ATR_RES_BRT_POS] & (1U << (bRate - 1))) && (bRate > bDsi))
+        {
+            bDsi = bRate;
+        }
+        if ((pAtrRes[PHAC_DISCLOOP_P2P_ATR_RES_BST_POS] & (1U << (bRate - 1))) && (bRate > bDri))
+        {
+            bDri = bRate;
+        }
+    }
+
+    /* PSL is only worth its round trip if the data rate changes */
+    if ((bDsi == wTxDataRate) && (bDri == wRxDataRate))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AC_DISCLOOP);
+    }
+
+    /* Keep the frame size agreed by ATR */
+    PH_CHECK_SUCCESS_FCT(status, phpalI18092mPI_GetConfig(pDataParams->pPal18092mPIDataParams, PHPAL_I18092MPI_CONFIG_FSL, &wFsl));
+
+    status = phpalI18092mPI_Psl(pDataParams->pPal18092mPIDataParams, bDsi, bDri, (uint8_t)wFsl);
+    if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+    {
+        /* Fall back to the next lower data rate on the next activation */
+        if (pDataParams->bP2PMaxDataRate > PHPAL_I18092MPI_DATARATE_106)
+        {
+            pDataParams->bP2PMaxDataRate--;
+        }
+        return status;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AC_DISCLOOP);
+}
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEA_P2P_TAGS || NXPBUILD__PHAC_DISCLOOP_TYPEF_P2P_TAGS */
+
+uint8_t phacDiscLoop_Sw_Int_SelectDataRate(
+                                           phacDiscLoop_Sw_DataParams_t * pDataParams,
+                                           uint8_t bI3P4Tech,
+                                           uint8_t bBitRateCaps,
+                                           uint8_t * pDri,
+                                           uint8_t * pDsi
+                                           )
+{
+    uint8_t PH_MEMLOC_REM   bMaxDataRate;
+    uint8_t PH_MEMLOC_COUNT bIndex;
+
+    bMaxDataRate = pDataParams->baI3P4MaxDataRate[bI3P4Tech];
+    *pDri = 0x00;
+    *pDsi = 0x00;
+
+    /* b4 is RFU, if set only 106 kbps is supported */
+    if (bBitRateCaps & 0x08)
+    {
+        return PH_OFF;
+    }
+
+    /* Highest rate first: b1..b3 for PCD to PICC (DRI), b5..b7 for PICC to PCD (DSI) */
+    for (bIndex = bMaxDataRate; bIndex > 0; bIndex--)
+    {
+        if (bBitRateCaps & 0x80)
+        {
+            /* Only the same data rate in both directions is supported */
+            if ((bBitRateCaps & (1 << (bIndex - 1))) && (bBitRateCaps & (1 << (bIndex + 3))))
+            {
+                *pDri = bIndex;
+                *pDsi = bIndex;
+                break;
+            }
+        }
+        else
+        {
+            if ((*pDri == 0x00) && (bBitRateCaps & (1 << (bIndex - 1))))
+            {
+                *pDri = bIndex;
+            }
+            if ((*pDsi == 0x00) && (bBitRateCaps & (1 << (bIndex + 3))))
+            {
+                *pDsi = bIndex;
+            }
+        }
+    }
+
+    return ((*pDri != 0x00) || (*pDsi != 0x00)) ? PH_ON : PH_OFF;
+}
+
+void phacDiscLoop_Sw_Int_LowerDataRate(
+                                       phacDiscLoop_Sw_DataParams_t * pDataParams,
+                                       uint8_t bI3P4Tech,
+                                       uint8_t bDri,
+                                       uint8_t bDsi
+                                       )
+{
+    uint8_t PH_MEMLOC_REM bDataRate;
+
+    /* Next activation uses one step below the faster direction */
+    bDataRate = (bDri > bDsi) ? bDri : bDsi;
+    if ((pDataParams->bI3P4DataRateErrLimit > 0) && (bDataRate > 0))
+    {
+        pDataParams->baI3P4MaxDataRate[bI3P4Tech] = bDataRate - 1;
+    }
+}
+
+phStatus_t phacDiscLoop_Sw_Int_CheckDataRateFallback(
+                                                     phacDiscLoop_Sw_DataParams_t * pDataParams
+                                                     )
+{
+#ifdef NXPBUILD__PHPAL_I14443P4_SW
+    phStatus_t PH_MEMLOC_REM status;
+    uint16_t   PH_MEMLOC_REM wIntegrityErrors;
+
+    if (pDataParams->bI3P4DataRateTech != 0xFF)
+    {
+        PH_CHECK_SUCCESS_FCT(status, phpalI14443p4_GetConfig(
+            pDataParams->pPal14443p4DataParams,
+            PHPAL_I14443P4_CONFIG_INTEGRITY_ERRORS,
+            &wIntegrityErrors));
+
+        /* Repeated integrity errors while the last card was active at the negotiated rate */
+        if ((pDataParams->bI3P4DataRateErrLimit > 0) && (wIntegrityErrors >= pDataParams->bI3P4DataRateErrLimit))
+        {
+            phacDiscLoop_Sw_Int_LowerDataRate(pDataParams, pDataParams->bI3P4DataRateTech,
+                pDataParams->baI3P4NegDri[pDataParams->bI3P4DataRateTech],
+                pDataParams->baI3P4NegDsi[pDataParams->bI3P4DataRateTech]);
+        }
+        pDataParams->bI3P4DataRateTech = 0xFF;
+    }
+
+    /* Count errors of the card about to be activated only */
+    return phpalI14443p4_SetConfig(pDataParams->pPal14443p4DataParams, PHPAL_I14443P4_CONFIG_INTEGRITY_ERRORS, 0);
+#else
+    PH_UNUSED_VARIABLE(pDataParams);
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AC_DISCLOOP);
+#endif /* NXPBUILD__PHPAL_I14443P4_SW */
+}
+
 uint8_t phacDiscLoop_Sw_Int_IsValidPollStatus(
                                               phStatus_t wStatus
                                               )
@@ -54,6 +54,9 @@
  * */
 #define PHAC_DISCLOOP_DEVICE_RESOLVED                       0x0089U
 
+#define PHAC_DISCLOOP_P2P_ATR_RES_BST_POS                     13U                /**< Position of BSt (target send bit rates) in ATR_RES. */
+#define PHAC_DISCLOOP_P2P_ATR_RES_BRT_POS                     14U                /**< Position of BRt (target receive bit rates) in ATR_RES. */
+
 typedef phStatus_t (*pphacDiscLoop_Sw_DetTechs) (phacDiscLoop_Sw_DataParams_t *pDataParams );
 typedef phStatus_t (*pphacDiscLoop_Sw_Reslns)(phacDiscLoop_Sw_DataParams_t *pDataParams);
 typedef phStatus_t (*pphacDiscLoop_Sw_DeviceActivate)(phacDiscLoop_Sw_DataParams_t *pDataParams, uint8_t bIndex);
@@ -114,6 +117,62 @@ phStatus_t phacDiscLoop_Sw_Int_FieldOn(
     phacDiscLoop_Sw_DataParams_t * pDataParams
     );
 
+uint8_t phacDiscLoop_Sw_Int_GetScheduledTechs(
+    phacDiscLoop_Sw_DataParams_t * pDataParams
+    );
+
+void phacDiscLoop_Sw_Int_UpdateSchedule(
+    phacDiscLoop_Sw_DataParams_t * pDataParams,
+    uint8_t bTechIndex,
+    uint8_t bDetected
+    );
+
+uint8_t phacDiscLoop_Sw_Int_CheckFilter(
+    phacDiscLoop_Sw_DataParams_t * pDataParams,
+    uint8_t bTechType
+    );
+
+phStatus_t phacDiscLoop_Sw_Int_RejectDevice(
+    phacDiscLoop_Sw_DataParams_t * pDataParams,
+    uint8_t bTechType
+    );
+
+phStatus_t phacDiscLoop_Sw_Int_LimitFsdi(
+    phacDiscLoop_Sw_DataParams_t * pDataParams,
+    uint8_t bFsdi,
+    uint8_t * pFsdi
+    );
+
+phStatus_t phacDiscLoop_Sw_Int_P2PLri(
+    phacDiscLoop_Sw_DataParams_t * pDataParams,
+    uint8_t bLri,
+    uint8_t * pLri
+    );
+
+phStatus_t phacDiscLoop_Sw_Int_P2PPsl(
+    phacDiscLoop_Sw_DataParams_t * pDataParams,
+    uint8_t * pAtrRes
+    );
+
+uint8_t phacDiscLoop_Sw_Int_SelectDataRate(
+    phacDiscLoop_Sw_DataParams_t * pDataParams,
+    uint8_t bI3P4Tech,
+    uint8_t bBitRateCaps,
+    uint8_t * pDri,
+    uint8_t * pDsi
+    );
+
+void phacDiscLoop_Sw_Int_LowerDataRate(
+    phacDiscLoop_Sw_DataParams_t * pDataParams,
+    uint8_t bI3P4Tech,
+    uint8_t bDri,
+    uint8_t bDsi
+    );
+
+phStatus_t phacDiscLoop_Sw_Int_CheckDataRateFallback(
+    phacDiscLoop_Sw_DataParams_t * pDataParams
+    );
+
 uint8_t phacDiscLoop_Sw_Int_IsValidPollStatus(
     phStatus_t wStatus
     );
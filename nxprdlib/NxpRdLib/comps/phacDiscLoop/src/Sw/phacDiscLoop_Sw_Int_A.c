@@ -450,6 +450,56 @@ phStatus_t phacDiscLoop_Sw_Int_CollisionResolutionA(
 #endif /* NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P3_TAGS */
 }
 
+#ifdef  NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P4_TAGS
+static phStatus_t phacDiscLoop_Sw_Int_ActivateI3P4A_AutoDataRate(
+                                                                 phacDiscLoop_Sw_DataParams_t * pDataParams
+                                                                 )
+{
+    phStatus_t PH_MEMLOC_REM status;
+    uint8_t    PH_MEMLOC_REM bBitRateCaps = 0x00;
+    uint8_t    PH_MEMLOC_REM bDri;
+    uint8_t    PH_MEMLOC_REM bDsi;
+    uint8_t    PH_MEMLOC_REM bFsdi;
+    uint8_t *  PH_MEMLOC_REM pAts;
+
+    PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_CheckDataRateFallback(pDataParams));
+    PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_LimitFsdi(pDataParams, pDataParams->sTypeATargetInfo.sTypeA_I3P4.bFsdi, &bFsdi));
+
+    pAts = pDataParams->sTypeATargetInfo.sTypeA_I3P4.pAts;
+    pDataParams->baI3P4NegDri[0] = 0x00;
+    pDataParams->baI3P4NegDsi[0] = 0x00;
+
+    PH_CHECK_SUCCESS_FCT(status, phpalI14443p4a_Rats(
+        pDataParams->pPal1443p4aDataParams,
+        bFsdi,
+        pDataParams->sTypeATargetInfo.sTypeA_I3P4.bCid,
+        pAts));
+
+    /* TA(1) follows T0 if indicated */
+    if ((pAts[0] > 2) && (pAts[1] & PHAC_DISCLOOP_TYPEA_ATS_TA1_PRESENT))
+    {
+        bBitRateCaps = pAts[2];
+    }
+
+    if (phacDiscLoop_Sw_Int_SelectDataRate(pDataParams, 0, bBitRateCaps, &bDri, &bDsi) == PH_ON)
+    {
+        status = phpalI14443p4a_Pps(pDataParams->pPal1443p4aDataParams, bDri, bDsi);
+        if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+        {
+            /* Use a lower data rate on the next activation */
+            phacDiscLoop_Sw_Int_LowerDataRate(pDataParams, 0, bDri, bDsi);
+            return status;
+        }
+
+        pDataParams->baI3P4NegDri[0] = bDri;
+        pDataParams->baI3P4NegDsi[0] = bDsi;
+        pDataParams->bI3P4DataRateTech = 0;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AC_DISCLOOP);
+}
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P4_TAGS */
+
 phStatus_t phacDiscLoop_Sw_Int_ActivateA(
                                          phacDiscLoop_Sw_DataParams_t * pDataParams,
                                          uint8_t bTypeATagIdx
@@ -461,6 +511,12 @@ phStatus_t phacDiscLoop_Sw_Int_ActivateA(
     uint8_t      PH_MEMLOC_REM bUidLen;
     uint8_t      PH_MEMLOC_REM bMoreCardsAvailable;
     uint8_t      PH_MEMLOC_REM bTagType;
+#ifdef NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P4_TAGS
+    uint8_t      PH_MEMLOC_REM bFsdi;
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P4_TAGS */
+#ifdef NXPBUILD__PHAC_DISCLOOP_TYPEA_P2P_TAGS
+    uint8_t      PH_MEMLOC_REM bLri;
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEA_P2P_TAGS */
 
     if (bTypeATagIdx > pDataParams->sTypeATargetInfo.bTotalTagsFound)
     {
@@ -507,13 +563,21 @@ phStatus_t phacDiscLoop_Sw_Int_ActivateA(
              PH_CHECK_SUCCESS_FCT(status, phhalHw_SetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_SET_EMD, PH_ON));
         }
 
-        PH_CHECK_SUCCESS_FCT(status, phpalI14443p4a_ActivateCard(
-            pDataParams->pPal1443p4aDataParams,
-            pDataParams->sTypeATargetInfo.sTypeA_I3P4.bFsdi,
-            pDataParams->sTypeATargetInfo.sTypeA_I3P4.bCid,
-            pDataParams->sTypeATargetInfo.sTypeA_I3P4.bDri,
-            pDataParams->sTypeATargetInfo.sTypeA_I3P4.bDsi,
-            pDataParams->sTypeATargetInfo.sTypeA_I3P4.pAts));
+        if((pDataParams->bI3P4AutoDataRate == PH_ON) && (pDataParams->bOpeMode != RD_LIB_MODE_EMVCO))
+        {
+            PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_ActivateI3P4A_AutoDataRate(pDataParams));
+        }
+        else
+        {
+            PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_LimitFsdi(pDataParams, pDataParams->sTypeATargetInfo.sTypeA_I3P4.bFsdi, &bFsdi));
+            PH_CHECK_SUCCESS_FCT(status, phpalI14443p4a_ActivateCard(
+                pDataParams->pPal1443p4aDataParams,
+                bFsdi,
+                pDataParams->sTypeATargetInfo.sTypeA_I3P4.bCid,
+                pDataParams->sTypeATargetInfo.sTypeA_I3P4.bDri,
+                pDataParams->sTypeATargetInfo.sTypeA_I3P4.bDsi,
+                pDataParams->sTypeATargetInfo.sTypeA_I3P4.pAts));
+        }
     }
 #endif /*  NXPBUILD__PHAC_DISCLOOP_TYPEA_I3P4_TAGS */
 
@@ -521,11 +585,12 @@ phStatus_t phacDiscLoop_Sw_Int_ActivateA(
     if (bTagType == PHAC_DISCLOOP_TYPEA_TYPE_NFC_DEP_TAG_CONFIG_MASK)
     {
         /* Send ATR_REQ and PSL_REQ */
+        PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_P2PLri(pDataParams, pDataParams->sTypeATargetInfo.sTypeA_P2P.bLri, &bLri));
         PH_CHECK_SUCCESS_FCT(status, phpalI18092mPI_Atr(
             pDataParams->pPal18092mPIDataParams,
             pDataParams->sTypeATargetInfo.aTypeA_I3P3[bTypeATagIdx].aUid,
             pDataParams->sTypeATargetInfo.sTypeA_P2P.bDid,
-            pDataParams->sTypeATargetInfo.sTypeA_P2P.bLri,
+            bLri,
             pDataParams->sTypeATargetInfo.sTypeA_P2P.bNadEnable,
             pDataParams->sTypeATargetInfo.sTypeA_P2P.bNad,
             pDataParams->sTypeATargetInfo.sTypeA_P2P.pGi,
@@ -533,6 +598,9 @@ phStatus_t phacDiscLoop_Sw_Int_ActivateA(
             pDataParams->sTypeATargetInfo.sTypeA_P2P.pAtrRes,
             &(pDataParams->sTypeATargetInfo.sTypeA_P2P.bAtrResLength)));
 
+        /* Switch to the highest common data rate */
+        PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_P2PPsl(pDataParams, pDataParams->sTypeATargetInfo.sTypeA_P2P.pAtrRes));
+
         return PH_ADD_COMPCODE(PHAC_DISCLOOP_PASSIVE_TARGET_ACTIVATED, PH_COMP_AC_DISCLOOP);
     }
 #endif /* NXPBUILD__PHAC_DISCLOOP_TYPEA_P2P_TAGS */
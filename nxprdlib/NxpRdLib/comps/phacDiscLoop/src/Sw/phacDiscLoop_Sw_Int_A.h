@@ -33,6 +33,11 @@
  * ***************************************************************************************************************** */
 #include "phacDiscLoop_Sw.h"
 
+/* *****************************************************************************************************************
+ * MACROS/Defines
+ * ***************************************************************************************************************** */
+#define PHAC_DISCLOOP_TYPEA_ATS_TA1_PRESENT         0x10U       /**< Bit in T0 of the ATS which signals TA(1) presence */
+
 /* *****************************************************************************************************************
  * Function Prototypes
  * ***************************************************************************************************************** */
@@ -351,6 +351,12 @@ phStatus_t phacDiscLoop_Sw_Int_ActivateB(
     phStatus_t PH_MEMLOC_REM status = PH_ERR_SUCCESS;
     uint8_t    PH_MEMLOC_REM bAtqbLen;
     uint8_t    PH_MEMLOC_BUF aAtqb[13];
+#ifdef NXPBUILD__PHAC_DISCLOOP_TYPEB_I3P4B_TAGS
+    uint8_t    PH_MEMLOC_REM bDri;
+    uint8_t    PH_MEMLOC_REM bDsi;
+    uint8_t    PH_MEMLOC_REM bAutoDataRate;
+    uint8_t    PH_MEMLOC_REM bFsdi;
+#endif /* NXPBUILD__PHAC_DISCLOOP_TYPEB_I3P4B_TAGS */
 
     /* Only deviation form Device Activation Activity is
      * Device sleep state is not been check and always send WakeUpB Command
@@ -388,16 +394,50 @@ phStatus_t phacDiscLoop_Sw_Int_ActivateB(
         PH_CHECK_SUCCESS_FCT(status, phhalHw_SetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_SET_EMD, PH_ON));
     }
 
+    bDri = pDataParams->sTypeBTargetInfo.bDri;
+    bDsi = pDataParams->sTypeBTargetInfo.bDsi;
+    bAutoDataRate = PH_OFF;
+
+    PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_LimitFsdi(pDataParams, pDataParams->sTypeBTargetInfo.bFsdi, &bFsdi));
+
+    if((pDataParams->bI3P4AutoDataRate == PH_ON) && (pDataParams->bOpeMode != RD_LIB_MODE_EMVCO))
+    {
+        PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_CheckDataRateFallback(pDataParams));
+
+        /* Bit_Rate_capability is the first byte of the Protocol Info in the ATQB */
+        bAutoDataRate = phacDiscLoop_Sw_Int_SelectDataRate(
+            pDataParams,
+            1,
+            pDataParams->sTypeBTargetInfo.aTypeB_I3P3[bTypeBTagIdx].aAtqB[PHAC_DISCLOOP_TYPEB_ATQB_BITRATE_POS],
+            &bDri,
+            &bDsi);
+        pDataParams->baI3P4NegDri[1] = bDri;
+        pDataParams->baI3P4NegDsi[1] = bDsi;
+    }
+
     status = phpalI14443p3b_Attrib(
         pDataParams->pPal1443p3bDataParams,
         pDataParams->sTypeBTargetInfo.aTypeB_I3P3[bTypeBTagIdx].aAtqB,
         pDataParams->sTypeBTargetInfo.aTypeB_I3P3[bTypeBTagIdx].bAtqBLength,
-        pDataParams->sTypeBTargetInfo.bFsdi,
+        bFsdi,
         pDataParams->sTypeBTargetInfo.bCid,
-        pDataParams->sTypeBTargetInfo.bDri,
-        pDataParams->sTypeBTargetInfo.bDsi,
+        bDri,
+        bDsi,
         &pDataParams->sTypeBTargetInfo.sTypeB_I3P4.bMbli);
 
+    if (bAutoDataRate == PH_ON)
+    {
+        if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+        {
+            pDataParams->bI3P4DataRateTech = 1;
+        }
+        else
+        {
+            /* Use a lower data rate on the next activation */
+            phacDiscLoop_Sw_Int_LowerDataRate(pDataParams, 1, bDri, bDsi);
+        }
+    }
+
 #endif /* NXPBUILD__PHAC_DISCLOOP_TYPEB_I3P4B_TAGS */
     return status;
 #else
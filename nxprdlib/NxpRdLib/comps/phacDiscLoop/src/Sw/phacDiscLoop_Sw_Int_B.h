@@ -37,6 +37,7 @@
  * MACROS/Defines
  * ***************************************************************************************************************** */
 #define PHAC_DISCLOOP_TYPEB_MAX_SLOT_NUM            0x04U       /**< Maximum slot numbers allowed for Type B tags */
+#define PHAC_DISCLOOP_TYPEB_ATQB_BITRATE_POS        0x09U       /**< Position of Bit_Rate_capability within the ATQB */
 
 /* *****************************************************************************************************************
  * Function Prototypes
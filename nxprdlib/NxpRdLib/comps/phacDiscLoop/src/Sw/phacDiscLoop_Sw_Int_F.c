@@ -332,6 +332,7 @@ phStatus_t phacDiscLoop_Sw_Int_ActivateF(
     uint16_t   PH_MEMLOC_REM wFrameStatus;
 #ifdef NXPBUILD__PHAC_DISCLOOP_TYPEF_P2P_TAGS
     uint8_t    PH_MEMLOC_BUF aNfcId3[10];
+    uint8_t    PH_MEMLOC_REM bLri;
 #endif /* NXPBUILD__PHAC_DISCLOOP_TYPEF_P2P_TAGS */
 
     if (bTypeFTagIdx > pDataParams->sTypeFTargetInfo.bTotalTagsFound)
@@ -402,11 +403,12 @@ phStatus_t phacDiscLoop_Sw_Int_ActivateF(
         aNfcId3[9] = 0;
 
         /* Activate the P2P capable Felica card */
+        PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_P2PLri(pDataParams, pDataParams->sTypeFTargetInfo.sTypeF_P2P.bLri, &bLri));
         PH_CHECK_SUCCESS_FCT(status, phpalI18092mPI_Atr(
             pDataParams->pPal18092mPIDataParams,
             aNfcId3,
             pDataParams->sTypeFTargetInfo.sTypeF_P2P.bDid,
-            pDataParams->sTypeFTargetInfo.sTypeF_P2P.bLri,
+            bLri,
             pDataParams->sTypeFTargetInfo.sTypeF_P2P.bNadEnable,
             pDataParams->sTypeFTargetInfo.sTypeF_P2P.bNad,
             pDataParams->sTypeFTargetInfo.sTypeF_P2P.pGi,
@@ -414,6 +416,9 @@ phStatus_t phacDiscLoop_Sw_Int_ActivateF(
             pDataParams->sTypeFTargetInfo.sTypeF_P2P.pAtrRes,
             &(pDataParams->sTypeFTargetInfo.sTypeF_P2P.bAtrResLength)));
 
+        /* Switch to the highest common data rate */
+        PH_CHECK_SUCCESS_FCT(status, phacDiscLoop_Sw_Int_P2PPsl(pDataParams, pDataParams->sTypeFTargetInfo.sTypeF_P2P.pAtrRes));
+
         return PH_ADD_COMPCODE(PHAC_DISCLOOP_PASSIVE_TARGET_ACTIVATED, PH_COMP_AC_DISCLOOP);
 #endif /* NXPBUILD__PHAC_DISCLOOP_TYPEF_P2P_TAGS */
     }
@@ -28,6 +28,7 @@
 #include <phpalSli15693.h>
 #include <phalI15693.h>
 #include <ph_RefDefs.h>
+#include <string.h>
 
 #ifdef NXPBUILD__PHAL_I15693_SW
 
@@ -1063,6 +1064,209 @@ phStatus_t phalI15693_Sw_ExtendedGetMultipleBlockSecurityStatus(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_I15693);
 }
 
+phStatus_t phalI15693_Sw_GroupReadMultipleBlocks(
+    phalI15693_Sw_DataParams_t * pDataParams,
+    uint8_t bOption,
+    uint8_t bBlockNo,
+    uint16_t wNumBlocks,
+    phalI15693_GroupTag_t * pTags,
+    uint16_t wNumTags
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phStatus_t  PH_MEMLOC_REM status;
+    uint8_t     PH_MEMLOC_REM bCommand[3];
+    uint8_t     PH_MEMLOC_REM aUid[PHPAL_SLI15693_UID_LENGTH];
+    uint8_t     PH_MEMLOC_REM bUidLength;
+    uint16_t    PH_MEMLOC_REM wFlags;
+    uint16_t    PH_MEMLOC_REM wMinLength;
+    uint16_t    PH_MEMLOC_REM wIndex;
+    uint8_t *   PH_MEMLOC_REM pRxBuffer;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+
+    /* Number of wNumBlocks can't be zero and doesn't exceed 256 */
+    if ((wNumBlocks == 0) || (((uint16_t)bBlockNo + wNumBlocks) > 0x100))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_I15693);
+    }
+
+    /* Build command frame, it is the same for every tag */
+    bCommand[0] = PHAL_I15693_SW_CMD_READ_MULTIPLE_BLOCKS;
+    bCommand[1] = bBlockNo;
+    bCommand[2] = (uint8_t)(wNumBlocks - 1);
+
+    /* Minimum response length, one security status byte per block if the option bit is set */
+    wMinLength = (bOption != PHAL_I15693_OPTION_OFF) ? (uint16_t)(wNumBlocks * 2) : wNumBlocks;
+
+    /* Flags and timeout are the same for all tags */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalI15693_Sw_Int_GroupStart(
+        pDataParams,
+        bOption,
+        PHPAL_SLI15693_TIMEOUT_SHORT_US,
+        &wFlags,
+        aUid,
+        &bUidLength));
+
+    for (wIndex = 0; wIndex < wNumTags; ++wIndex)
+    {
+        pTags[wIndex].wDataLength = 0;
+
+        /* Address the tag */
+        status = phpalSli15693_SetSerialNo(
+            pDataParams->pPalSli15693DataParams,
+            pTags[wIndex].pUid,
+            PHPAL_SLI15693_UID_LENGTH);
+
+        if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+        {
+            status = phpalSli15693_Exchange(
+                pDataParams->pPalSli15693DataParams,
+                PH_EXCHANGE_DEFAULT,
+                bCommand,
+                3,
+                &pRxBuffer,
+                &wRxLength);
+        }
+
+        if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+        {
+            /* Length check */
+            if (wRxLength < wMinLength)
+            {
+                status = PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_I15693);
+            }
+            else if (wRxLength > pTags[wIndex].wDataBufSize)
+            {
+                status = PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_I15693);
+            }
+            else
+            {
+                memcpy(pTags[wIndex].pData, pRxBuffer, wRxLength); /* PRQA S 3200 */
+                pTags[wIndex].wDataLength = wRxLength;
+                status = PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_I15693);
+            }
+        }
+
+        /* A failing tag does not stop the group */
+        pTags[wIndex].wStatus = status;
+    }
+
+    return phalI15693_Sw_Int_GroupStop(pDataParams, wFlags, aUid, bUidLength);
+}
+
+phStatus_t phalI15693_Sw_GroupWriteBlocks(
+    phalI15693_Sw_DataParams_t * pDataParams,
+    uint8_t bOption,
+    uint8_t bBlockNo,
+    uint16_t wNumBlocks,
+    phalI15693_GroupTag_t * pTags,
+    uint16_t wNumTags
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phStatus_t  PH_MEMLOC_REM status;
+    uint8_t     PH_MEMLOC_REM bCommand[2];
+    uint8_t     PH_MEMLOC_REM aUid[PHPAL_SLI15693_UID_LENGTH];
+    uint8_t     PH_MEMLOC_REM bUidLength;
+    uint16_t    PH_MEMLOC_REM wFlags;
+    uint16_t    PH_MEMLOC_REM wIndex;
+    uint16_t    PH_MEMLOC_REM wBlock;
+    uint16_t    PH_MEMLOC_REM wBlockSize;
+    uint8_t *   PH_MEMLOC_REM pRxBuffer;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+
+    /* Number of wNumBlocks can't be zero and doesn't exceed 256 */
+    if ((wNumBlocks == 0) || (((uint16_t)bBlockNo + wNumBlocks) > 0x100))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_I15693);
+    }
+
+    /* Each tag has to provide whole blocks */
+    for (wIndex = 0; wIndex < wNumTags; ++wIndex)
+    {
+        if ((pTags[wIndex].wDataBufSize == 0) || (pTags[wIndex].wDataBufSize % wNumBlocks))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_I15693);
+        }
+    }
+
+    /* Flags and timeout are the same for all tags */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalI15693_Sw_Int_GroupStart(
+        pDataParams,
+        bOption,
+        PHPAL_SLI15693_TIMEOUT_LONG_US,
+        &wFlags,
+        aUid,
+        &bUidLength));
+
+    bCommand[0] = PHAL_I15693_SW_CMD_WRITE_SINGLE_BLOCK;
+
+    for (wIndex = 0; wIndex < wNumTags; ++wIndex)
+    {
+        pTags[wIndex].wDataLength = 0;
+        wBlockSize = pTags[wIndex].wDataBufSize / wNumBlocks;
+
+        /* Address the tag */
+        status = phpalSli15693_SetSerialNo(
+            pDataParams->pPalSli15693DataParams,
+            pTags[wIndex].pUid,
+            PHPAL_SLI15693_UID_LENGTH);
+
+        for (wBlock = 0; (wBlock < wNumBlocks) && ((status & PH_ERR_MASK) == PH_ERR_SUCCESS); ++wBlock)
+        {
+            bCommand[1] = (uint8_t)(bBlockNo + wBlock);
+
+            /* The EOF of the write-alike handling changes the timeout */
+            if (bOption != PHAL_I15693_OPTION_OFF)
+            {
+                status = phpalSli15693_SetConfig(
+                    pDataParams->pPalSli15693DataParams,
+                    PHPAL_SLI15693_CONFIG_TIMEOUT_US,
+                    PHPAL_SLI15693_TIMEOUT_LONG_US);
+            }
+
+            if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+            {
+                status = phpalSli15693_Exchange(
+                    pDataParams->pPalSli15693DataParams,
+                    PH_EXCHANGE_BUFFER_FIRST,
+                    bCommand,
+                    2,
+                    NULL,
+                    NULL);
+            }
+
+            if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+            {
+                /* Append the block data */
+                status = phpalSli15693_Exchange(
+                    pDataParams->pPalSli15693DataParams,
+                    PH_EXCHANGE_BUFFER_LAST,
+                    &pTags[wIndex].pData[pTags[wIndex].wDataLength],
+                    wBlockSize,
+                    &pRxBuffer,
+                    &wRxLength);
+
+                /* Write-alike handling */
+                if (bOption != PHAL_I15693_OPTION_OFF)
+                {
+                    status = phalI15693_Sw_WriteAlikeHandling(pDataParams, status);
+                }
+            }
+
+            if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+            {
+                pTags[wIndex].wDataLength = pTags[wIndex].wDataLength + wBlockSize;
+            }
+        }
+
+        /* A failing tag does not stop the group */
+        pTags[wIndex].wStatus = status;
+    }
+
+    return phalI15693_Sw_Int_GroupStop(pDataParams, wFlags, aUid, bUidLength);
+}
+
 phStatus_t phalI15693_Sw_WriteAlikeHandling(
     phalI15693_Sw_DataParams_t * pDataParams,
     phStatus_t wExchangeStatus
@@ -1155,4 +1359,80 @@ phStatus_t phalI15693_Sw_Int_SetOptionBit(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_I15693);
 }
 
+
+phStatus_t phalI15693_Sw_Int_GroupStart(
+    phalI15693_Sw_DataParams_t * pDataParams,
+    uint8_t bOption,
+    uint16_t wTimeoutUs,
+    uint16_t * pFlags,
+    uint8_t * pUid,
+    uint8_t * pUidLength
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wFlags;
+
+    if ((bOption != PHAL_I15693_OPTION_OFF) && (bOption != PHAL_I15693_OPTION_ON))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_I15693);
+    }
+
+    /* retrieve the flags byte */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_GetConfig(
+        pDataParams->pPalSli15693DataParams,
+        PHPAL_SLI15693_CONFIG_FLAGS,
+        pFlags));
+
+    /* remember the UID, if any, so a selected or addressed tag stays usable */
+    if ((phpalSli15693_GetSerialNo(pDataParams->pPalSli15693DataParams, pUid, pUidLength) & PH_ERR_MASK) != PH_ERR_SUCCESS)
+    {
+        *pUidLength = 0;
+    }
+
+    /* all tags of the group are addressed by their UID */
+    wFlags = (uint16_t)(*pFlags | PHPAL_SLI15693_FLAG_ADDRESSED) & (uint16_t)~(uint16_t)(PHPAL_SLI15693_FLAG_SELECTED | PHPAL_SLI15693_FLAG_OPTION);
+    if (bOption != PHAL_I15693_OPTION_OFF)
+    {
+        wFlags |= PHPAL_SLI15693_FLAG_OPTION;
+    }
+
+    if (wFlags != *pFlags)
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_SetConfig(
+            pDataParams->pPalSli15693DataParams,
+            PHPAL_SLI15693_CONFIG_FLAGS,
+            wFlags));
+    }
+
+    return phpalSli15693_SetConfig(
+        pDataParams->pPalSli15693DataParams,
+        PHPAL_SLI15693_CONFIG_TIMEOUT_US,
+        wTimeoutUs);
+}
+
+phStatus_t phalI15693_Sw_Int_GroupStop(
+    phalI15693_Sw_DataParams_t * pDataParams,
+    uint16_t wFlags,
+    uint8_t * pUid,
+    uint8_t bUidLength
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_SetConfig(
+        pDataParams->pPalSli15693DataParams,
+        PHPAL_SLI15693_CONFIG_FLAGS,
+        wFlags));
+
+    if (bUidLength != 0)
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_SetSerialNo(
+            pDataParams->pPalSli15693DataParams,
+            pUid,
+            bUidLength));
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_I15693);
+}
+
 #endif
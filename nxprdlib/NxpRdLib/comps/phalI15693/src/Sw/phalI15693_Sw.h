@@ -158,4 +158,22 @@ phStatus_t phalI15693_Sw_ExtendedGetMultipleBlockSecurityStatus(
     uint16_t * pRxLength
     );
 
+phStatus_t phalI15693_Sw_GroupReadMultipleBlocks(
+    phalI15693_Sw_DataParams_t * pDataParams,
+    uint8_t bOption,
+    uint8_t bBlockNo,
+    uint16_t wNumBlocks,
+    phalI15693_GroupTag_t * pTags,
+    uint16_t wNumTags
+    );
+
+phStatus_t phalI15693_Sw_GroupWriteBlocks(
+    phalI15693_Sw_DataParams_t * pDataParams,
+    uint8_t bOption,
+    uint8_t bBlockNo,
+    uint16_t wNumBlocks,
+    phalI15693_GroupTag_t * pTags,
+    uint16_t wNumTags
+    );
+
 #endif /* PHALI15693_SW_H */
@@ -79,4 +79,35 @@ phStatus_t phalI15693_Sw_Int_SetOptionBit(
     uint8_t bOption                             /**< [In] Option flag; \c #PH_OFF: disable; \c #PH_ON: enable. */
     );
 
+/**
+* \brief Prepares the \ref phpalSli15693 layer for a group operation.
+*
+* Saves the current request flags and UID, then sets the addressed and option
+* flags and the timeout used for all tags of the group.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalI15693_Sw_Int_GroupStart(
+    phalI15693_Sw_DataParams_t * pDataParams,   /**< [In] Pointer to this layers parameter structure. */
+    uint8_t bOption,                            /**< [In] Option flag; \c #PH_OFF: disable; \c #PH_ON: enable. */
+    uint16_t wTimeoutUs,                        /**< [In] Timeout used for the group. */
+    uint16_t * pFlags,                          /**< [Out] Saved request flags. */
+    uint8_t * pUid,                             /**< [Out] Saved UID. */
+    uint8_t * pUidLength                        /**< [Out] Length of the saved UID; 0 if none was set. */
+    );
+
+/**
+* \brief Restores the request flags and UID saved by \ref phalI15693_Sw_Int_GroupStart.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalI15693_Sw_Int_GroupStop(
+    phalI15693_Sw_DataParams_t * pDataParams,   /**< [In] Pointer to this layers parameter structure. */
+    uint16_t wFlags,                            /**< [In] Saved request flags. */
+    uint8_t * pUid,                             /**< [In] Saved UID. */
+    uint8_t bUidLength                          /**< [In] Length of the saved UID. */
+    );
+
 #endif /* PHALI15693_SW_INT_H */
@@ -1036,6 +1036,122 @@ phStatus_t phalI15693_ExtendedGetMultipleBlockSecurityStatus (
     return status;
 }
 
+phStatus_t phalI15693_GroupReadMultipleBlocks (
+                                          void * pDataParams,
+                                          uint8_t bOption,
+                                          uint8_t bBlockNo,
+                                          uint16_t wNumBlocks,
+                                          phalI15693_GroupTag_t * pTags,
+                                          uint16_t wNumTags
+                                          )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalI15693_GroupReadMultipleBlocks");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bOption);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bBlockNo);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wNumBlocks);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wNumTags);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_INFO, bOption_log, &bOption);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_INFO, bBlockNo_log, &bBlockNo);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, wNumBlocks_log, &wNumBlocks);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, wNumTags_log, &wNumTags);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+    if (wNumTags) PH_ASSERT_NULL (pTags);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_I15693)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_I15693);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return status;
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_I15693_SW
+    case PHAL_I15693_SW_ID:
+        status = phalI15693_Sw_GroupReadMultipleBlocks ((phalI15693_Sw_DataParams_t *)pDataParams, bOption, bBlockNo, wNumBlocks, pTags, wNumTags);
+        break;
+#endif /* NXPBUILD__PHAL_I15693_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_I15693);
+        break;
+    }
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalI15693_GroupWriteBlocks (
+                                          void * pDataParams,
+                                          uint8_t bOption,
+                                          uint8_t bBlockNo,
+                                          uint16_t wNumBlocks,
+                                          phalI15693_GroupTag_t * pTags,
+                                          uint16_t wNumTags
+                                          )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalI15693_GroupWriteBlocks");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bOption);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bBlockNo);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wNumBlocks);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wNumTags);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_INFO, bOption_log, &bOption);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_INFO, bBlockNo_log, &bBlockNo);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, wNumBlocks_log, &wNumBlocks);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, wNumTags_log, &wNumTags);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+    if (wNumTags) PH_ASSERT_NULL (pTags);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_I15693)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_I15693);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return status;
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_I15693_SW
+    case PHAL_I15693_SW_ID:
+        status = phalI15693_Sw_GroupWriteBlocks ((phalI15693_Sw_DataParams_t *)pDataParams, bOption, bBlockNo, wNumBlocks, pTags, wNumTags);
+        break;
+#endif /* NXPBUILD__PHAL_I15693_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_I15693);
+        break;
+    }
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
 #endif /* NXPRDLIB_REM_GEN_INTFS */
 
 #endif /* NXPBUILD__PHAL_I15693 */
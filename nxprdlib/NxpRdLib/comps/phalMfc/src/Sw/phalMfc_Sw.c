@@ -29,12 +29,35 @@
 #include <phpalMifare.h>
 #include <ph_RefDefs.h>
 #include <phKeyStore.h>
+#include <phpalI14443p3a.h>
 
 #ifdef NXPBUILD__PHAL_MFC_SW
 
 #include "phalMfc_Sw.h"
 #include "../phalMfc_Int.h"
 
+static uint8_t phalMfc_Sw_Int_GetSector(
+                                        uint8_t bBlockNo
+                                        );
+
+static void phalMfc_Sw_Int_GetSectorLayout(
+                                           uint8_t bSector,
+                                           uint8_t * pFirstBlock,
+                                           uint8_t * pNumBlocks
+                                           );
+
+static phStatus_t phalMfc_Sw_Int_AuthenticateSector(
+                                                    phalMfc_Sw_DataParams_t * pDataParams,
+                                                    void * pPalI14443p3aDataParams,
+                                                    uint8_t bSector,
+                                                    uint8_t bKeyType,
+                                                    uint16_t * pKeyNumbers,
+                                                    uint8_t bNumKeys,
+                                                    uint16_t wKeyVersion,
+                                                    uint8_t * pUid,
+                                                    uint8_t bUidLength
+                                                    );
+
 phStatus_t phalMfc_Sw_Init(
                            phalMfc_Sw_DataParams_t * pDataParams,
                            uint16_t wSizeOfDataParams,
@@ -53,6 +76,11 @@ phStatus_t phalMfc_Sw_Init(
     pDataParams->wId                    = PH_COMP_AL_MFC | PHAL_MFC_SW_ID;
     pDataParams->pPalMifareDataParams   = pPalMifareDataParams;
     pDataParams->pKeyStoreDataParams    = pKeyStoreDataParams;
+    pDataParams->bAuthSector            = PHAL_MFC_SECTOR_NONE;
+    pDataParams->bAuthKeyType           = 0;
+    pDataParams->wAuthKeyNo             = 0;
+    pDataParams->wAuthKeyVersion        = 0;
+    pDataParams->bKeyIndex              = 0;
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
 }
@@ -67,16 +95,20 @@ phStatus_t phalMfc_Sw_Authenticate(
                                    uint8_t bUidLength
                                    )
 {
+    phStatus_t  PH_MEMLOC_REM status;
     phStatus_t  PH_MEMLOC_REM statusTmp;
     uint8_t     PH_MEMLOC_REM aKey[PHHAL_HW_MFC_KEY_LENGTH * 2];
     uint8_t *   PH_MEMLOC_REM pKey;
     uint16_t    PH_MEMLOC_REM bKeystoreKeyType;
 
+    /* Any previous Crypto1 session ends with this authentication */
+    pDataParams->bAuthSector = PHAL_MFC_SECTOR_NONE;
+
     /* check if software key store is available. */
     if (pDataParams->pKeyStoreDataParams == NULL)
     {
         /* There is no software keystore available. */
-        return phpalMifare_MfcAuthenticateKeyNo(
+        status = phpalMifare_MfcAuthenticateKeyNo(
             pDataParams->pPalMifareDataParams,
             bBlockNo,
             bKeyType,
@@ -125,13 +157,25 @@ phStatus_t phalMfc_Sw_Authenticate(
             return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_HAL);
         }
 
-        return phpalMifare_MfcAuthenticate(
+        status = phpalMifare_MfcAuthenticate(
             pDataParams->pPalMifareDataParams,
             bBlockNo,
             bKeyType,
             pKey,
             &pUid[bUidLength - 4]);
     }
+
+    /* Remember the Crypto1 session for the sector functions */
+    if (status == PH_ERR_SUCCESS)
+    {
+        pDataParams->bAuthSector = phalMfc_Sw_Int_GetSector(bBlockNo);
+        pDataParams->bAuthKeyType = (uint8_t)(bKeyType & 0x7F);
+        pDataParams->wAuthKeyNo = wKeyNo;
+        pDataParams->wAuthKeyVersion = wKeyVersion;
+        memcpy(pDataParams->aAuthUid, &pUid[bUidLength - 4], 4);  /* PRQA S 3200 */
+    }
+
+    return status;
 }
 
 phStatus_t phalMfc_Sw_Read(
@@ -150,14 +194,21 @@ phStatus_t phalMfc_Sw_Read(
     aCommand[1] = bBlockNo;
 
     /* transmit the command frame */
-    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+    statusTmp = phpalMifare_ExchangeL3(
         pDataParams->pPalMifareDataParams,
         PH_EXCHANGE_DEFAULT,
         aCommand,
         2,
         &pRxBuffer,
         &wRxLength
-        ));
+        );
+
+    /* The card halts on a NAK, the Crypto1 session is lost */
+    if (statusTmp != PH_ERR_SUCCESS)
+    {
+        pDataParams->bAuthSector = PHAL_MFC_SECTOR_NONE;
+        return statusTmp;
+    }
 
     /* check received length */
     if (wRxLength != PHAL_MFC_DATA_BLOCK_LENGTH)
@@ -210,24 +261,34 @@ phStatus_t phalMfc_Sw_Write(
     aCommand[1] = bBlockNo;
 
     /* transmit the command frame (first part) */
-    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+    statusTmp = phpalMifare_ExchangeL3(
         pDataParams->pPalMifareDataParams,
         PH_EXCHANGE_DEFAULT,
         aCommand,
         2,
         &pRxBuffer,
         &wRxLength
-        ));
+        );
 
-    /* transmit the data (second part) */
-    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
-        pDataParams->pPalMifareDataParams,
-        PH_EXCHANGE_DEFAULT,
-        pBlockData,
-        PHAL_MFC_DATA_BLOCK_LENGTH,
-        &pRxBuffer,
-        &wRxLength
-        ));
+    if (statusTmp == PH_ERR_SUCCESS)
+    {
+        /* transmit the data (second part) */
+        statusTmp = phpalMifare_ExchangeL3(
+            pDataParams->pPalMifareDataParams,
+            PH_EXCHANGE_DEFAULT,
+            pBlockData,
+            PHAL_MFC_DATA_BLOCK_LENGTH,
+            &pRxBuffer,
+            &wRxLength
+            );
+    }
+
+    /* The card halts on a NAK, the Crypto1 session is lost */
+    if (statusTmp != PH_ERR_SUCCESS)
+    {
+        pDataParams->bAuthSector = PHAL_MFC_SECTOR_NONE;
+        return statusTmp;
+    }
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
 }
@@ -392,4 +453,275 @@ phStatus_t phalMfc_Sw_GetVersion(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
 }
 
+phStatus_t phalMfc_Sw_ReadSectors(
+                                  phalMfc_Sw_DataParams_t * pDataParams,
+                                  void * pPalI14443p3aDataParams,
+                                  uint8_t * pSectors,
+                                  uint8_t bNumSectors,
+                                  uint8_t bKeyType,
+                                  uint16_t * pKeyNumbers,
+                                  uint8_t bNumKeys,
+                                  uint16_t wKeyVersion,
+                                  uint8_t * pUid,
+                                  uint8_t bUidLength,
+                                  uint8_t * pData
+                                  )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+    uint8_t     PH_MEMLOC_COUNT bBlock;
+    uint8_t     PH_MEMLOC_REM bFirstBlock;
+    uint8_t     PH_MEMLOC_REM bNumBlocks;
+    uint16_t    PH_MEMLOC_REM wOffset = 0;
+
+    if ((bNumKeys == 0) || (bUidLength < 4))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    for (bIndex = 0; bIndex < bNumSectors; bIndex++)
+    {
+        if (pSectors[bIndex] >= PHAL_MFC_MAX_SECTORS)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+        }
+
+        phalMfc_Sw_Int_GetSectorLayout(pSectors[bIndex], &bFirstBlock, &bNumBlocks);
+
+        /* One authentication per sector, reused if the sector is still authenticated */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_Int_AuthenticateSector(
+            pDataParams,
+            pPalI14443p3aDataParams,
+            pSectors[bIndex],
+            bKeyType,
+            pKeyNumbers,
+            bNumKeys,
+            wKeyVersion,
+            pUid,
+            bUidLength));
+
+        for (bBlock = 0; bBlock < bNumBlocks; bBlock++)
+        {
+            PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_Read(
+                pDataParams,
+                (uint8_t)(bFirstBlock + bBlock),
+                &pData[wOffset]));
+
+            wOffset += PHAL_MFC_DATA_BLOCK_LENGTH;
+        }
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+}
+
+phStatus_t phalMfc_Sw_WriteSectors(
+                                   phalMfc_Sw_DataParams_t * pDataParams,
+                                   void * pPalI14443p3aDataParams,
+                                   uint8_t * pSectors,
+                                   uint8_t bNumSectors,
+                                   uint8_t bKeyType,
+                                   uint16_t * pKeyNumbers,
+                                   uint8_t bNumKeys,
+                                   uint16_t wKeyVersion,
+                                   uint8_t * pUid,
+                                   uint8_t bUidLength,
+                                   uint8_t * pData
+                                   )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+    uint8_t     PH_MEMLOC_COUNT bBlock;
+    uint8_t     PH_MEMLOC_REM bFirstBlock;
+    uint8_t     PH_MEMLOC_REM bNumBlocks;
+    uint16_t    PH_MEMLOC_REM wOffset = 0;
+
+    if ((bNumKeys == 0) || (bUidLength < 4))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    for (bIndex = 0; bIndex < bNumSectors; bIndex++)
+    {
+        if (pSectors[bIndex] >= PHAL_MFC_MAX_SECTORS)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+        }
+
+        phalMfc_Sw_Int_GetSectorLayout(pSectors[bIndex], &bFirstBlock, &bNumBlocks);
+
+        /* One authentication per sector, reused if the sector is still authenticated */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_Int_AuthenticateSector(
+            pDataParams,
+            pPalI14443p3aDataParams,
+            pSectors[bIndex],
+            bKeyType,
+            pKeyNumbers,
+            bNumKeys,
+            wKeyVersion,
+            pUid,
+            bUidLength));
+
+        for (bBlock = 0; bBlock < bNumBlocks; bBlock++)
+        {
+            /* Manufacturer block and sector trailers are not written */
+            if (((bFirstBlock + bBlock) != 0) && (bBlock != (bNumBlocks - 1)))
+            {
+                PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_Write(
+                    pDataParams,
+                    (uint8_t)(bFirstBlock + bBlock),
+                    &pData[wOffset]));
+            }
+
+            wOffset += PHAL_MFC_DATA_BLOCK_LENGTH;
+        }
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+}
+
+static uint8_t phalMfc_Sw_Int_GetSector(
+                                        uint8_t bBlockNo
+                                        )
+{
+    /* Sectors 0 - 31 have 4 blocks, sectors 32 - 39 have 16 blocks */
+    if (bBlockNo < (PHAL_MFC_SMALL_SECTORS * 4))
+    {
+        return (uint8_t)(bBlockNo / 4);
+    }
+    return (uint8_t)(PHAL_MFC_SMALL_SECTORS + ((bBlockNo - (PHAL_MFC_SMALL_SECTORS * 4)) / 16));
+}
+
+static void phalMfc_Sw_Int_GetSectorLayout(
+                                           uint8_t bSector,
+                                           uint8_t * pFirstBlock,
+                                           uint8_t * pNumBlocks
+                                           )
+{
+    if (bSector < PHAL_MFC_SMALL_SECTORS)
+    {
+        *pFirstBlock = (uint8_t)(bSector * 4);
+        *pNumBlocks = 4;
+    }
+    else
+    {
+        *pFirstBlock = (uint8_t)((PHAL_MFC_SMALL_SECTORS * 4) + ((bSector - PHAL_MFC_SMALL_SECTORS) * 16));
+        *pNumBlocks = 16;
+    }
+}
+
+static phStatus_t phalMfc_Sw_Int_AuthenticateSector(
+                                                    phalMfc_Sw_DataParams_t * pDataParams,
+                                                    void * pPalI14443p3aDataParams,
+                                                    uint8_t bSector,
+                                                    uint8_t bKeyType,
+                                                    uint16_t * pKeyNumbers,
+                                                    uint8_t bNumKeys,
+                                                    uint16_t wKeyVersion,
+                                                    uint8_t * pUid,
+                                                    uint8_t bUidLength
+                                                    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wCrypto1Disabled;
+    uint8_t     PH_MEMLOC_COUNT bTrial;
+    uint8_t     PH_MEMLOC_REM bKeyIndex;
+    uint8_t     PH_MEMLOC_REM bFirstBlock;
+    uint8_t     PH_MEMLOC_REM bNumBlocks;
+#ifdef NXPBUILD__PHPAL_I14443P3A
+    uint8_t     PH_MEMLOC_REM aUidOut[10];
+    uint8_t     PH_MEMLOC_REM bUidOutLength;
+    uint8_t     PH_MEMLOC_REM bSak;
+    uint8_t     PH_MEMLOC_REM bMoreCards;
+#endif /* NXPBUILD__PHPAL_I14443P3A */
+
+    /* Reuse the Crypto1 session if the sector is authenticated with one of the candidate keys */
+    if ((pDataParams->bAuthSector == bSector) &&
+        (pDataParams->bAuthKeyType == (uint8_t)(bKeyType & 0x7F)) &&
+        (pDataParams->wAuthKeyVersion == wKeyVersion) &&
+        (memcmp(pDataParams->aAuthUid, &pUid[bUidLength - 4], 4) == 0))
+    {
+        for (bKeyIndex = 0; bKeyIndex < bNumKeys; bKeyIndex++)
+        {
+            if (pKeyNumbers[bKeyIndex] == pDataParams->wAuthKeyNo)
+            {
+                break;
+            }
+        }
+
+        if (bKeyIndex < bNumKeys)
+        {
+            /* The session is gone if the card was reactivated in between */
+            PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_GetConfig(
+                ((phpalMifare_Sw_DataParams_t *)(pDataParams->pPalMifareDataParams))->pHalDataParams,
+                PHHAL_HW_CONFIG_DISABLE_MF_CRYPTO1,
+                &wCrypto1Disabled));
+
+            if (wCrypto1Disabled == PH_OFF)
+            {
+                return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+            }
+        }
+    }
+
+    phalMfc_Sw_Int_GetSectorLayout(bSector, &bFirstBlock, &bNumBlocks);
+
+    /* Start with the key which authenticated last, cards of a system mostly share keys */
+    if (pDataParams->bKeyIndex >= bNumKeys)
+    {
+        pDataParams->bKeyIndex = 0;
+    }
+
+    status = PH_ADD_COMPCODE(PH_ERR_AUTH_ERROR, PH_COMP_AL_MFC);
+    for (bTrial = 0; bTrial < bNumKeys; bTrial++)
+    {
+        bKeyIndex = (uint8_t)((pDataParams->bKeyIndex + bTrial) % bNumKeys);
+
+        if (bTrial != 0)
+        {
+#ifdef NXPBUILD__PHPAL_I14443P3A
+            if (pPalI14443p3aDataParams == NULL)
+            {
+                break;
+            }
+
+            /* The card halts on a failed authentication, wake it up and select it again */
+            PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p3a_ActivateCard(
+                pPalI14443p3aDataParams,
+                pUid,
+                bUidLength,
+                aUidOut,
+                &bUidOutLength,
+                &bSak,
+                &bMoreCards));
+#else
+            break;
+#endif /* NXPBUILD__PHPAL_I14443P3A */
+        }
+
+        status = phalMfc_Sw_Authenticate(
+            pDataParams,
+            (uint8_t)(bFirstBlock + bNumBlocks - 1),
+            bKeyType,
+            pKeyNumbers[bKeyIndex],
+            wKeyVersion,
+            pUid,
+            bUidLength);
+
+        if (status == PH_ERR_SUCCESS)
+        {
+            pDataParams->bKeyIndex = bKeyIndex;
+            break;
+        }
+
+        /* Only a wrong key is worth trying the next candidate */
+        if ((status & PH_ERR_MASK) != PH_ERR_AUTH_ERROR)
+        {
+            break;
+        }
+    }
+
+    return status;
+}
+
 #endif /* NXPBUILD__PHAL_MFC_SW */
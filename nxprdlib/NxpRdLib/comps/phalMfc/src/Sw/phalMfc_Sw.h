@@ -117,4 +117,32 @@ phStatus_t phalMfc_Sw_GetVersion(
                                      uint8_t * pVersion
                                      );
 
+phStatus_t phalMfc_Sw_ReadSectors(
+                                  phalMfc_Sw_DataParams_t * pDataParams,
+                                  void * pPalI14443p3aDataParams,
+                                  uint8_t * pSectors,
+                                  uint8_t bNumSectors,
+                                  uint8_t bKeyType,
+                                  uint16_t * pKeyNumbers,
+                                  uint8_t bNumKeys,
+                                  uint16_t wKeyVersion,
+                                  uint8_t * pUid,
+                                  uint8_t bUidLength,
+                                  uint8_t * pData
+                                  );
+
+phStatus_t phalMfc_Sw_WriteSectors(
+                                   phalMfc_Sw_DataParams_t * pDataParams,
+                                   void * pPalI14443p3aDataParams,
+                                   uint8_t * pSectors,
+                                   uint8_t bNumSectors,
+                                   uint8_t bKeyType,
+                                   uint16_t * pKeyNumbers,
+                                   uint8_t bNumKeys,
+                                   uint16_t wKeyVersion,
+                                   uint8_t * pUid,
+                                   uint8_t bUidLength,
+                                   uint8_t * pData
+                                   );
+
 #endif /* PHALMFC_SW_H */
@@ -796,6 +796,144 @@ phStatus_t phalMfc_GetVersion(
     return status;
 }
 
+phStatus_t phalMfc_ReadSectors(
+                               void * pDataParams,
+                               void * pPalI14443p3aDataParams,
+                               uint8_t * pSectors,
+                               uint8_t bNumSectors,
+                               uint8_t bKeyType,
+                               uint16_t * pKeyNumbers,
+                               uint8_t bNumKeys,
+                               uint16_t wKeyVersion,
+                               uint8_t * pUid,
+                               uint8_t bUidLength,
+                               uint8_t * pData
+                               )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfc_ReadSectors");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pSectors);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bKeyType);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pKeyNumbers);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyVersion);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pSectors_log, pSectors, bNumSectors);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bKeyType_log, &bKeyType);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pKeyNumbers_log, pKeyNumbers, (uint16_t)(bNumKeys * 2));
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyVersion_log, &wKeyVersion);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pUid_log, pUid, bUidLength);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+    PH_ASSERT_NULL (pSectors);
+    PH_ASSERT_NULL (pKeyNumbers);
+    PH_ASSERT_NULL (pUid);
+    PH_ASSERT_NULL (pData);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFC)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return status;
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFC_SW
+    case PHAL_MFC_SW_ID:
+        status = phalMfc_Sw_ReadSectors((phalMfc_Sw_DataParams_t *)pDataParams, pPalI14443p3aDataParams, pSectors, bNumSectors,
+            bKeyType, pKeyNumbers, bNumKeys, wKeyVersion, pUid, bUidLength, pData);
+        break;
+#endif /* NXPBUILD__PHAL_MFC_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalMfc_WriteSectors(
+                                void * pDataParams,
+                                void * pPalI14443p3aDataParams,
+                                uint8_t * pSectors,
+                                uint8_t bNumSectors,
+                                uint8_t bKeyType,
+                                uint16_t * pKeyNumbers,
+                                uint8_t bNumKeys,
+                                uint16_t wKeyVersion,
+                                uint8_t * pUid,
+                                uint8_t bUidLength,
+                                uint8_t * pData
+                                )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfc_WriteSectors");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pSectors);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bKeyType);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pKeyNumbers);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyVersion);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pSectors_log, pSectors, bNumSectors);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bKeyType_log, &bKeyType);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pKeyNumbers_log, pKeyNumbers, (uint16_t)(bNumKeys * 2));
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyVersion_log, &wKeyVersion);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pUid_log, pUid, bUidLength);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+    PH_ASSERT_NULL (pSectors);
+    PH_ASSERT_NULL (pKeyNumbers);
+    PH_ASSERT_NULL (pUid);
+    PH_ASSERT_NULL (pData);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFC)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return status;
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFC_SW
+    case PHAL_MFC_SW_ID:
+        status = phalMfc_Sw_WriteSectors((phalMfc_Sw_DataParams_t *)pDataParams, pPalI14443p3aDataParams, pSectors, bNumSectors,
+            bKeyType, pKeyNumbers, bNumKeys, wKeyVersion, pUid, bUidLength, pData);
+        break;
+#endif /* NXPBUILD__PHAL_MFC_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
 #endif /* NXPRDLIB_REM_GEN_INTFS */
 
 #endif /* NXPBUILD__PHAL_MFC */
@@ -18,6 +18,8 @@
 #include <string.h>
 #include <phTools.h>
 #include <phKeyStore.h>
+#include <phCryptoSym.h>
+#include <phCryptoRng.h>
 
 
 #ifdef NXPBUILD__PHAL_MFDF_SW
@@ -72,6 +74,187 @@ phStatus_t phalMfdf_Sw_Init(
 }
 
 
+/**
+* Security related commands
+*/
+phStatus_t phalMfdf_Sw_AuthenticateAes(
+                                       phalMfdf_Sw_DataParams_t * pDataParams,
+                                       uint16_t wOption,
+                                       uint16_t wKeyNo,
+                                       uint16_t wKeyVer,
+                                       uint8_t bKeyNoCard,
+                                       uint8_t * pDivInput,
+                                       uint8_t bDivLen
+                                       )
+{
+#if defined(NXPBUILD__PH_CRYPTOSYM) && defined(NXPBUILD__PH_CRYPTORNG) && defined(NXPBUILD__PH_KEYSTORE)
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bCmdBuff[1 + (2 * PH_CRYPTOSYM_AES_BLOCK_SIZE)];
+    uint8_t     PH_MEMLOC_REM bKey[PHAL_MFDF_AES128_KEY_SIZE];
+    uint8_t     PH_MEMLOC_REM bRndA[PH_CRYPTOSYM_AES_BLOCK_SIZE];
+    uint8_t     PH_MEMLOC_REM bRndB[PH_CRYPTOSYM_AES_BLOCK_SIZE];
+    uint8_t     PH_MEMLOC_REM bIv[PH_CRYPTOSYM_AES_BLOCK_SIZE];
+    uint16_t    PH_MEMLOC_REM wKeyType;
+    uint16_t    PH_MEMLOC_REM wRxlen;
+    uint8_t     PH_MEMLOC_REM * pRecv;
+
+    PHAL_MFDF_UNUSED_VARIABLE(pDivInput)
+    PHAL_MFDF_UNUSED_VARIABLE(bDivLen)
+
+    if (wOption != PHAL_MFDF_NO_DIVERSIFICATION)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_AL_MFDF);
+    }
+    if (bKeyNoCard > 0x0D)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFDF);
+    }
+    if ((pDataParams->pKeyStoreDataParams == NULL) ||
+        (pDataParams->pCryptoDataParamsEnc == NULL) ||
+        (pDataParams->pCryptoRngDataParams == NULL))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_MFDF);
+    }
+
+    /* Any previous authentication is lost from here on */
+    phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phKeyStore_GetKey(
+        pDataParams->pKeyStoreDataParams,
+        wKeyNo,
+        wKeyVer,
+        (uint8_t)sizeof(bKey),
+        bKey,
+        &wKeyType));
+    if (wKeyType != PH_KEYSTORE_KEY_TYPE_AES128)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_KEY, PH_COMP_AL_MFDF);
+    }
+
+    statusTmp = phCryptoSym_LoadKeyDirect(pDataParams->pCryptoDataParamsEnc, bKey, PH_CRYPTOSYM_KEY_TYPE_AES128);
+    memset(bKey, 0x00, sizeof(bKey)); /* PRQA S 3200 */
+    PH_CHECK_SUCCESS(statusTmp);
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_SetConfig(
+        pDataParams->pCryptoDataParamsEnc,
+        PH_CRYPTOSYM_CONFIG_KEEP_IV,
+        PH_CRYPTOSYM_VALUE_KEEP_IV_OFF));
+
+    /* Part 1: PICC returns ek(RndB) */
+    bCmdBuff[0] = PHAL_MFDF_CMD_AUTHENTICATE_AES;
+    bCmdBuff[1] = bKeyNoCard;
+    status = phalMfdf_ExchangeCmd(
+        pDataParams,
+        pDataParams->pPalMifareDataParams,
+        pDataParams->bWrappedMode,
+        bCmdBuff,
+        2,
+        &pRecv,
+        &wRxlen
+        );
+    if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS_CHAINING)
+    {
+        (void)phCryptoSym_InvalidateKey(pDataParams->pCryptoDataParamsEnc);
+        return ((status & PH_ERR_MASK) == PH_ERR_SUCCESS) ? PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF) : status;
+    }
+    if (wRxlen != PH_CRYPTOSYM_AES_BLOCK_SIZE)
+    {
+        (void)phCryptoSym_InvalidateKey(pDataParams->pCryptoDataParamsEnc);
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+    }
+    memcpy(bIv, pRecv, PH_CRYPTOSYM_AES_BLOCK_SIZE); /* PRQA S 3200 */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Decrypt(
+        pDataParams->pCryptoDataParamsEnc,
+        PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        bIv,
+        PH_CRYPTOSYM_AES_BLOCK_SIZE,
+        bRndB));
+
+    /* Part 2: send ek(RndA || RndB'), chained on ek(RndB) */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoRng_Rnd(pDataParams->pCryptoRngDataParams, PH_CRYPTOSYM_AES_BLOCK_SIZE, bRndA));
+    bCmdBuff[0] = PHAL_MFDF_RESP_ADDITIONAL_FRAME;
+    memcpy(&bCmdBuff[1], bRndA, PH_CRYPTOSYM_AES_BLOCK_SIZE); /* PRQA S 3200 */
+    memcpy(&bCmdBuff[1 + PH_CRYPTOSYM_AES_BLOCK_SIZE], &bRndB[1], PH_CRYPTOSYM_AES_BLOCK_SIZE - 1); /* PRQA S 3200 */
+    bCmdBuff[2 * PH_CRYPTOSYM_AES_BLOCK_SIZE] = bRndB[0];
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_LoadIv(pDataParams->pCryptoDataParamsEnc, bIv, PH_CRYPTOSYM_AES_BLOCK_SIZE));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Encrypt(
+        pDataParams->pCryptoDataParamsEnc,
+        PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        &bCmdBuff[1],
+        2 * PH_CRYPTOSYM_AES_BLOCK_SIZE,
+        &bCmdBuff[1]));
+    memcpy(bIv, &bCmdBuff[1 + PH_CRYPTOSYM_AES_BLOCK_SIZE], PH_CRYPTOSYM_AES_BLOCK_SIZE); /* PRQA S 3200 */
+
+    status = phalMfdf_ExchangeCmd(
+        pDataParams,
+        pDataParams->pPalMifareDataParams,
+        pDataParams->bWrappedMode,
+        bCmdBuff,
+        1 + (2 * PH_CRYPTOSYM_AES_BLOCK_SIZE),
+        &pRecv,
+        &wRxlen
+        );
+    if (((status & PH_ERR_MASK) != PH_ERR_SUCCESS) || (wRxlen != PH_CRYPTOSYM_AES_BLOCK_SIZE))
+    {
+        (void)phCryptoSym_InvalidateKey(pDataParams->pCryptoDataParamsEnc);
+        return ((status & PH_ERR_MASK) == PH_ERR_SUCCESS) ? PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF) : status;
+    }
+
+    /* Part 3: PICC proves knowledge of the key with ek(RndA') */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_LoadIv(pDataParams->pCryptoDataParamsEnc, bIv, PH_CRYPTOSYM_AES_BLOCK_SIZE));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Decrypt(
+        pDataParams->pCryptoDataParamsEnc,
+        PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        pRecv,
+        PH_CRYPTOSYM_AES_BLOCK_SIZE,
+        bIv));
+    if ((memcmp(bIv, &bRndA[1], PH_CRYPTOSYM_AES_BLOCK_SIZE - 1) != 0) ||
+        (bIv[PH_CRYPTOSYM_AES_BLOCK_SIZE - 1] != bRndA[0]))
+    {
+        (void)phCryptoSym_InvalidateKey(pDataParams->pCryptoDataParamsEnc);
+        memset(bRndA, 0x00, sizeof(bRndA)); /* PRQA S 3200 */
+        memset(bRndB, 0x00, sizeof(bRndB)); /* PRQA S 3200 */
+        return PH_ADD_COMPCODE(PH_ERR_AUTH_ERROR, PH_COMP_AL_MFDF);
+    }
+
+    /* Session key RndA[0..3] || RndB[0..3] || RndA[12..15] || RndB[12..15] */
+    memcpy(&pDataParams->bSessionKey[0], &bRndA[0], 4); /* PRQA S 3200 */
+    memcpy(&pDataParams->bSessionKey[4], &bRndB[0], 4); /* PRQA S 3200 */
+    memcpy(&pDataParams->bSessionKey[8], &bRndA[12], 4); /* PRQA S 3200 */
+    memcpy(&pDataParams->bSessionKey[12], &bRndB[12], 4); /* PRQA S 3200 */
+    memset(bRndA, 0x00, sizeof(bRndA)); /* PRQA S 3200 */
+    memset(bRndB, 0x00, sizeof(bRndB)); /* PRQA S 3200 */
+
+    /* Loading the key also zeroes the IV, which is then carried from command to command */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_LoadKeyDirect(
+        pDataParams->pCryptoDataParamsEnc,
+        pDataParams->bSessionKey,
+        PH_CRYPTOSYM_KEY_TYPE_AES128));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_SetConfig(
+        pDataParams->pCryptoDataParamsEnc,
+        PH_CRYPTOSYM_CONFIG_KEEP_IV,
+        PH_CRYPTOSYM_VALUE_KEEP_IV_ON));
+
+    pDataParams->bKeyNo = bKeyNoCard;
+    pDataParams->bCryptoMethod = PH_CRYPTOSYM_KEY_TYPE_AES128;
+    pDataParams->bAuthMode = PHAL_MFDF_AUTHENTICATEAES;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+#else
+    PHAL_MFDF_UNUSED_VARIABLE(pDataParams)
+    PHAL_MFDF_UNUSED_VARIABLE(wOption)
+    PHAL_MFDF_UNUSED_VARIABLE(wKeyNo)
+    PHAL_MFDF_UNUSED_VARIABLE(wKeyVer)
+    PHAL_MFDF_UNUSED_VARIABLE(bKeyNoCard)
+    PHAL_MFDF_UNUSED_VARIABLE(pDivInput)
+    PHAL_MFDF_UNUSED_VARIABLE(bDivLen)
+
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_AL_MFDF);
+#endif /* NXPBUILD__PH_CRYPTOSYM && NXPBUILD__PH_CRYPTORNG && NXPBUILD__PH_KEYSTORE */
+}
+
+
 /**
 * PICC level commands
 */
@@ -149,6 +332,8 @@ phStatus_t phalMfdf_Sw_SelectApplication(
     memcpy(&bCmdBuff[1], pAppId, PHAL_MFDF_DFAPPID_SIZE); /* PRQA S 3200 */
     wCmdLen = PHAL_MFDF_DFAPPID_SIZE + 1;
 
+    /* Selecting an application always drops the authentication */
+    phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
 
     /* Send the command */
     PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_ExchangeCmd(
@@ -295,6 +480,15 @@ phStatus_t phalMfdf_Sw_WriteData(
         return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_AL_MFDF);
     }
 
+#else
+
+    if ((bCommOption != PHAL_MFDF_COMMUNICATION_PLAIN) &&
+        (bCommOption != PHAL_MFDF_COMMUNICATION_MACD) &&
+        (bCommOption != PHAL_MFDF_COMMUNICATION_ENC))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFDF);
+    }
+
 #endif /* NXPBUILD__PH_CRYPTOSYM */
 
     /* form the command */
@@ -316,9 +510,6 @@ phStatus_t phalMfdf_Sw_WriteData(
         bCommOption = PHAL_MFDF_COMMUNICATION_PLAIN;
     }
 
-
-#ifndef NXPBUILD__PH_CRYPTOSYM
-
     return phalMfdf_Sw_Int_Write_Plain(
         pDataParams,
         bCmdBuff,
@@ -327,8 +518,232 @@ phStatus_t phalMfdf_Sw_WriteData(
         pData,
         wDataLen
         );
+}
+
+
+phStatus_t phalMfdf_Sw_ReadData(
+                                phalMfdf_Sw_DataParams_t * pDataParams,
+                                uint8_t bOption,
+                                uint8_t bFileNo,
+                                uint8_t * pOffset,
+                                uint8_t * pLength,
+                                uint8_t ** ppRxdata,
+                                uint16_t * pRxdataLen
+                                )
+{
+    uint8_t     PH_MEMLOC_REM bCmdBuff[8];
+    uint16_t    PH_MEMLOC_REM wCmdLen = 0;
+
+    if ((bOption & PH_EXCHANGE_MODE_MASK) == PH_EXCHANGE_RXCHAINING)
+    {
+        /* Fetch the next part of a plain read */
+        bCmdBuff[wCmdLen++] = PHAL_MFDF_RESP_ADDITIONAL_FRAME;
+        return phalMfdf_Sw_Int_ReadData_Plain(
+            pDataParams,
+            PHAL_MFDF_COMMUNICATION_PLAIN,
+            bCmdBuff,
+            wCmdLen,
+            ppRxdata,
+            pRxdataLen
+            );
+    }
+
+    if (bFileNo > 0x1f)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFDF);
+    }
+
+
+#ifndef NXPBUILD__PH_CRYPTOSYM
+
+    if (bOption != PHAL_MFDF_COMMUNICATION_PLAIN)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_AL_MFDF);
+    }
+
+#else
+
+    if ((bOption != PHAL_MFDF_COMMUNICATION_PLAIN) &&
+        (bOption != PHAL_MFDF_COMMUNICATION_MACD) &&
+        (bOption != PHAL_MFDF_COMMUNICATION_ENC))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFDF);
+    }
+
+#endif /* NXPBUILD__PH_CRYPTOSYM */
+
+    /* form the command */
+    bCmdBuff[wCmdLen++] = PHAL_MFDF_CMD_READ_DATA;
+    bCmdBuff[wCmdLen++] = bFileNo;
+    memcpy(&bCmdBuff[wCmdLen], pOffset, 3); /* PRQA S 3200 */
+    wCmdLen += 3;
+    memcpy(&bCmdBuff[wCmdLen], pLength, 3); /* PRQA S 3200 */
+    wCmdLen += 3;
+
+    if (pDataParams->bAuthMode == PHAL_MFDF_NOT_AUTHENTICATED)
+    {
+        bOption = PHAL_MFDF_COMMUNICATION_PLAIN;
+    }
+
+
+#ifdef NXPBUILD__PH_CRYPTOSYM
+
+    if (bOption == PHAL_MFDF_COMMUNICATION_ENC)
+    {
+        /* Length 0 reads up to the end of the file, the CRC position is searched then */
+        pDataParams->wPayLoadLen = (uint16_t)(((uint16_t)pLength[1] << 8) | pLength[0]);
+
+        return phalMfdf_Sw_Int_ReadData_Enc(
+            pDataParams,
+            bCmdBuff,
+            wCmdLen,
+            ppRxdata,
+            pRxdataLen
+            );
+    }
 
 #endif /* NXPBUILD__PH_CRYPTOSYM */
+
+    return phalMfdf_Sw_Int_ReadData_Plain(
+        pDataParams,
+        bOption,
+        bCmdBuff,
+        wCmdLen,
+        ppRxdata,
+        pRxdataLen
+        );
+}
+
+
+phStatus_t phalMfdf_Sw_ExecuteBatch(
+                                    phalMfdf_Sw_DataParams_t * pDataParams,
+                                    phalMfdf_BatchCmd_t * pCmds,
+                                    uint8_t bNumCmds,
+                                    uint8_t * pNumExecuted
+                                    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    uint8_t     PH_MEMLOC_REM bCmdBuff[8];
+    uint16_t    PH_MEMLOC_REM wCmdLen;
+    uint16_t    PH_MEMLOC_REM wRxlen;
+    uint8_t     PH_MEMLOC_REM bIndex;
+    uint8_t     PH_MEMLOC_REM bCommOption;
+    uint8_t     PH_MEMLOC_REM * pRecv;
+    phalMfdf_BatchCmd_t PH_MEMLOC_REM * pCmd;
+
+    *pNumExecuted = 0;
+
+    /* Check the complete batch first, nothing is sent if one entry is wrong */
+    for (bIndex = 0; bIndex < bNumCmds; bIndex++)
+    {
+        pCmd = &pCmds[bIndex];
+        pCmd->wRxLength = 0;
+
+        switch (pCmd->bCmd)
+        {
+        case PHAL_MFDF_BATCH_SELECT_APPLICATION:
+        case PHAL_MFDF_BATCH_COMMIT_TRANSACTION:
+            break;
+
+        case PHAL_MFDF_BATCH_GET_VALUE:
+        case PHAL_MFDF_BATCH_READ_RECORDS:
+        case PHAL_MFDF_BATCH_READ_DATA:
+            if ((pCmd->bFileNo > 0x1f) || (pCmd->pRxBuffer == NULL))
+            {
+                return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFDF);
+            }
+#ifndef NXPBUILD__PH_CRYPTOSYM
+            if (pCmd->bCommOption != PHAL_MFDF_COMMUNICATION_PLAIN)
+#else
+            if ((pCmd->bCommOption != PHAL_MFDF_COMMUNICATION_PLAIN) &&
+                (pCmd->bCommOption != PHAL_MFDF_COMMUNICATION_MACD) &&
+                (pCmd->bCommOption != PHAL_MFDF_COMMUNICATION_ENC))
+#endif /* NXPBUILD__PH_CRYPTOSYM */
+            {
+                return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFDF);
+            }
+            break;
+
+        default:
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFDF);
+        }
+    }
+
+    for (bIndex = 0; bIndex < bNumCmds; bIndex++)
+    {
+        pCmd = &pCmds[bIndex];
+
+        if (pCmd->bCmd == PHAL_MFDF_BATCH_SELECT_APPLICATION)
+        {
+            status = phalMfdf_Sw_SelectApplication(pDataParams, pCmd->aParams);
+        }
+        else if (pCmd->bCmd == PHAL_MFDF_BATCH_COMMIT_TRANSACTION)
+        {
+            bCmdBuff[0] = PHAL_MFDF_CMD_COMMIT_TXN;
+            status = phalMfdf_Sw_Int_Write_Plain(
+                pDataParams,
+                bCmdBuff,
+                1,
+                PHAL_MFDF_COMMUNICATION_PLAIN,
+                NULL,
+                0x0000
+                );
+        }
+        else
+        {
+            /* form the command, the batch command codes are the native ones */
+            wCmdLen = 0;
+            bCmdBuff[wCmdLen++] = pCmd->bCmd;
+            bCmdBuff[wCmdLen++] = pCmd->bFileNo;
+            if (pCmd->bCmd == PHAL_MFDF_BATCH_GET_VALUE)
+            {
+                pDataParams->wPayLoadLen = 4;
+            }
+            else
+            {
+                memcpy(&bCmdBuff[wCmdLen], pCmd->aParams, 6); /* PRQA S 3200 */
+                wCmdLen += 6;
+
+                /* The record size is not known here, the CRC position is searched then */
+                pDataParams->wPayLoadLen = (pCmd->bCmd == PHAL_MFDF_BATCH_READ_DATA) ?
+                    (uint16_t)(((uint16_t)pCmd->aParams[4] << 8) | pCmd->aParams[3]) : 0;
+            }
+
+            bCommOption = (pDataParams->bAuthMode == PHAL_MFDF_NOT_AUTHENTICATED) ?
+                PHAL_MFDF_COMMUNICATION_PLAIN : pCmd->bCommOption;
+
+#ifdef NXPBUILD__PH_CRYPTOSYM
+            if (bCommOption == PHAL_MFDF_COMMUNICATION_ENC)
+            {
+                status = phalMfdf_Sw_Int_ReadData_Enc(pDataParams, bCmdBuff, wCmdLen, &pRecv, &wRxlen);
+            }
+            else
+#endif /* NXPBUILD__PH_CRYPTOSYM */
+            {
+                status = phalMfdf_Sw_Int_ReadData_Plain(pDataParams, bCommOption, bCmdBuff, wCmdLen, &pRecv, &wRxlen);
+            }
+
+            /* A response that needs RX chaining can not be continued inside a batch */
+            if (((status & PH_ERR_MASK) == PH_ERR_SUCCESS_CHAINING) ||
+                (((status & PH_ERR_MASK) == PH_ERR_SUCCESS) && (wRxlen > pCmd->wRxBufSize)))
+            {
+                status = PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_MFDF);
+            }
+            else if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+            {
+                memcpy(pCmd->pRxBuffer, pRecv, wRxlen); /* PRQA S 3200 */
+                pCmd->wRxLength = wRxlen;
+            }
+        }
+
+        if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+        {
+            return status;
+        }
+        (*pNumExecuted)++;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
 }
 
 
@@ -461,6 +876,63 @@ phStatus_t phalMfdf_Sw_IsoReadBinary(
         );
 }
 
+phStatus_t phalMfdf_Sw_IsoReadBinaryExt(
+                                        phalMfdf_Sw_DataParams_t * pDataParams,
+                                        uint16_t wOption,
+                                        uint8_t bOffset,
+                                        uint8_t bSfid,
+                                        uint16_t wBytesToRead,
+                                        uint8_t ** ppRxBuffer,
+                                        uint16_t * pBytesRead
+                                        )
+{
+    uint8_t     PH_MEMLOC_REM bP1 = 0;
+    uint8_t     PH_MEMLOC_REM bP2 = 0;
+    uint8_t     PH_MEMLOC_REM bCmdBuff[8];
+    uint16_t    PH_MEMLOC_REM wCmdLen = 0;
+
+    if (wOption == PH_EXCHANGE_DEFAULT)
+    {
+        if (bSfid & 0x80)
+        {
+            /* Short file id is supplied */
+            if ((bSfid & 0x7FU) > 0x1F)
+            {
+                /* Error condition */
+                return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFDF);
+            }
+        }
+        bP1 = bSfid;
+        bP2 = bOffset;
+
+        bCmdBuff[wCmdLen++] = 0x00; /* Class */
+        bCmdBuff[wCmdLen++] = PHAL_MFDF_CMD_ISO7816_READ_BINARY; /* Ins */
+        bCmdBuff[wCmdLen++] = bP1;
+        bCmdBuff[wCmdLen++] = bP2;
+        /* Extended length Le, 0x000000 requests the maximum of 65536 bytes */
+        bCmdBuff[wCmdLen++] = 0x00;
+        bCmdBuff[wCmdLen++] = (uint8_t)(wBytesToRead >> 8);
+        bCmdBuff[wCmdLen++] = (uint8_t)(wBytesToRead & 0xFF);
+    }
+    else if (wOption == PH_EXCHANGE_RXCHAINING)
+    {
+        wCmdLen = 0;
+    }
+    else
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFDF);
+    }
+
+    return phalMfdf_Sw_Int_IsoRead(
+        pDataParams,
+        wOption,
+        bCmdBuff,
+        wCmdLen,
+        ppRxBuffer,
+        pBytesRead
+        );
+}
+
 phStatus_t phalMfdf_Sw_IsoUpdateBinary(
                                        phalMfdf_Sw_DataParams_t * pDataParams,
                                        uint8_t bOffset,
@@ -16,6 +16,20 @@
 #define PHALMFDF_SW_H
 
 
+/*
+*  AuthenticateAes
+*/
+phStatus_t phalMfdf_Sw_AuthenticateAes(
+                                       phalMfdf_Sw_DataParams_t * pDataParams,
+                                       uint16_t wOption,
+                                       uint16_t wKeyNo,
+                                       uint16_t wKeyVer,
+                                       uint8_t bKeyNoCard,
+                                       uint8_t * pDivInput,
+                                       uint8_t bDivLen
+                                       );
+
+
 /*
 *  CreateApplication
 */
@@ -64,6 +78,20 @@ phStatus_t phalMfdf_Sw_CreateStdDataFile(
     );
 
 
+/*
+*  ReadData
+*/
+phStatus_t phalMfdf_Sw_ReadData(
+                                phalMfdf_Sw_DataParams_t * pDataParams,
+                                uint8_t bOption,
+                                uint8_t bFileNo,
+                                uint8_t * pOffset,
+                                uint8_t * pLength,
+                                uint8_t ** ppRxdata,
+                                uint16_t * pRxdataLen
+                                );
+
+
 /*
 *  WriteData
 */
@@ -77,6 +105,17 @@ phStatus_t phalMfdf_Sw_WriteData(
                                  );
 
 
+/*
+*  ExecuteBatch
+*/
+phStatus_t phalMfdf_Sw_ExecuteBatch(
+                                    phalMfdf_Sw_DataParams_t * pDataParams,
+                                    phalMfdf_BatchCmd_t * pCmds,
+                                    uint8_t bNumCmds,
+                                    uint8_t * pNumExecuted
+                                    );
+
+
 /*
 *  ISO Select
 */
@@ -104,6 +143,19 @@ phStatus_t phalMfdf_Sw_IsoReadBinary(
                                      uint16_t * bBytesRead
                                      );
 
+/*
+*  ISO Read Binary with extended length Le
+*/
+phStatus_t phalMfdf_Sw_IsoReadBinaryExt(
+                                        phalMfdf_Sw_DataParams_t * pDataParams,
+                                        uint16_t wOption,
+                                        uint8_t bOffset,
+                                        uint8_t bSfid,
+                                        uint16_t wBytesToRead,
+                                        uint8_t ** ppRxBuffer,
+                                        uint16_t * pBytesRead
+                                        );
+
 /*
 *  ISO Update Binary
 */
@@ -17,6 +17,7 @@
 #include <ph_RefDefs.h>
 #include <ph_TypeDefs.h>
 #include <phTools.h>
+#include <phCryptoSym.h>
 #include <string.h>
 
 
@@ -26,6 +27,251 @@
 #include "phalMfdf_Sw.h"
 #include "phalMfdf_Sw_Int.h"
 
+void phalMfdf_Sw_Int_ResetAuthStatus(
+                                     phalMfdf_Sw_DataParams_t * pDataParams
+                                     )
+{
+#ifdef NXPBUILD__PH_CRYPTOSYM
+    if ((pDataParams->bAuthMode != PHAL_MFDF_NOT_AUTHENTICATED) && (pDataParams->pCryptoDataParamsEnc != NULL))
+    {
+        (void)phCryptoSym_InvalidateKey(pDataParams->pCryptoDataParamsEnc);
+    }
+#endif /* NXPBUILD__PH_CRYPTOSYM */
+
+    memset(pDataParams->bSessionKey, 0x00, 24);  /* PRQA S 3200 */
+    memset(pDataParams->bIv, 0x00, 16); /* PRQA S 3200 */
+    pDataParams->bKeyNo = 0xFF;
+    pDataParams->bAuthMode = PHAL_MFDF_NOT_AUTHENTICATED;
+    pDataParams->bCryptoMethod = 0xFF;
+}
+
+
+#ifdef NXPBUILD__PH_CRYPTOSYM
+
+phStatus_t phalMfdf_Sw_Int_ComputeCmdMac(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t * pCmd,
+    uint16_t wCmdLen,
+    uint8_t * pData,
+    uint16_t wDataLen,
+    uint8_t * pMac
+    )
+{
+    phStatus_t PH_MEMLOC_REM statusTmp;
+    uint8_t    PH_MEMLOC_REM bMacLen;
+
+    /* CMAC over the complete command, the result is also the IV of what follows */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_CalculateMac(
+        pDataParams->pCryptoDataParamsEnc,
+        PH_CRYPTOSYM_MAC_MODE_CMAC | PH_EXCHANGE_BUFFER_FIRST,
+        pCmd,
+        wCmdLen,
+        pMac,
+        &bMacLen));
+
+    return phCryptoSym_CalculateMac(
+        pDataParams->pCryptoDataParamsEnc,
+        PH_CRYPTOSYM_MAC_MODE_CMAC | PH_EXCHANGE_BUFFER_LAST,
+        pData,
+        wDataLen,
+        pMac,
+        &bMacLen);
+}
+
+phStatus_t phalMfdf_Sw_Int_VerifyResponseMac(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t * pData,
+    uint16_t wDataLen,
+    uint8_t * pMac
+    )
+{
+    phStatus_t PH_MEMLOC_REM statusTmp;
+    uint8_t    PH_MEMLOC_REM bStatusByte = PHAL_MFDF_RESP_OPERATION_OK;
+    uint8_t    PH_MEMLOC_REM bCMac[PH_CRYPTOSYM_AES_BLOCK_SIZE];
+    uint8_t    PH_MEMLOC_REM bMacLen;
+
+    /* The PICC MACs the response data followed by the status */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_CalculateMac(
+        pDataParams->pCryptoDataParamsEnc,
+        PH_CRYPTOSYM_MAC_MODE_CMAC | PH_EXCHANGE_BUFFER_FIRST,
+        pData,
+        wDataLen,
+        bCMac,
+        &bMacLen));
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_CalculateMac(
+        pDataParams->pCryptoDataParamsEnc,
+        PH_CRYPTOSYM_MAC_MODE_CMAC | PH_EXCHANGE_BUFFER_LAST,
+        &bStatusByte,
+        1,
+        bCMac,
+        &bMacLen));
+
+    if (memcmp(bCMac, pMac, PHAL_MFDF_TRUNCATED_MAC_SIZE) != 0)
+    {
+        phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
+        return PH_ADD_COMPCODE(PH_ERR_INTEGRITY_ERROR, PH_COMP_AL_MFDF);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+}
+
+/*
+* Streams a MAC'd or enciphered write to the PICC frame by frame. In MAC mode the payload is
+* the data followed by the truncated CMAC, in enciphered mode each block of
+* data || CRC32 || padding is encrypted when a frame needs it, so the data is never copied
+* as a whole.
+*/
+static phStatus_t phalMfdf_Sw_Int_Write_Secure(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t * bCmdBuff,
+    uint16_t wCmdLen,
+    uint8_t bCommOption,
+    uint8_t * pData,
+    uint16_t wDataLen
+    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bFrame[PHAL_MFDF_MAXDFAPDU_SIZE];
+    uint8_t     PH_MEMLOC_REM bBlock[PH_CRYPTOSYM_AES_BLOCK_SIZE];
+    uint8_t     PH_MEMLOC_REM bCrc[PHAL_MFDF_CRC32_SIZE];
+    uint8_t     PH_MEMLOC_REM bIndex;
+    uint8_t     PH_MEMLOC_REM bEnc;
+    uint32_t    PH_MEMLOC_REM dwCrc;
+    uint16_t    PH_MEMLOC_REM wMaxFrameLen;
+    uint16_t    PH_MEMLOC_REM wFrameLen;
+    uint16_t    PH_MEMLOC_REM wStreamLen;
+    uint16_t    PH_MEMLOC_REM wStreamPos;
+    uint16_t    PH_MEMLOC_REM wPos;
+    uint16_t    PH_MEMLOC_REM wRxlen;
+    uint8_t     PH_MEMLOC_REM * pRecv;
+
+    wMaxFrameLen = (pDataParams->bWrappedMode) ? PHAL_MFDF_MAXWRAPPEDAPDU_SIZE : PHAL_MFDF_MAXDFAPDU_SIZE;
+    if (wCmdLen >= wMaxFrameLen)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_MFDF);
+    }
+
+    bEnc = ((bCommOption & PHAL_MFDF_COMMUNICATION_ENC) == PHAL_MFDF_COMMUNICATION_ENC) ? PH_ON : PH_OFF;
+    if (bEnc)
+    {
+        /* CRC32 over the complete command, enciphered together with the data */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phTools_CalculateCrc32(
+            PH_TOOLS_CRC_OPTION_DEFAULT,
+            PH_TOOLS_CRC32_PRESET_DF8,
+            PH_TOOLS_CRC32_POLY_DF8,
+            bCmdBuff,
+            wCmdLen,
+            &dwCrc));
+        PH_CHECK_SUCCESS_FCT(statusTmp, phTools_CalculateCrc32(
+            PH_TOOLS_CRC_OPTION_DEFAULT,
+            dwCrc,
+            PH_TOOLS_CRC32_POLY_DF8,
+            pData,
+            wDataLen,
+            &dwCrc));
+        bCrc[0] = (uint8_t)(dwCrc);
+        bCrc[1] = (uint8_t)(dwCrc >> 8);
+        bCrc[2] = (uint8_t)(dwCrc >> 16);
+        bCrc[3] = (uint8_t)(dwCrc >> 24);
+
+        wStreamLen = (uint16_t)((wDataLen + PHAL_MFDF_CRC32_SIZE + (PH_CRYPTOSYM_AES_BLOCK_SIZE - 1)) &
+            ~(PH_CRYPTOSYM_AES_BLOCK_SIZE - 1));
+    }
+    else
+    {
+        /* bBlock holds the MAC, sent after the data */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_Sw_Int_ComputeCmdMac(pDataParams, bCmdBuff, wCmdLen, pData, wDataLen, bBlock));
+        wStreamLen = wDataLen + PHAL_MFDF_TRUNCATED_MAC_SIZE;
+    }
+
+    memcpy(bFrame, bCmdBuff, wCmdLen); /* PRQA S 3200 */
+    wFrameLen = wCmdLen;
+    wStreamPos = 0;
+
+    do
+    {
+        while ((wFrameLen < wMaxFrameLen) && (wStreamPos < wStreamLen))
+        {
+            if (bEnc)
+            {
+                if ((wStreamPos % PH_CRYPTOSYM_AES_BLOCK_SIZE) == 0)
+                {
+                    for (bIndex = 0; bIndex < PH_CRYPTOSYM_AES_BLOCK_SIZE; bIndex++)
+                    {
+                        wPos = wStreamPos + bIndex;
+                        if (wPos < wDataLen)
+                        {
+                            bBlock[bIndex] = pData[wPos];
+                        }
+                        else if (wPos < (wDataLen + PHAL_MFDF_CRC32_SIZE))
+                        {
+                            bBlock[bIndex] = bCrc[wPos - wDataLen];
+                        }
+                        else
+                        {
+                            bBlock[bIndex] = 0x00;
+                        }
+                    }
+                    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Encrypt(
+                        pDataParams->pCryptoDataParamsEnc,
+                        PH_CRYPTOSYM_CIPHER_MODE_CBC,
+                        bBlock,
+                        PH_CRYPTOSYM_AES_BLOCK_SIZE,
+                        bBlock));
+                }
+                bFrame[wFrameLen++] = bBlock[wStreamPos % PH_CRYPTOSYM_AES_BLOCK_SIZE];
+            }
+            else
+            {
+                bFrame[wFrameLen++] = (wStreamPos < wDataLen) ? pData[wStreamPos] : bBlock[wStreamPos - wDataLen];
+            }
+            wStreamPos++;
+        }
+
+        status = phalMfdf_ExchangeCmd(
+            pDataParams,
+            pDataParams->pPalMifareDataParams,
+            pDataParams->bWrappedMode,
+            bFrame,
+            wFrameLen,
+            &pRecv,
+            &wRxlen
+            );
+        if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS_CHAINING)
+        {
+            break;
+        }
+
+        bFrame[0] = PHAL_MFDF_RESP_ADDITIONAL_FRAME;
+        wFrameLen = 1;
+    }
+    while (wStreamPos < wStreamLen);
+
+    if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+    {
+        if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS_CHAINING)
+        {
+            /* PICC expects more data than the command carries */
+            phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+        }
+        return status;
+    }
+
+    /* Success returned even before writing all data, or no MAC? protocol error */
+    if ((wStreamPos != wStreamLen) || (wRxlen != PHAL_MFDF_TRUNCATED_MAC_SIZE))
+    {
+        phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+    }
+
+    return phalMfdf_Sw_Int_VerifyResponseMac(pDataParams, NULL, 0, pRecv);
+}
+
+#endif /* NXPBUILD__PH_CRYPTOSYM */
+
 phStatus_t phalMfdf_Sw_Int_GetData(
                                    phalMfdf_Sw_DataParams_t * pDataParams,
                                    uint8_t * pSendBuff,
@@ -401,13 +647,23 @@ phStatus_t phalMfdf_Sw_Int_ReadData_Plain(
     uint16_t    PH_MEMLOC_REM status = 0;
     uint16_t    PH_MEMLOC_REM wRxlen = 0;
     uint8_t     PH_MEMLOC_REM * pRecv;
+#ifdef NXPBUILD__PH_CRYPTOSYM
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bCMac[PH_CRYPTOSYM_AES_BLOCK_SIZE];
+#endif /* NXPBUILD__PH_CRYPTOSYM */
 
-#ifndef NXPBUILD__PH_CRYPTOSYM
-
+    /* Plain and MAC'd responses look the same, the MAC is verified whenever authenticated */
     PHAL_MFDF_UNUSED_VARIABLE(bOption)
 
-#endif /* NXPBUILD__PH_CRYPTOSYM */
+#ifdef NXPBUILD__PH_CRYPTOSYM
+
+    if (pDataParams->bAuthMode == PHAL_MFDF_AUTHENTICATEAES)
+    {
+        /* The command MAC is not sent, it only advances the IV */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_Sw_Int_ComputeCmdMac(pDataParams, bCmdBuff, wCmdLen, NULL, 0, bCMac));
+    }
 
+#endif /* NXPBUILD__PH_CRYPTOSYM */
 
     /* Send the command */
     status = phalMfdf_Sw_Int_GetData(
@@ -425,6 +681,26 @@ phStatus_t phalMfdf_Sw_Int_ReadData_Plain(
         return status;
     }
 
+#ifdef NXPBUILD__PH_CRYPTOSYM
+
+    if (pDataParams->bAuthMode == PHAL_MFDF_AUTHENTICATEAES)
+    {
+        /* The MAC trails the complete response, it cannot be verified in pieces */
+        if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS_CHAINING)
+        {
+            phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
+            return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_MFDF);
+        }
+        if (wRxlen < PHAL_MFDF_TRUNCATED_MAC_SIZE)
+        {
+            phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+        }
+        wRxlen = wRxlen - PHAL_MFDF_TRUNCATED_MAC_SIZE;
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_Sw_Int_VerifyResponseMac(pDataParams, pRecv, wRxlen, &pRecv[wRxlen]));
+    }
+
+#endif /* NXPBUILD__PH_CRYPTOSYM */
 
     *ppRxdata = pRecv;
     *pRxdataLen = wRxlen;
@@ -438,6 +714,125 @@ phStatus_t phalMfdf_Sw_Int_ReadData_Plain(
 }
 
 
+#ifdef NXPBUILD__PH_CRYPTOSYM
+
+phStatus_t phalMfdf_Sw_Int_ReadData_Enc(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t * bCmdBuff,
+    uint16_t wCmdLen,
+    uint8_t ** ppRxdata,
+    uint16_t * pRxdataLen
+    )
+{
+    uint16_t    PH_MEMLOC_REM status = 0;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wRxlen = 0;
+    uint16_t    PH_MEMLOC_REM wDataLen;
+    uint16_t    PH_MEMLOC_REM wMinDataLen;
+    uint16_t    PH_MEMLOC_REM wIndex;
+    uint32_t    PH_MEMLOC_REM dwCrc;
+    uint8_t     PH_MEMLOC_REM bStatusByte = PHAL_MFDF_RESP_OPERATION_OK;
+    uint8_t     PH_MEMLOC_REM bCMac[PH_CRYPTOSYM_AES_BLOCK_SIZE];
+    uint8_t     PH_MEMLOC_REM * pRecv;
+
+    /* The command MAC is not sent, it only advances the IV */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_Sw_Int_ComputeCmdMac(pDataParams, bCmdBuff, wCmdLen, NULL, 0, bCMac));
+
+    status = phalMfdf_Sw_Int_GetData(
+        pDataParams,
+        bCmdBuff,
+        wCmdLen,
+        &pRecv,
+        &wRxlen
+        );
+
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS_CHAINING)
+    {
+        /* The CRC covers the complete response, it cannot be verified in pieces */
+        phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_MFDF);
+    }
+    if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+    {
+        return status;
+    }
+
+    if ((wRxlen == 0) || (wRxlen % PH_CRYPTOSYM_AES_BLOCK_SIZE))
+    {
+        phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+    }
+
+    /* Decrypt in place, the last cipher block becomes the IV */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Decrypt(
+        pDataParams->pCryptoDataParamsEnc,
+        PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        pRecv,
+        wRxlen,
+        pRecv));
+
+    /* data || CRC32(data || status) || zero padding. Without a requested length every
+    length ending in the last block is tried, longest first */
+    if (pDataParams->wPayLoadLen != 0)
+    {
+        wDataLen = pDataParams->wPayLoadLen;
+        wMinDataLen = wDataLen;
+        if ((wDataLen + PHAL_MFDF_CRC32_SIZE) > wRxlen)
+        {
+            phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+        }
+    }
+    else
+    {
+        wDataLen = wRxlen - PHAL_MFDF_CRC32_SIZE;
+        wMinDataLen = (wRxlen > PH_CRYPTOSYM_AES_BLOCK_SIZE) ? (wRxlen - PH_CRYPTOSYM_AES_BLOCK_SIZE - PHAL_MFDF_CRC32_SIZE + 1) : 0;
+    }
+
+    for (wDataLen = wDataLen + 1; wDataLen-- > wMinDataLen; )
+    {
+        /* Padding has to be zero, a non zero byte ends the search */
+        for (wIndex = wDataLen + PHAL_MFDF_CRC32_SIZE; (wIndex < wRxlen) && (pRecv[wIndex] == 0x00); wIndex++)
+        {
+        }
+        if (wIndex != wRxlen)
+        {
+            break;
+        }
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phTools_CalculateCrc32(
+            PH_TOOLS_CRC_OPTION_DEFAULT,
+            PH_TOOLS_CRC32_PRESET_DF8,
+            PH_TOOLS_CRC32_POLY_DF8,
+            pRecv,
+            wDataLen,
+            &dwCrc));
+        PH_CHECK_SUCCESS_FCT(statusTmp, phTools_CalculateCrc32(
+            PH_TOOLS_CRC_OPTION_DEFAULT,
+            dwCrc,
+            PH_TOOLS_CRC32_POLY_DF8,
+            &bStatusByte,
+            1,
+            &dwCrc));
+
+        if ((pRecv[wDataLen] == (uint8_t)(dwCrc)) &&
+            (pRecv[wDataLen + 1] == (uint8_t)(dwCrc >> 8)) &&
+            (pRecv[wDataLen + 2] == (uint8_t)(dwCrc >> 16)) &&
+            (pRecv[wDataLen + 3] == (uint8_t)(dwCrc >> 24)))
+        {
+            *ppRxdata = pRecv;
+            *pRxdataLen = wDataLen;
+            return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+        }
+    }
+
+    phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
+    return PH_ADD_COMPCODE(PH_ERR_INTEGRITY_ERROR, PH_COMP_AL_MFDF);
+}
+
+#endif /* NXPBUILD__PH_CRYPTOSYM */
+
+
 phStatus_t phalMfdf_Sw_Int_Write_Plain(
                                        phalMfdf_Sw_DataParams_t * pDataParams,
                                        uint8_t * bCmdBuff,
@@ -457,25 +852,37 @@ phStatus_t phalMfdf_Sw_Int_Write_Plain(
     uint16_t    PH_MEMLOC_REM wIndex = 0;
     uint8_t     PH_MEMLOC_REM *pRecv;
     uint8_t     PH_MEMLOC_REM pApdu[5] = { PHAL_MFDF_WRAPPEDAPDU_CLA, 0x00, PHAL_MFDF_WRAPPEDAPDU_P1, PHAL_MFDF_WRAPPEDAPDU_P2, 0x00 };
+#ifdef NXPBUILD__PH_CRYPTOSYM
+    uint8_t     PH_MEMLOC_REM bCMac[PH_CRYPTOSYM_AES_BLOCK_SIZE];
+#endif /* NXPBUILD__PH_CRYPTOSYM */
 
 #ifndef NXPBUILD__PH_CRYPTOSYM
 
     PHAL_MFDF_UNUSED_VARIABLE(bCommOption)
 
+#endif /* NXPBUILD__PH_CRYPTOSYM */
+
     PHAL_MFDF_UNUSED_VARIABLE(wIndex)
 
-#endif /* NXPBUILD__PH_CRYPTOSYM */
+#ifdef NXPBUILD__PH_CRYPTOSYM
 
+    if (pDataParams->bAuthMode == PHAL_MFDF_AUTHENTICATEAES)
+    {
+        if (bCommOption != PHAL_MFDF_COMMUNICATION_PLAIN)
+        {
+            return phalMfdf_Sw_Int_Write_Secure(pDataParams, bCmdBuff, wCmdLen, bCommOption, pData, wDataLen);
+        }
 
-    memset(bWorkBuffer, 0x00, 16); /* PRQA S 3200 */
+        /* The command MAC is not sent, it only advances the IV */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_Sw_Int_ComputeCmdMac(pDataParams, bCmdBuff, wCmdLen, pData, wDataLen, bCMac));
+    }
 
+#endif /* NXPBUILD__PH_CRYPTOSYM */
 
-#ifndef NXPBUILD__PH_CRYPTOSYM
+    memset(bWorkBuffer, 0x00, 16); /* PRQA S 3200 */
 
     wTotalLen = wDataLen;
 
-#endif /* NXPBUILD__PH_CRYPTOSYM */
-
     if (pDataParams->bWrappedMode)
     {
         wFrameLen = PHAL_MFDF_MAXWRAPPEDAPDU_SIZE;
@@ -577,10 +984,6 @@ phStatus_t phalMfdf_Sw_Int_Write_Plain(
                     &pRecv,
                     &wRxlen));
 
-
-
-#ifndef NXPBUILD__PH_CRYPTOSYM
-
                 PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL4(
                     pDataParams->pPalMifareDataParams,
                     PH_EXCHANGE_BUFFER_LAST,
@@ -588,9 +991,6 @@ phStatus_t phalMfdf_Sw_Int_Write_Plain(
                     wDataLen,
                     &pRecv,
                     &wRxlen));
-
-#endif /* NXPBUILD__PH_CRYPTOSYM */
-
             }
             if (pDataParams->bWrappedMode)
             {
@@ -616,7 +1016,7 @@ phStatus_t phalMfdf_Sw_Int_Write_Plain(
         else
         {
             /* Send command and data. Chain data to PICC */
-            statusTmp = phalMfdf_Sw_Int_SendDataToPICC(
+            PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_Sw_Int_SendDataToPICC(
                 pDataParams,
                 bCmdBuff,
                 wCmdLen,
@@ -624,14 +1024,24 @@ phStatus_t phalMfdf_Sw_Int_Write_Plain(
                 wDataLen,
                 bWorkBuffer,
                 &wRxlen
-                );
+                ));
+        }
+    }
 
+#ifdef NXPBUILD__PH_CRYPTOSYM
 
+    if (pDataParams->bAuthMode == PHAL_MFDF_AUTHENTICATEAES)
+    {
+        /* Only the MAC of the status is returned */
+        if (wRxlen != PHAL_MFDF_TRUNCATED_MAC_SIZE)
+        {
+            phalMfdf_Sw_Int_ResetAuthStatus(pDataParams);
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
         }
+        return phalMfdf_Sw_Int_VerifyResponseMac(pDataParams, NULL, 0, bWorkBuffer);
     }
 
-
-#ifndef NXPBUILD__PH_CRYPTOSYM
+#endif /* NXPBUILD__PH_CRYPTOSYM */
 
     /* Should not get more bytes than the status bytes in case
     of no authentication */
@@ -640,8 +1050,6 @@ phStatus_t phalMfdf_Sw_Int_Write_Plain(
         return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
     }
 
-#endif /* NXPBUILD__PH_CRYPTOSYM */
-
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
 }
 
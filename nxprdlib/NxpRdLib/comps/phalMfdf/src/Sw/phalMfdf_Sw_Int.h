@@ -63,4 +63,39 @@ phStatus_t phalMfdf_Sw_Int_GetData(
                                    uint8_t ** pResponse,
                                    uint16_t * pRxlen
                                    );
+
+/* Drops the authentication state, also invalidates the session key */
+void phalMfdf_Sw_Int_ResetAuthStatus(
+                                     phalMfdf_Sw_DataParams_t * pDataParams
+                                     );
+
+#ifdef NXPBUILD__PH_CRYPTOSYM
+
+/* CMAC over command and data, advancing the session IV */
+phStatus_t phalMfdf_Sw_Int_ComputeCmdMac(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t * pCmd,
+    uint16_t wCmdLen,
+    uint8_t * pData,
+    uint16_t wDataLen,
+    uint8_t * pMac
+    );
+
+/* Verifies the 8 byte MAC trailing a response, drops the authentication on mismatch */
+phStatus_t phalMfdf_Sw_Int_VerifyResponseMac(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t * pData,
+    uint16_t wDataLen,
+    uint8_t * pMac
+    );
+
+phStatus_t phalMfdf_Sw_Int_ReadData_Enc(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t * bCmdBuff,
+    uint16_t wCmdLen,
+    uint8_t ** ppRxdata,
+    uint16_t * pRxdataLen
+    );
+
+#endif /* NXPBUILD__PH_CRYPTOSYM */
 #endif /* PHALMFDF_SW_INT_H */
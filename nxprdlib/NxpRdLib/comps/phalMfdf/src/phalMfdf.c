@@ -38,6 +38,80 @@
 #ifndef NXPRDLIB_REM_GEN_INTFS
 
 
+/*
+* Security related commands
+*/
+
+phStatus_t phalMfdf_AuthenticateAes(
+                                    void * pDataParams,
+                                    uint16_t wOption,
+                                    uint16_t wKeyNo,
+                                    uint16_t wKeyVer,
+                                    uint8_t bKeyNoCard,
+                                    uint8_t * pDivInput,
+                                    uint8_t bDivLen
+                                    )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfdf_AuthenticateAes");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wOption);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyNo);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyVer);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bKeyNoCard);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDivInput);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wOption_log, &wOption);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyNo_log, &wKeyNo);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyVer_log, &wKeyVer);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bKeyNoCard_log, &bKeyNoCard);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pDivInput_log, pDivInput, bDivLen);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+
+    PH_ASSERT_NULL (pDataParams);
+    if (bDivLen > 0) PH_ASSERT_NULL (pDivInput);
+
+    /* parameter validation */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFDF)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFDF);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+        return status;
+    }
+
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFDF_SW
+    case PHAL_MFDF_SW_ID:
+        status = phalMfdf_Sw_AuthenticateAes((phalMfdf_Sw_DataParams_t *)pDataParams,
+            wOption,
+            wKeyNo,
+            wKeyVer,
+            bKeyNoCard,
+            pDivInput,
+            bDivLen);
+        break;
+#endif /* NXPBUILD__PHAL_MFDF_SW */
+
+
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFDF);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+
 /*
 * PICC level commands
 */
@@ -303,6 +377,91 @@ phStatus_t phalMfdf_CreateStdDataFile(
 }
 
 
+phStatus_t phalMfdf_ReadData(
+                             void * pDataParams,
+                             uint8_t bOption,
+                             uint8_t bFileNo,
+                             uint8_t * pOffset,
+                             uint8_t * pLength,
+                             uint8_t ** ppRxdata,
+                             uint16_t * pRxdataLen
+                             )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfdf_ReadData");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bOption);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bFileNo);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pOffset);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(ppRxdata);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pRxdataLen);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bOption_log, &bOption);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bFileNo_log, &bFileNo);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pOffset_log, pOffset, 3);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pLength_log, pLength, 3);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+
+    PH_ASSERT_NULL (pDataParams);
+    if ((bOption & PH_EXCHANGE_MODE_MASK) != PH_EXCHANGE_RXCHAINING)
+    {
+        PH_ASSERT_NULL (pOffset);
+        PH_ASSERT_NULL (pLength);
+    }
+    PH_ASSERT_NULL (ppRxdata);
+    PH_ASSERT_NULL (pRxdataLen);
+
+    /* parameter validation */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFDF)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFDF);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return status;
+    }
+
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFDF_SW
+    case PHAL_MFDF_SW_ID:
+        status = phalMfdf_Sw_ReadData((phalMfdf_Sw_DataParams_t *)pDataParams,
+            bOption,
+            bFileNo,
+            pOffset,
+            pLength,
+            ppRxdata,
+            pRxdataLen
+            );
+        break;
+#endif /* NXPBUILD__PHAL_MFDF_SW */
+
+
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFDF);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if (((status & PH_ERR_MASK) == PH_ERR_SUCCESS) || ((status & PH_ERR_MASK) == PH_ERR_SUCCESS_CHAINING))
+    {
+        PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, ppRxdata_log, *ppRxdata, (*pRxdataLen));
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, pRxdataLen_log, pRxdataLen);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+
 phStatus_t phalMfdf_WriteData(
                               void * pDataParams,
                               uint8_t bCommOption,
@@ -381,6 +540,67 @@ phStatus_t phalMfdf_WriteData(
 }
 
 
+phStatus_t phalMfdf_ExecuteBatch(
+                                 void * pDataParams,
+                                 phalMfdf_BatchCmd_t * pCmds,
+                                 uint8_t bNumCmds,
+                                 uint8_t * pNumExecuted
+                                 )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfdf_ExecuteBatch");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bNumCmds);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pNumExecuted);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bNumCmds_log, &bNumCmds);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+
+    PH_ASSERT_NULL (pDataParams);
+    if (bNumCmds > 0) PH_ASSERT_NULL (pCmds);
+    PH_ASSERT_NULL (pNumExecuted);
+
+    /* parameter validation */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFDF)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFDF);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return status;
+    }
+
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFDF_SW
+    case PHAL_MFDF_SW_ID:
+        status = phalMfdf_Sw_ExecuteBatch((phalMfdf_Sw_DataParams_t *)pDataParams,
+            pCmds,
+            bNumCmds,
+            pNumExecuted
+            );
+        break;
+#endif /* NXPBUILD__PHAL_MFDF_SW */
+
+
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFDF);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_INFO, pNumExecuted_log, pNumExecuted);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+
 phStatus_t phalMfdf_IsoSelectFile(
                                   void * pDataParams,
                                   uint8_t bOption,
@@ -523,6 +743,75 @@ phStatus_t phalMfdf_IsoReadBinary(
     return status;
 }
 
+phStatus_t phalMfdf_IsoReadBinaryExt(
+                                     void * pDataParams,
+                                     uint16_t wOption,
+                                     uint8_t bOffset,
+                                     uint8_t bSfid,
+                                     uint16_t wBytesToRead,
+                                     uint8_t ** ppRxBuffer,
+                                     uint16_t * pBytesRead
+                                     )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfdf_IsoReadBinaryExt");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bOffset);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bSfid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wBytesToRead);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(ppRxBuffer);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pBytesRead);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bOffset_log, &bOffset);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bSfid_log, &bSfid);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wBytesToRead_log, &wBytesToRead);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+    PH_ASSERT_NULL (ppRxBuffer);
+    PH_ASSERT_NULL (pBytesRead);
+
+    /* parameter validation */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFDF)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFDF);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return status;
+    }
+
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFDF_SW
+    case PHAL_MFDF_SW_ID:
+        status = phalMfdf_Sw_IsoReadBinaryExt((phalMfdf_Sw_DataParams_t *)pDataParams,
+            wOption,
+            bOffset,
+            bSfid,
+            wBytesToRead,
+            ppRxBuffer,
+            pBytesRead
+            );
+        break;
+#endif /* NXPBUILD__PHAL_MFDF_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFDF);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, ppRxBuffer_log, *ppRxBuffer, (*pBytesRead));
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, pBytesRead_log, pBytesRead);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
 phStatus_t phalMfdf_IsoUpdateBinary(
                                     void * pDataParams,
                                     uint8_t bOffset,
@@ -22,6 +22,11 @@
 #include "phalMfdf_Int.h"
 #include <ph_RefDefs.h>
 
+#ifdef NXPBUILD__PHAL_MFDF_SW
+#include "Sw/phalMfdf_Sw.h"
+#include "Sw/phalMfdf_Sw_Int.h"
+#endif /* NXPBUILD__PHAL_MFDF_SW */
+
 phStatus_t phalMfdf_Int_ComputeErrorResponse(
     void * pDataParams,
     uint16_t wStatus
@@ -30,6 +35,18 @@ phStatus_t phalMfdf_Int_ComputeErrorResponse(
     phStatus_t  PH_MEMLOC_REM status = PH_ERR_SUCCESS;
     phStatus_t  PH_MEMLOC_REM statusTmp;
 
+#ifdef NXPBUILD__PHAL_MFDF_SW
+    /* The PICC drops the authentication with every native error status */
+    if ((wStatus <= 0xFFU) &&
+        (wStatus != PHAL_MFDF_RESP_OPERATION_OK) &&
+        (wStatus != PHAL_MFDF_RESP_NO_CHANGES) &&
+        (wStatus != PHAL_MFDF_RESP_ADDITIONAL_FRAME) &&
+        (PH_GET_COMPID(pDataParams) == PHAL_MFDF_SW_ID))
+    {
+        phalMfdf_Sw_Int_ResetAuthStatus((phalMfdf_Sw_DataParams_t *)pDataParams);
+    }
+#endif /* NXPBUILD__PHAL_MFDF_SW */
+
     switch (wStatus)
     {
     case PHAL_MFDF_RESP_OPERATION_OK:
@@ -63,6 +80,10 @@ phStatus_t phalMfdf_Int_ComputeErrorResponse(
         status = PHAL_MFDF_ERR_APPLICATION_NOT_FOUND;
         break;
 
+    case PHAL_MFDF_RESP_ERR_AUTHENTICATION_ERROR:
+        status = PH_ERR_AUTH_ERROR;
+        break;
+
 
     case PHAL_MFDF_RESP_ADDITIONAL_FRAME:
         status = PH_ERR_SUCCESS_CHAINING;
@@ -39,10 +39,15 @@
 
 /*@{*/
 
+#define PHAL_MFDF_CMD_AUTHENTICATE_AES          0xAA    /**< MF DF Authenticate AES cmd. */
 #define PHAL_MFDF_CMD_CREATE_APPLN              0xCA    /**< MF DF Create Application cmd. */
 #define PHAL_MFDF_CMD_SELECT_APPLN              0x5A    /**< MF DF Select Application Cmd. */
 #define PHAL_MFDF_CMD_GET_VERSION               0x60    /**< MF DF Get Version cmd. */
+#define PHAL_MFDF_CMD_GET_VALUE                 0x6C    /**< MF DF Get Value cmd. */
+#define PHAL_MFDF_CMD_READ_RECORDS              0xBB    /**< MF DF Read Records cmd. */
+#define PHAL_MFDF_CMD_COMMIT_TXN                0xC7    /**< MF DF Commit Transaction cmd. */
 #define PHAL_MFDF_CMD_CREATE_STD_DATAFILE       0xCD    /**< MF DF Create Standard data file cmd. */
+#define PHAL_MFDF_CMD_READ_DATA                 0xBD    /**< MF DF Read data cmd. */
 #define PHAL_MFDF_CMD_WRITE_DATA                0x3D    /**< MF DF Write data cmd. */
 
 /*@}*/
@@ -104,6 +109,9 @@
 #define PHAL_MFDF_DFAPPID_SIZE          0x03u   /**< Size of MF DF application Id. */
 #define PHAL_MFDF_DATA_BLOCK_SIZE       0x10u   /**< Data block size need for internal purposes. */
 #define PHAL_MFDF_MAX_FRAME_SIZE        0x40u   /**< Max size in a ISO 14443-4 frame. */
+#define PHAL_MFDF_TRUNCATED_MAC_SIZE    0x08u   /**< Size of the EV1 MAC, the first 8 bytes of the CMAC. */
+#define PHAL_MFDF_CRC32_SIZE            0x04u   /**< Size of the CRC32 of enciphered data. */
+#define PHAL_MFDF_AES128_KEY_SIZE       0x10u   /**< Size of an AES 128 key. */
 /*@}*/
 
 /**
@@ -27,7 +27,10 @@
 #include <phalMful.h>
 #include <phpalMifare.h>
 #include <phKeyStore.h>
+#include <phCryptoSym.h>
+#include <phCryptoRng.h>
 #include <ph_RefDefs.h>
+#include <string.h>
 
 #ifdef NXPBUILD__PHAL_MFUL_SW
 
@@ -69,8 +72,125 @@ phStatus_t phalMful_Sw_UlcAuthenticate(
                                        uint16_t wKeyVersion
                                        )
 {
+#if defined(NXPBUILD__PH_CRYPTOSYM) && defined(NXPBUILD__PH_CRYPTORNG) && defined(NXPBUILD__PH_KEYSTORE)
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bCmdBuff[1 + (2 * PHAL_MFUL_DES_BLOCK_SIZE)];
+    uint8_t     PH_MEMLOC_REM bKey[PHAL_MFUL_DES_KEY_LENGTH];
+    uint8_t     PH_MEMLOC_REM bRndA[PHAL_MFUL_DES_BLOCK_SIZE];
+    uint8_t     PH_MEMLOC_REM bRndB[PHAL_MFUL_DES_BLOCK_SIZE];
+    uint8_t     PH_MEMLOC_REM bIv[PHAL_MFUL_DES_BLOCK_SIZE];
+    uint16_t    PH_MEMLOC_REM wKeyType;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+    uint8_t     PH_MEMLOC_REM * pRxBuffer;
 
-#ifndef NXPBUILD__PH_CRYPTOSYM
+    if ((pDataParams->pKeyStoreDataParams == NULL) ||
+        (pDataParams->pCryptoDataParams == NULL) ||
+        (pDataParams->pCryptoRngDataParams == NULL))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_MFUL);
+    }
+
+    /* Load the 2K3DES key into the crypto layer */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phKeyStore_GetKey(
+        pDataParams->pKeyStoreDataParams,
+        wKeyNumber,
+        wKeyVersion,
+        (uint8_t)sizeof(bKey),
+        bKey,
+        &wKeyType));
+
+    if (wKeyType != PH_KEYSTORE_KEY_TYPE_2K3DES)
+    {
+        memset(bKey, 0x00, sizeof(bKey)); /* PRQA S 3200 */
+        return PH_ADD_COMPCODE(PH_ERR_KEY, PH_COMP_AL_MFUL);
+    }
+
+    status = phCryptoSym_LoadKeyDirect(pDataParams->pCryptoDataParams, bKey, PH_CRYPTOSYM_KEY_TYPE_2K3DES);
+    memset(bKey, 0x00, sizeof(bKey)); /* PRQA S 3200 */
+    PH_CHECK_SUCCESS(status);
+
+    /* Step 1: request ek(RndB) */
+    bCmdBuff[0] = PHAL_MFUL_CMD_AUTH;
+    bCmdBuff[1] = 0x00;
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+        pDataParams->pPalMifareDataParams,
+        PH_EXCHANGE_DEFAULT,
+        bCmdBuff,
+        2,
+        &pRxBuffer,
+        &wRxLength
+        ));
+
+    if ((wRxLength != (1 + PHAL_MFUL_DES_BLOCK_SIZE)) || (pRxBuffer[0] != PHAL_MFUL_PREAMBLE_TX))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFUL);
+    }
+
+    /* The encrypted RndB is the IV for the reader token */
+    memcpy(bIv, &pRxBuffer[1], PHAL_MFUL_DES_BLOCK_SIZE); /* PRQA S 3200 */
+    memset(bCmdBuff, 0x00, PHAL_MFUL_DES_BLOCK_SIZE); /* PRQA S 3200 */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_LoadIv(pDataParams->pCryptoDataParams, bCmdBuff, PHAL_MFUL_DES_BLOCK_SIZE));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Decrypt(
+        pDataParams->pCryptoDataParams,
+        PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        bIv,
+        PHAL_MFUL_DES_BLOCK_SIZE,
+        bRndB));
+
+    /* Step 2: send ek(RndA || RndB') */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoRng_Rnd(pDataParams->pCryptoRngDataParams, PHAL_MFUL_DES_BLOCK_SIZE, bRndA));
+
+    bCmdBuff[0] = PHAL_MFUL_PREAMBLE_TX;
+    memcpy(&bCmdBuff[1], bRndA, PHAL_MFUL_DES_BLOCK_SIZE); /* PRQA S 3200 */
+    memcpy(&bCmdBuff[1 + PHAL_MFUL_DES_BLOCK_SIZE], &bRndB[1], PHAL_MFUL_DES_BLOCK_SIZE - 1); /* PRQA S 3200 */
+    bCmdBuff[2 * PHAL_MFUL_DES_BLOCK_SIZE] = bRndB[0];
+    memset(bRndB, 0x00, sizeof(bRndB)); /* PRQA S 3200 */
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_LoadIv(pDataParams->pCryptoDataParams, bIv, PHAL_MFUL_DES_BLOCK_SIZE));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Encrypt(
+        pDataParams->pCryptoDataParams,
+        PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        &bCmdBuff[1],
+        2 * PHAL_MFUL_DES_BLOCK_SIZE,
+        &bCmdBuff[1]));
+
+    /* The last cipher block sent is the IV for the card token */
+    memcpy(bIv, &bCmdBuff[1 + PHAL_MFUL_DES_BLOCK_SIZE], PHAL_MFUL_DES_BLOCK_SIZE); /* PRQA S 3200 */
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+        pDataParams->pPalMifareDataParams,
+        PH_EXCHANGE_DEFAULT,
+        bCmdBuff,
+        1 + (2 * PHAL_MFUL_DES_BLOCK_SIZE),
+        &pRxBuffer,
+        &wRxLength
+        ));
+
+    if ((wRxLength != (1 + PHAL_MFUL_DES_BLOCK_SIZE)) || (pRxBuffer[0] != PHAL_MFUL_PREAMBLE_RX))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFUL);
+    }
+
+    /* Step 3: verify ek(RndA') */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_LoadIv(pDataParams->pCryptoDataParams, bIv, PHAL_MFUL_DES_BLOCK_SIZE));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Decrypt(
+        pDataParams->pCryptoDataParams,
+        PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        &pRxBuffer[1],
+        PHAL_MFUL_DES_BLOCK_SIZE,
+        bCmdBuff));
+
+    status = ((memcmp(bCmdBuff, &bRndA[1], PHAL_MFUL_DES_BLOCK_SIZE - 1) == 0) &&
+        (bCmdBuff[PHAL_MFUL_DES_BLOCK_SIZE - 1] == bRndA[0])) ?
+        PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL) :
+        PH_ADD_COMPCODE(PH_ERR_AUTH_ERROR, PH_COMP_AL_MFUL);
+
+    memset(bRndA, 0x00, sizeof(bRndA)); /* PRQA S 3200 */
+    (void)phCryptoSym_InvalidateKey(pDataParams->pCryptoDataParams);
+
+    return status;
+#else
 
     /* satisfy compiler */
     PH_UNUSED_VARIABLE (pDataParams);
@@ -79,7 +199,7 @@ phStatus_t phalMful_Sw_UlcAuthenticate(
 
     return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_AL_MFUL);
 
-#endif /* NXPBUILD__PH_CRYPTOSYM */
+#endif /* NXPBUILD__PH_CRYPTOSYM && NXPBUILD__PH_CRYPTORNG && NXPBUILD__PH_KEYSTORE */
 }
 
 phStatus_t phalMful_Sw_Read(
@@ -182,4 +302,36 @@ phStatus_t phalMful_Sw_ChkTearingEvent(
     return phalMful_Int_ChkTearingEvent(pDataParams->pPalMifareDataParams, bCntNum, pValidFlag);
 }
 
+phStatus_t phalMful_Sw_FastWrite(
+                                 phalMful_Sw_DataParams_t * pDataParams,
+                                 uint8_t bStartAddr,
+                                 uint8_t bEndAddr,
+                                 uint8_t * pData
+                                 )
+{
+    return phalMful_Int_FastWrite(pDataParams->pPalMifareDataParams, bStartAddr, bEndAddr, pData);
+}
+
+phStatus_t phalMful_Sw_PassThroughWrite(
+                                        phalMful_Sw_DataParams_t * pDataParams,
+                                        uint8_t * pData,
+                                        uint16_t wDataLength,
+                                        uint16_t wMaxPolls,
+                                        phalMful_PassThroughStats_t * pStats
+                                        )
+{
+    return phalMful_Int_PassThroughWrite(pDataParams->pPalMifareDataParams, pData, wDataLength, wMaxPolls, pStats);
+}
+
+phStatus_t phalMful_Sw_PassThroughRead(
+                                       phalMful_Sw_DataParams_t * pDataParams,
+                                       uint8_t * pData,
+                                       uint16_t wDataLength,
+                                       uint16_t wMaxPolls,
+                                       phalMful_PassThroughStats_t * pStats
+                                       )
+{
+    return phalMful_Int_PassThroughRead(pDataParams->pPalMifareDataParams, pData, wDataLength, wMaxPolls, pStats);
+}
+
 #endif /* NXPBUILD__PHAL_MFUL_SW */
@@ -100,4 +100,27 @@ phStatus_t phalMful_Sw_ChkTearingEvent(
                                        uint8_t * pValidFlag
                                        );
 
+phStatus_t phalMful_Sw_FastWrite(
+                                 phalMful_Sw_DataParams_t * pDataParams,
+                                 uint8_t bStartAddr,
+                                 uint8_t bEndAddr,
+                                 uint8_t * pData
+                                 );
+
+phStatus_t phalMful_Sw_PassThroughWrite(
+                                        phalMful_Sw_DataParams_t * pDataParams,
+                                        uint8_t * pData,
+                                        uint16_t wDataLength,
+                                        uint16_t wMaxPolls,
+                                        phalMful_PassThroughStats_t * pStats
+                                        );
+
+phStatus_t phalMful_Sw_PassThroughRead(
+                                       phalMful_Sw_DataParams_t * pDataParams,
+                                       uint8_t * pData,
+                                       uint16_t wDataLength,
+                                       uint16_t wMaxPolls,
+                                       phalMful_PassThroughStats_t * pStats
+                                       );
+
 #endif /* PHALMFUL_SW_H */
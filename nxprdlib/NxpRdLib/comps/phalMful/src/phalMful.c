@@ -669,6 +669,157 @@ phStatus_t phalMful_ChkTearingEvent(
     return status;
 }
 
+phStatus_t phalMful_FastWrite(
+                              void * pDataParams,
+                              uint8_t bStartAddr,
+                              uint8_t bEndAddr,
+                              uint8_t * pData
+                              )
+{
+    phStatus_t PH_MEMLOC_REM status = 0;
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMful_FastWrite");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bStartAddr);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bEndAddr);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bStartAddr_log, &bStartAddr);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bEndAddr_log, &bEndAddr);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+    PH_ASSERT_NULL (pData);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFUL)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFUL);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return status;
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFUL_SW
+    case PHAL_MFUL_SW_ID:
+        status = phalMful_Sw_FastWrite((phalMful_Sw_DataParams_t *)pDataParams, bStartAddr, bEndAddr, pData);
+        break;
+#endif /* NXPBUILD__PHAL_MFUL_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFUL);
+        break;
+    }
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+    return status;
+}
+
+phStatus_t phalMful_PassThroughWrite(
+                                     void * pDataParams,
+                                     uint8_t * pData,
+                                     uint16_t wDataLength,
+                                     uint16_t wMaxPolls,
+                                     phalMful_PassThroughStats_t * pStats
+                                     )
+{
+    phStatus_t PH_MEMLOC_REM status = 0;
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMful_PassThroughWrite");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wDataLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wMaxPolls);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wDataLength_log, &wDataLength);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wMaxPolls_log, &wMaxPolls);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+    if (wDataLength) PH_ASSERT_NULL (pData);
+    PH_ASSERT_NULL (pStats);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFUL)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFUL);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return status;
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFUL_SW
+    case PHAL_MFUL_SW_ID:
+        status = phalMful_Sw_PassThroughWrite((phalMful_Sw_DataParams_t *)pDataParams, pData, wDataLength, wMaxPolls, pStats);
+        break;
+#endif /* NXPBUILD__PHAL_MFUL_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFUL);
+        break;
+    }
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+    return status;
+}
+
+phStatus_t phalMful_PassThroughRead(
+                                    void * pDataParams,
+                                    uint8_t * pData,
+                                    uint16_t wDataLength,
+                                    uint16_t wMaxPolls,
+                                    phalMful_PassThroughStats_t * pStats
+                                    )
+{
+    phStatus_t PH_MEMLOC_REM status = 0;
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMful_PassThroughRead");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wDataLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wMaxPolls);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wDataLength_log, &wDataLength);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wMaxPolls_log, &wMaxPolls);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+    if (wDataLength) PH_ASSERT_NULL (pData);
+    PH_ASSERT_NULL (pStats);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFUL)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFUL);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return status;
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFUL_SW
+    case PHAL_MFUL_SW_ID:
+        status = phalMful_Sw_PassThroughRead((phalMful_Sw_DataParams_t *)pDataParams, pData, wDataLength, wMaxPolls, pStats);
+        break;
+#endif /* NXPBUILD__PHAL_MFUL_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFUL);
+        break;
+    }
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+    return status;
+}
+
 #endif /* NXPRDLIB_REM_GEN_INTFS */
 
 #endif /* NXPBUILD__PHAL_MFUL */
@@ -466,4 +466,210 @@ phStatus_t phalMful_Int_ChkTearingEvent(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
 }
 
+phStatus_t phalMful_Int_FastWrite(
+                                  void * pPalMifareDataParams,
+                                  uint8_t bStartAddr,
+                                  uint8_t bEndAddr,
+                                  uint8_t * pData
+                                  )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bCommand[3];
+    uint8_t *   PH_MEMLOC_REM pRxBuffer;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+    uint16_t    PH_MEMLOC_REM wDataLength;
+
+    /* the whole range has to fit into one frame of the SRAM window */
+    wDataLength = (uint16_t)((bEndAddr - bStartAddr + 1) * PHAL_MFUL_WRITE_BLOCK_LENGTH);
+    if ((bEndAddr < bStartAddr) || (wDataLength > PHAL_MFUL_SRAM_LENGTH))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFUL);
+    }
+
+    /* build command frame */
+    bCommand[0] = PHAL_MFUL_CMD_FAST_WRITE;
+    bCommand[1] = bStartAddr;
+    bCommand[2] = bEndAddr;
+
+    /* buffer the command frame */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+        pPalMifareDataParams,
+        PH_EXCHANGE_BUFFER_FIRST,
+        bCommand,
+        3,
+        &pRxBuffer,
+        &wRxLength
+        ));
+
+    /* transmit the data */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+        pPalMifareDataParams,
+        PH_EXCHANGE_BUFFER_LAST,
+        pData,
+        wDataLength,
+        &pRxBuffer,
+        &wRxLength
+        ));
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+}
+
+/* Polls the session registers until the SRAM can be accessed from RF in the given direction. */
+static phStatus_t phalMful_Int_WaitSram(
+                                        void * pPalMifareDataParams,
+                                        uint8_t bRfToI2c,
+                                        uint16_t wMaxPolls,
+                                        phalMful_PassThroughStats_t * pStats
+                                        )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t *   PH_MEMLOC_REM pRegs;
+    uint16_t    PH_MEMLOC_REM wNumBytes;
+    uint16_t    PH_MEMLOC_REM wPoll = 0;
+
+    do
+    {
+        /* NC_REG and NS_REG are in the first two session register pages */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Int_FastRead(
+            pPalMifareDataParams,
+            PHAL_MFUL_SESSION_REG_ADDR,
+            PHAL_MFUL_SESSION_REG_ADDR + 1,
+            &pRegs,
+            &wNumBytes));
+        ++pStats->dwNumPolls;
+
+        /* pass-through is controlled by the I2C host and may be switched off at any time */
+        if (!(pRegs[PHAL_MFUL_SESSION_NC_REG_POS] & PHAL_MFUL_NC_REG_PTHRU_ON_OFF) ||
+            (((pRegs[PHAL_MFUL_SESSION_NC_REG_POS] & PHAL_MFUL_NC_REG_TRANSFER_DIR) ? 1 : 0) != bRfToI2c))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_MFUL);
+        }
+
+        if (bRfToI2c)
+        {
+            /* the I2C host has read the previous frame */
+            if (!(pRegs[PHAL_MFUL_SESSION_NS_REG_POS] & PHAL_MFUL_NS_REG_SRAM_I2C_READY))
+            {
+                return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+            }
+        }
+        else
+        {
+            /* the I2C host has filled the SRAM */
+            if (pRegs[PHAL_MFUL_SESSION_NS_REG_POS] & PHAL_MFUL_NS_REG_SRAM_RF_READY)
+            {
+                return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+            }
+        }
+    }
+    while (++wPoll < wMaxPolls);
+
+    return PH_ADD_COMPCODE(PH_ERR_IO_TIMEOUT, PH_COMP_AL_MFUL);
+}
+
+phStatus_t phalMful_Int_PassThroughWrite(
+                                         void * pPalMifareDataParams,
+                                         uint8_t * pData,
+                                         uint16_t wDataLength,
+                                         uint16_t wMaxPolls,
+                                         phalMful_PassThroughStats_t * pStats
+                                         )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_BUF aFrame[PHAL_MFUL_SRAM_LENGTH];
+    uint16_t    PH_MEMLOC_REM wOffset = 0;
+    uint16_t    PH_MEMLOC_REM wChunk;
+
+    memset(pStats, 0x00, sizeof(phalMful_PassThroughStats_t));  /* PRQA S 3200 */
+
+    /* session registers and SRAM are both in sector 0 */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Int_SectorSelect(pPalMifareDataParams, 0));
+
+    while (wOffset < wDataLength)
+    {
+        wChunk = wDataLength - wOffset;
+        if (wChunk > PHAL_MFUL_SRAM_LENGTH)
+        {
+            wChunk = PHAL_MFUL_SRAM_LENGTH;
+        }
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Int_WaitSram(pPalMifareDataParams, PH_ON, wMaxPolls, pStats));
+
+        if (wChunk == PHAL_MFUL_SRAM_LENGTH)
+        {
+            /* full frames are sent directly from the caller's buffer */
+            PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Int_FastWrite(
+                pPalMifareDataParams,
+                PHAL_MFUL_SRAM_START_ADDR,
+                PHAL_MFUL_SRAM_END_ADDR,
+                &pData[wOffset]));
+        }
+        else
+        {
+            /* the last page has to be written to hand the SRAM over, so pad the last frame */
+            memcpy(aFrame, &pData[wOffset], wChunk);  /* PRQA S 3200 */
+            memset(&aFrame[wChunk], 0x00, PHAL_MFUL_SRAM_LENGTH - wChunk);  /* PRQA S 3200 */
+
+            PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Int_FastWrite(
+                pPalMifareDataParams,
+                PHAL_MFUL_SRAM_START_ADDR,
+                PHAL_MFUL_SRAM_END_ADDR,
+                aFrame));
+        }
+
+        wOffset = wOffset + wChunk;
+        pStats->dwNumBytes += wChunk;
+        ++pStats->wNumFrames;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+}
+
+phStatus_t phalMful_Int_PassThroughRead(
+                                        void * pPalMifareDataParams,
+                                        uint8_t * pData,
+                                        uint16_t wDataLength,
+                                        uint16_t wMaxPolls,
+                                        phalMful_PassThroughStats_t * pStats
+                                        )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t *   PH_MEMLOC_REM pRxBuffer;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+    uint16_t    PH_MEMLOC_REM wOffset = 0;
+    uint16_t    PH_MEMLOC_REM wChunk;
+
+    memset(pStats, 0x00, sizeof(phalMful_PassThroughStats_t));  /* PRQA S 3200 */
+
+    /* session registers and SRAM are both in sector 0 */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Int_SectorSelect(pPalMifareDataParams, 0));
+
+    while (wOffset < wDataLength)
+    {
+        wChunk = wDataLength - wOffset;
+        if (wChunk > PHAL_MFUL_SRAM_LENGTH)
+        {
+            wChunk = PHAL_MFUL_SRAM_LENGTH;
+        }
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Int_WaitSram(pPalMifareDataParams, PH_OFF, wMaxPolls, pStats));
+
+        /* always read up to the last page, this hands the SRAM back to the I2C host */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Int_FastRead(
+            pPalMifareDataParams,
+            PHAL_MFUL_SRAM_START_ADDR,
+            PHAL_MFUL_SRAM_END_ADDR,
+            &pRxBuffer,
+            &wRxLength));
+
+        memcpy(&pData[wOffset], pRxBuffer, wChunk);  /* PRQA S 3200 */
+
+        wOffset = wOffset + wChunk;
+        pStats->dwNumBytes += wChunk;
+        ++pStats->wNumFrames;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+}
+
 #endif /* NXPBUILD__PHAL_MFUL */
@@ -50,6 +50,10 @@
 #define PHAL_MFUL_CMD_READ_SIG  0x3CU   /**< MIFARE Ultralight Read signature command byte */
 #define PHAL_MFUL_CMD_CHK_TRG_EVT   0x3EU   /**< MIFARE Ultralight Check tearing event command byte */
 #define PHAL_MFUL_CMD_SECTOR_SELECT 0xC2U   /**< Type 2 tag sector select command byte */
+#define PHAL_MFUL_CMD_FAST_WRITE    0xA6U   /**< NTAG I2C plus Fast write command byte */
+
+#define PHAL_MFUL_SESSION_NC_REG_POS    0x00U   /**< Position of NC_REG in the session registers. */
+#define PHAL_MFUL_SESSION_NS_REG_POS    0x06U   /**< Position of NS_REG in the session registers. */
 
 #define PHAL_MFUL_PREAMBLE_TX   0xAFU   /**< MIFARE Ultralight preamble byte (tx) for authentication. */
 #define PHAL_MFUL_PREAMBLE_RX   0x00U   /**< MIFARE Ultralight preamble byte (rx) for authentication. */
@@ -124,4 +128,27 @@ phStatus_t phalMful_Int_ChkTearingEvent(
                                         uint8_t * pValidFlag
                                         );
 
+phStatus_t phalMful_Int_FastWrite(
+                                  void * pPalMifareDataParams,
+                                  uint8_t bStartAddr,
+                                  uint8_t bEndAddr,
+                                  uint8_t * pData
+                                  );
+
+phStatus_t phalMful_Int_PassThroughWrite(
+                                         void * pPalMifareDataParams,
+                                         uint8_t * pData,
+                                         uint16_t wDataLength,
+                                         uint16_t wMaxPolls,
+                                         phalMful_PassThroughStats_t * pStats
+                                         );
+
+phStatus_t phalMful_Int_PassThroughRead(
+                                        void * pPalMifareDataParams,
+                                        uint8_t * pData,
+                                        uint16_t wDataLength,
+                                        uint16_t wMaxPolls,
+                                        phalMful_PassThroughStats_t * pStats
+                                        );
+
 #endif /* PHALMFUL_INT_H */
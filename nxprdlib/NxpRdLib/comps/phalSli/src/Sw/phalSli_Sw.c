@@ -27,6 +27,7 @@
 #include <phhalHw.h>
 #include <phalSli.h>
 #include <phpalSli15693.h>
+#include <phalI15693.h>
 #include <ph_RefDefs.h>
 
 #ifdef NXPBUILD__PHAL_SLI_SW
@@ -51,6 +52,9 @@ phStatus_t phalSli_Sw_Init(
     /* init private data */
     pDataParams->wId                    = PH_COMP_AL_SLI | PHAL_SLI_SW_ID;
     pDataParams->pPalSli15693DataParams = pPalSli15693DataParams;
+    pDataParams->bFamily                = PHAL_SLI_FAMILY_UNKNOWN;
+    pDataParams->bFastMode              = PH_OFF;
+    pDataParams->pAlI15693DataParams    = NULL;
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_SLI);
 }
@@ -793,6 +797,196 @@ phStatus_t phalSli_Sw_GetRandomNumberSetPWD(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_SLI);
 }
 
+phStatus_t phalSli_Sw_DetectFamily(
+                                   phalSli_Sw_DataParams_t * pDataParams,
+                                   uint8_t * pFamily
+                                   )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aUid[PHPAL_SLI15693_UID_LENGTH];
+    uint8_t     PH_MEMLOC_REM bUidLength;
+    uint8_t     PH_MEMLOC_REM bProtectionPointer;
+    uint8_t     PH_MEMLOC_REM bProtectionCondition;
+    uint8_t     PH_MEMLOC_REM bLockBits;
+    uint8_t     PH_MEMLOC_REM aFeatureFlags[8];
+    uint8_t     PH_MEMLOC_REM bType;
+
+    *pFamily = PHAL_SLI_FAMILY_UNKNOWN;
+    pDataParams->bFamily = PHAL_SLI_FAMILY_UNKNOWN;
+    pDataParams->bFastMode = PH_OFF;
+
+    /* Retrieve the UID of the addressed tag */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_GetSerialNo(
+        pDataParams->pPalSli15693DataParams,
+        aUid,
+        &bUidLength));
+
+    /* Only NXP ICode tags implement the ICode custom commands; the type bits are only defined for them */
+    if ((bUidLength != PHPAL_SLI15693_UID_LENGTH) ||
+        (aUid[PHAL_SLI_UID_MFR_CODE_POS] != PHAL_SLI_UID_MFR_CODE_NXP) ||
+        (aUid[PHAL_SLI_UID_IC_TYPE_POS] != PHAL_SLI_UID_IC_TYPE_ICODE))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_SLI);
+    }
+
+    bType = aUid[PHAL_SLI_UID_TYPE_POS] & PHAL_SLI_UID_TYPE_MASK;
+
+    /* SLIX2 and DNA answer GET NXP SYSTEM INFORMATION, older families do not */
+    status = phalSli_Sw_GetNxpSystemInfo(
+        pDataParams,
+        &bProtectionPointer,
+        &bProtectionCondition,
+        &bLockBits,
+        aFeatureFlags);
+
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        pDataParams->bFamily = (bType == PHAL_SLI_UID_TYPE_DNA) ? PHAL_SLI_FAMILY_DNA : PHAL_SLI_FAMILY_SLIX2;
+    }
+    else if (((status & PH_ERR_MASK) == PHPAL_SLI15693_ERR_ISO15693) ||
+        ((status & PH_ERR_MASK) == PH_ERR_IO_TIMEOUT) ||
+        ((status & PH_ERR_MASK) == PH_ERR_PROTOCOL_ERROR))
+    {
+        pDataParams->bFamily = (bType == PHAL_SLI_UID_TYPE_SLIX) ? PHAL_SLI_FAMILY_SLIX : PHAL_SLI_FAMILY_SLI;
+    }
+    else
+    {
+        return status;
+    }
+
+    /* All ICode families support the fast custom read commands */
+    pDataParams->bFastMode = PH_ON;
+    *pFamily = pDataParams->bFamily;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_SLI);
+}
+
+phStatus_t phalSli_Sw_SetFastMode(
+                                  phalSli_Sw_DataParams_t * pDataParams,
+                                  uint8_t bFastMode
+                                  )
+{
+    if ((bFastMode != PH_OFF) && (bFastMode != PH_ON))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_SLI);
+    }
+
+    /* The fast commands are only known to be supported by ICode tags */
+    if ((bFastMode != PH_OFF) && (pDataParams->bFamily == PHAL_SLI_FAMILY_UNKNOWN))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_SLI);
+    }
+
+    pDataParams->bFastMode = bFastMode;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_SLI);
+}
+
+phStatus_t phalSli_Sw_GetFastMode(
+                                  phalSli_Sw_DataParams_t * pDataParams,
+                                  uint8_t * pFastMode
+                                  )
+{
+    *pFastMode = pDataParams->bFastMode;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_SLI);
+}
+
+phStatus_t phalSli_Sw_ReadBlocks(
+                                 phalSli_Sw_DataParams_t * pDataParams,
+                                 uint8_t bBlockNo,
+                                 uint16_t wNumBlocks,
+                                 uint8_t * pData,
+                                 uint16_t * pDataLength
+                                 )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t *   PH_MEMLOC_REM pRxBuffer;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+
+    *pDataLength = 0;
+
+    /* Check the block range */
+    if ((wNumBlocks == 0) || (((uint16_t)bBlockNo + wNumBlocks) > 0x100))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_SLI);
+    }
+
+    if (pDataParams->pAlI15693DataParams == NULL)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_SLI);
+    }
+
+    if (pDataParams->bFastMode != PH_OFF)
+    {
+        status = phalSli_Sw_Int_FastReadBlocks(pDataParams, bBlockNo, wNumBlocks, pData, pDataLength);
+        if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+        {
+            return status;
+        }
+
+        /* Fall back to the standard command for this and all further transfers */
+        pDataParams->bFastMode = PH_OFF;
+    }
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalI15693_ReadMultipleBlocks(
+        pDataParams->pAlI15693DataParams,
+        PHAL_I15693_OPTION_OFF,
+        bBlockNo,
+        wNumBlocks,
+        &pRxBuffer,
+        &wRxLength));
+
+    /* Check number of data received */
+    if (wRxLength != (wNumBlocks * PHAL_SLI_BLOCK_SIZE))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_SLI);
+    }
+
+    /* copy received data blocks */
+    memcpy(pData, pRxBuffer, wRxLength); /* PRQA S 3200 */
+    *pDataLength = wRxLength;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_SLI);
+}
+
+phStatus_t phalSli_Sw_WriteBlocks(
+                                  phalSli_Sw_DataParams_t * pDataParams,
+                                  uint8_t bBlockNo,
+                                  uint16_t wNumBlocks,
+                                  uint8_t * pData
+                                  )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wIndex;
+
+    /* Check the block range */
+    if ((wNumBlocks == 0) || (((uint16_t)bBlockNo + wNumBlocks) > 0x100))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_SLI);
+    }
+
+    if (pDataParams->pAlI15693DataParams == NULL)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_SLI);
+    }
+
+    /* ICode has no fast addressed write, write with the caller's flags */
+    for (wIndex = 0; wIndex < wNumBlocks; ++wIndex)
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalI15693_WriteSingleBlock(
+            pDataParams->pAlI15693DataParams,
+            PHAL_I15693_OPTION_OFF,
+            (uint8_t)(bBlockNo + wIndex),
+            &pData[wIndex * PHAL_SLI_BLOCK_SIZE],
+            PHAL_SLI_BLOCK_SIZE));
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_SLI);
+}
+
 phStatus_t phalSli_Sw_Int_SetOptionBit(
                                        phalSli_Sw_DataParams_t * pDataParams,
                                        uint8_t bOption
@@ -837,4 +1031,66 @@ phStatus_t phalSli_Sw_Int_SetOptionBit(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_SLI);
 }
 
+phStatus_t phalSli_Sw_Int_FastReadBlocks(
+                                         phalSli_Sw_DataParams_t * pDataParams,
+                                         uint8_t bBlockNo,
+                                         uint16_t wNumBlocks,
+                                         uint8_t * pData,
+                                         uint16_t * pDataLength
+                                         )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wFlags;
+    uint8_t     PH_MEMLOC_REM aUid[PHPAL_SLI15693_UID_LENGTH];
+    uint8_t     PH_MEMLOC_REM aRxUid[PHPAL_SLI15693_UID_LENGTH];
+    uint8_t     PH_MEMLOC_REM bUidLength;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_GetConfig(
+        pDataParams->pPalSli15693DataParams,
+        PHPAL_SLI15693_CONFIG_FLAGS,
+        &wFlags));
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_GetSerialNo(
+        pDataParams->pPalSli15693DataParams,
+        aUid,
+        &bUidLength));
+
+    if (bUidLength != PHPAL_SLI15693_UID_LENGTH)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_SLI);
+    }
+
+    /* A single slot with the complete UID as mask addresses exactly this tag */
+    status = phpalSli15693_FastInventoryRead(
+        pDataParams->pPalSli15693DataParams,
+        (uint8_t)((wFlags & PHPAL_SLI15693_FLAG_TWO_SUB_CARRIERS) | PHPAL_SLI15693_FLAG_DATA_RATE | PHPAL_SLI15693_FLAG_NBSLOTS),
+        0,
+        aUid,
+        (uint8_t)(PHPAL_SLI15693_UID_LENGTH * 8U),
+        bBlockNo,
+        wNumBlocks,
+        aRxUid,
+        &bUidLength,
+        pData,
+        pDataLength);
+
+    /* The inventory command replaces the flags and leaves the fast RX data rate active */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_SetConfig(
+        pDataParams->pPalSli15693DataParams,
+        PHPAL_SLI15693_CONFIG_FLAGS,
+        wFlags));
+
+    PH_CHECK_SUCCESS(status);
+
+    /* Check number of data received */
+    if (*pDataLength != (wNumBlocks * PHAL_SLI_BLOCK_SIZE))
+    {
+        *pDataLength = 0;
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_SLI);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_SLI);
+}
+
 #endif /* NXPBUILD__PHAL_SLI_SW */
@@ -134,4 +134,34 @@ phStatus_t phalSli_Sw_GetRandomNumberSetPWD(
                                             uint8_t * pPwd
                                             );
 
+phStatus_t phalSli_Sw_DetectFamily(
+                                   phalSli_Sw_DataParams_t * pDataParams,
+                                   uint8_t * pFamily
+                                   );
+
+phStatus_t phalSli_Sw_SetFastMode(
+                                  phalSli_Sw_DataParams_t * pDataParams,
+                                  uint8_t bFastMode
+                                  );
+
+phStatus_t phalSli_Sw_GetFastMode(
+                                  phalSli_Sw_DataParams_t * pDataParams,
+                                  uint8_t * pFastMode
+                                  );
+
+phStatus_t phalSli_Sw_ReadBlocks(
+                                 phalSli_Sw_DataParams_t * pDataParams,
+                                 uint8_t bBlockNo,
+                                 uint16_t wNumBlocks,
+                                 uint8_t * pData,
+                                 uint16_t * pDataLength
+                                 );
+
+phStatus_t phalSli_Sw_WriteBlocks(
+                                  phalSli_Sw_DataParams_t * pDataParams,
+                                  uint8_t bBlockNo,
+                                  uint16_t wNumBlocks,
+                                  uint8_t * pData
+                                  );
+
 #endif /* PHALSLI_SW_H */
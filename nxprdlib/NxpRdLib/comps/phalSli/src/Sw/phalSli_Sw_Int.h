@@ -40,4 +40,20 @@ phStatus_t phalSli_Sw_Int_SetOptionBit(
                                        uint8_t bOption                          /**< [In] Option flag; \c #PH_OFF: disable; \c #PH_ON: enable. */
                                        );
 
+/**
+* \brief Reads blocks with FAST INVENTORY READ addressed by the complete UID.
+*
+* The \ref phpalSli15693 flags and RX data rate are restored afterwards.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalSli_Sw_Int_FastReadBlocks(
+                                         phalSli_Sw_DataParams_t * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                                         uint8_t bBlockNo,                        /**< [In] First block to read. */
+                                         uint16_t wNumBlocks,                     /**< [In] Number of blocks to read. */
+                                         uint8_t * pData,                         /**< [Out] Received block data. */
+                                         uint16_t * pDataLength                   /**< [Out] Number of received data bytes. */
+                                         );
+
 #endif /* PHALSLI_SW_INT_H */
@@ -59,6 +59,22 @@
 #define PHAL_SLI_CMD_READ_SIGNATURE                 0xBD    /**< SLI-S/SLI-L returns an IC specific, 32-byte ECC signature. */
 /*@}*/
 
+/**
+* \name UID fields used for ICode family detection
+*/
+/*@{*/
+#define PHAL_SLI_UID_MFR_CODE_POS                   6       /**< Position of the manufacturer code within the UID. */
+#define PHAL_SLI_UID_MFR_CODE_NXP                   0x04    /**< NXP manufacturer code. */
+#define PHAL_SLI_UID_IC_TYPE_POS                    5       /**< Position of the NXP IC type within the UID. */
+#define PHAL_SLI_UID_IC_TYPE_ICODE                  0x01    /**< IC type of the ICode SLI/SLIX/SLIX2/DNA families. */
+#define PHAL_SLI_UID_TYPE_POS                       4       /**< Position of the ICode type bits within the UID. */
+#define PHAL_SLI_UID_TYPE_MASK                      0x18    /**< Mask of the ICode type bits. */
+#define PHAL_SLI_UID_TYPE_SLI                       0x00    /**< Type bits of an ICode SLI. */
+#define PHAL_SLI_UID_TYPE_SLIX                      0x10    /**< Type bits of an ICode SLIX. */
+#define PHAL_SLI_UID_TYPE_SLIX2                     0x08    /**< Type bits of an ICode SLIX2. */
+#define PHAL_SLI_UID_TYPE_DNA                       0x18    /**< Type bits of an ICode DNA. */
+/*@}*/
+
 /** @}
 * end of ph_Private
 */
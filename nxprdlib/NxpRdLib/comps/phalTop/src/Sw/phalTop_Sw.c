@@ -274,6 +274,13 @@ phStatus_t phalTop_Sw_Init(
     pDataParams->pT4T = pTopT4T;
     pDataParams->pT5T = pTopT5T;
 
+    /* Tag image cache disabled by default */
+    pDataParams->sCache.pImage = NULL;
+    pDataParams->sCache.pValid = NULL;
+    pDataParams->sCache.wImageSize = 0;
+    pDataParams->sCache.bUidLength = 0;
+    pDataParams->sCache.bT4TUidLength = 0;
+
     return phalTop_Sw_Reset(pDataParams);
 }
 
@@ -405,6 +412,9 @@ phStatus_t phalTop_Sw_Reset(
                             )
 {
     void PH_MEMLOC_REM * pAlDataParams;
+#ifdef NXPBUILD__PHAL_MFUL_SW
+    uint8_t PH_MEMLOC_REM bFastRead;
+#endif /* NXPBUILD__PHAL_MFUL_SW */
 
     /* Reset common variables */
     pDataParams->bTagState = 0;
@@ -413,6 +423,10 @@ phStatus_t phalTop_Sw_Reset(
     pDataParams->wNdefLength = 0;
     pDataParams->wMaxNdefLength = 0;
 
+    /* Invalidate tag image cache */
+    phalTop_Sw_CacheInvalidate(&pDataParams->sCache, 0, pDataParams->sCache.wImageSize);
+    pDataParams->sCache.bUidLength = 0;
+
 #ifdef NXPBUILD__PHAL_T1T_SW
     if (pDataParams->pT1T != NULL)
     {
@@ -430,14 +444,17 @@ phStatus_t phalTop_Sw_Reset(
 #ifdef NXPBUILD__PHAL_MFUL_SW
     if (pDataParams->pT2T != NULL)
     {
-        /* Backup T2T layer pointer */
+        /* Backup T2T layer pointer and FAST_READ configuration */
         pAlDataParams = ((phalTop_T2T_t *)(pDataParams->pT2T))->pAlT2TDataParams;
+        bFastRead = ((phalTop_T2T_t *)(pDataParams->pT2T))->bFastRead;
 
         /* Reset T2T data parameters */
         memset(pDataParams->pT2T, 0, sizeof(phalTop_T2T_t));  /* PRQA S 3200 */
 
-        /* Restore T2T layer pointer */
+        /* Restore T2T layer pointer and FAST_READ configuration */
         ((phalTop_T2T_t *)(pDataParams->pT2T))->pAlT2TDataParams  = pAlDataParams;
+        ((phalTop_T2T_t *)(pDataParams->pT2T))->bFastRead  = bFastRead;
+        ((phalTop_T2T_t *)(pDataParams->pT2T))->pCache  = &pDataParams->sCache;
     }
 #endif /* NXPBUILD__PHAL_MFUL_SW */
 
@@ -480,12 +497,151 @@ phStatus_t phalTop_Sw_Reset(
 
         /* Restore T5T layer pointer */
         ((phalTop_T5T_t *)(pDataParams->pT5T))->pAlI15693DataParams  = pAlDataParams;
+        ((phalTop_T5T_t *)(pDataParams->pT5T))->pCache  = &pDataParams->sCache;
     }
 #endif /* NXPBUILD__PHAL_I15693_SW */
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
 }
 
+phStatus_t phalTop_Sw_SetCache(
+                               phalTop_Sw_DataParams_t * pDataParams,
+                               uint8_t * pBuffer,
+                               uint16_t wBufferSize,
+                               uint8_t * pUid,
+                               uint8_t bUidLength
+                               )
+{
+    uint16_t           PH_MEMLOC_REM   wLines;
+    phalTop_Sw_Cache_t PH_MEMLOC_REM * pCache = &pDataParams->sCache;
+
+    if(bUidLength > PHAL_TOP_CACHE_MAX_UID_LENGTH)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_TOP);
+    }
+
+    /* Disable image cache; UID is kept as key of the T4T CC cache */
+    if((pBuffer == NULL) || (wBufferSize <= PHAL_TOP_CACHE_LINE_SIZE))
+    {
+        pCache->pImage = NULL;
+        pCache->pValid = NULL;
+        pCache->wImageSize = 0;
+
+        memcpy(pCache->aUid, pUid, bUidLength);  /* PRQA S 3200 */
+        pCache->bUidLength = bUidLength;
+
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+    }
+
+    /* Keep image if same buffer and same tag */
+    if((pBuffer == pCache->pImage) && (bUidLength != 0) && (bUidLength == pCache->bUidLength) &&
+        (memcmp(pUid, pCache->aUid, bUidLength) == 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+    }
+
+    /* Split buffer in image and valid bitmap; 8 lines take (8 * line size) + 1 bytes */
+    wLines = (uint16_t)((((uint32_t)wBufferSize - 1) * 8) / ((8 * PHAL_TOP_CACHE_LINE_SIZE) + 1));
+
+    pCache->pImage = pBuffer;
+    pCache->wImageSize = wLines * PHAL_TOP_CACHE_LINE_SIZE;
+    pCache->pValid = &pBuffer[pCache->wImageSize];
+    memset(pCache->pValid, 0, ((wLines + 7) / 8));  /* PRQA S 3200 */
+
+    memcpy(pCache->aUid, pUid, bUidLength);  /* PRQA S 3200 */
+    pCache->bUidLength = bUidLength;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+uint8_t phalTop_Sw_CacheRead(
+                             phalTop_Sw_Cache_t * pCache,
+                             uint16_t wAddr,
+                             uint16_t wLength,
+                             uint8_t ** ppData
+                             )
+{
+    uint16_t PH_MEMLOC_COUNT wLine;
+
+    if((pCache == NULL) || (pCache->pImage == NULL) || (wLength == 0) ||
+        (((uint32_t)wAddr + wLength) > pCache->wImageSize))
+    {
+        return PH_OFF;
+    }
+
+    /* All lines overlapping the range need to be valid */
+    for(wLine = (wAddr / PHAL_TOP_CACHE_LINE_SIZE);
+        wLine <= ((wAddr + wLength - 1) / PHAL_TOP_CACHE_LINE_SIZE);
+        wLine++)
+    {
+        if(!(pCache->pValid[wLine / 8] & (uint8_t)(1 << (wLine % 8))))
+        {
+            return PH_OFF;
+        }
+    }
+
+    *ppData = &pCache->pImage[wAddr];
+
+    return PH_ON;
+}
+
+void phalTop_Sw_CacheUpdate(
+                            phalTop_Sw_Cache_t * pCache,
+                            uint16_t wAddr,
+                            uint8_t * pData,
+                            uint16_t wLength
+                            )
+{
+    uint16_t PH_MEMLOC_COUNT wLine;
+
+    if((pCache == NULL) || (pCache->pImage == NULL) || (wAddr >= pCache->wImageSize))
+    {
+        return;
+    }
+
+    if(((uint32_t)wAddr + wLength) > pCache->wImageSize)
+    {
+        wLength = pCache->wImageSize - wAddr;
+    }
+
+    memcpy(&pCache->pImage[wAddr], pData, wLength);  /* PRQA S 3200 */
+
+    /* Mark lines fully covered by data as valid; bytes of other lines are
+     * still tag content, so valid lines stay consistent */
+    for(wLine = ((wAddr + PHAL_TOP_CACHE_LINE_SIZE - 1) / PHAL_TOP_CACHE_LINE_SIZE);
+        wLine < ((wAddr + wLength) / PHAL_TOP_CACHE_LINE_SIZE);
+        wLine++)
+    {
+        pCache->pValid[wLine / 8] |= (uint8_t)(1 << (wLine % 8));
+    }
+}
+
+void phalTop_Sw_CacheInvalidate(
+                                phalTop_Sw_Cache_t * pCache,
+                                uint16_t wAddr,
+                                uint16_t wLength
+                                )
+{
+    uint16_t PH_MEMLOC_COUNT wLine;
+
+    if((pCache == NULL) || (pCache->pImage == NULL) || (wLength == 0) || (wAddr >= pCache->wImageSize))
+    {
+        return;
+    }
+
+    if(((uint32_t)wAddr + wLength) > pCache->wImageSize)
+    {
+        wLength = pCache->wImageSize - wAddr;
+    }
+
+    for(wLine = (wAddr / PHAL_TOP_CACHE_LINE_SIZE);
+        wLine <= ((wAddr + wLength - 1) / PHAL_TOP_CACHE_LINE_SIZE);
+        wLine++)
+    {
+        pCache->pValid[wLine / 8] &= (uint8_t)~(1 << (wLine % 8));
+    }
+}
+
 phStatus_t phalTop_Sw_SetConfig(
                                 phalTop_Sw_DataParams_t * pDataParams,
                                 uint16_t wConfig,
@@ -559,6 +715,15 @@ phStatus_t phalTop_Sw_SetConfig(
 
         ((phalTop_T2T_t *)(pDataParams->pT2T))->bTms = (uint8_t)(wValue / 8);
         break;
+
+    case PHAL_TOP_CONFIG_T2T_FAST_READ:
+        if((wValue != PH_ON) && (wValue != PH_OFF))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_TOP);
+        }
+
+        ((phalTop_T2T_t *)(pDataParams->pT2T))->bFastRead = (uint8_t)(wValue);
+        break;
 #endif /* NXPBUILD__PHAL_MFUL_SW */
 
 #ifdef NXPBUILD__PHAL_MFDF_SW
@@ -655,6 +820,24 @@ phStatus_t phalTop_Sw_SetConfig(
 
         ((phalTop_T5T_t *)(pDataParams->pT5T))->bTerminatorTlvPresence = (uint8_t)(wValue);
         break;
+
+    case PHAL_TOP_CONFIG_T5T_MBWRITE:
+        if((wValue != PH_ON) && (wValue != PH_OFF))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_TOP);
+        }
+
+        ((phalTop_T5T_t *)(pDataParams->pT5T))->bMbWrite = (uint8_t)(wValue);
+        break;
+
+    case PHAL_TOP_CONFIG_T5T_WRITE_VERIFY:
+        if((wValue != PH_ON) && (wValue != PH_OFF))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_TOP);
+        }
+
+        ((phalTop_T5T_t *)(pDataParams->pT5T))->bWriteVerify = (uint8_t)(wValue);
+        break;
 #endif /* NXPBUILD__PHAL_I15693_SW */
 
     default:
@@ -692,6 +875,12 @@ phStatus_t phalTop_Sw_GetConfig(
         *wValue = pDataParams->bVno;
         break;
 
+#ifdef NXPBUILD__PHAL_MFUL_SW
+    case PHAL_TOP_CONFIG_T2T_FAST_READ:
+        *wValue = ((phalTop_T2T_t *)(pDataParams->pT2T))->bFastReadSupported;
+        break;
+#endif /* NXPBUILD__PHAL_MFUL_SW */
+
     default:
         return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_TOP);
     }
@@ -49,6 +49,34 @@ phStatus_t phalTop_Sw_Reset(
                             phalTop_Sw_DataParams_t * pDataParams
                             );
 
+phStatus_t phalTop_Sw_SetCache(
+                               phalTop_Sw_DataParams_t * pDataParams,
+                               uint8_t * pBuffer,
+                               uint16_t wBufferSize,
+                               uint8_t * pUid,
+                               uint8_t bUidLength
+                               );
+
+uint8_t phalTop_Sw_CacheRead(
+                             phalTop_Sw_Cache_t * pCache,
+                             uint16_t wAddr,
+                             uint16_t wLength,
+                             uint8_t ** ppData
+                             );
+
+void phalTop_Sw_CacheUpdate(
+                            phalTop_Sw_Cache_t * pCache,
+                            uint16_t wAddr,
+                            uint8_t * pData,
+                            uint16_t wLength
+                            );
+
+void phalTop_Sw_CacheInvalidate(
+                                phalTop_Sw_Cache_t * pCache,
+                                uint16_t wAddr,
+                                uint16_t wLength
+                                );
+
 phStatus_t phalTop_Sw_SetConfig(
                                 phalTop_Sw_DataParams_t * pDataParams,
                                 uint16_t wConfig,
@@ -29,6 +29,7 @@
 #ifdef NXPBUILD__PHAL_TOP_SW
 #ifdef NXPBUILD__PHAL_MFUL_SW
 
+#include "phalTop_Sw.h"
 #include "phalTop_Sw_Int_T2T.h"
 
 phStatus_t phalTop_Sw_Int_T2T_SetReadOnly(
@@ -229,6 +230,7 @@ phStatus_t phalTop_Sw_Int_T2T_ClearState(
     pT2T->sSector.bAddress = 0;
     pT2T->sSector.bBlockAddress = 0;
     pT2T->sSector.bValidity = PH_OFF;
+    pT2T->bFastReadSupported = PH_OFF;
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
 }
@@ -528,6 +530,19 @@ phStatus_t phalTop_Sw_Int_T2T_CheckNdef(
         pT2T,
         0x00));
 
+    /* Detect FAST_READ support (NTAG21x/NTAG I2C, MIFARE Ultralight EV1) */
+    if(pT2T->bFastRead == PH_ON)
+    {
+        status = phalMful_GetVersion(pT2T->pAlT2TDataParams, aData);
+
+        if(((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+            && (aData[1] == PHAL_TOP_T2T_VERSION_VENDOR_NXP)
+            && ((aData[2] == PHAL_TOP_T2T_VERSION_TYPE_NTAG) || (aData[2] == PHAL_TOP_T2T_VERSION_TYPE_MFUL)))
+        {
+            pT2T->bFastReadSupported = PH_ON;
+        }
+    }
+
     /* Update state in out parameter */
     *pTagState = pDataParams->bTagState;
 
@@ -773,6 +788,16 @@ phStatus_t phalTop_Sw_Int_T2T_Read(
                                    )
 {
     phStatus_t PH_MEMLOC_REM status;
+    uint8_t    PH_MEMLOC_REM * pCached;
+
+    /* Serve from tag image cache if in current sector */
+    if((pT2T->sSector.bAddress == (uint8_t)(wOffset / PHAL_TOP_T2T_SECTOR_SIZE)) &&
+        (phalTop_Sw_CacheRead(pT2T->pCache, wOffset, PHAL_TOP_T2T_READ_LENGTH, &pCached) == PH_ON))
+    {
+        memcpy(pData, pCached, PHAL_TOP_T2T_READ_LENGTH);  /* PRQA S 3200 */
+
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+    }
 
     /* Check if read offset is in current sector */
     if(pT2T->sSector.bAddress != (uint8_t)(wOffset / PHAL_TOP_T2T_SECTOR_SIZE))
@@ -792,6 +817,69 @@ phStatus_t phalTop_Sw_Int_T2T_Read(
         (uint8_t)((wOffset % PHAL_TOP_T2T_SECTOR_SIZE) / PHAL_TOP_T2T_BYTES_PER_BLOCK),
         pData));
 
+    phalTop_Sw_CacheUpdate(pT2T->pCache, wOffset, pData, PHAL_TOP_T2T_READ_LENGTH);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+phStatus_t phalTop_Sw_Int_T2T_FastRead(
+                                       phalTop_T2T_t * pT2T,
+                                       uint16_t wOffset,
+                                       uint16_t wLength,
+                                       uint8_t ** ppData,
+                                       uint16_t * pDataLen
+                                       )
+{
+    phStatus_t PH_MEMLOC_REM status;
+    uint16_t   PH_MEMLOC_REM wStartPage;
+    uint16_t   PH_MEMLOC_REM wEndPage;
+
+    /* Check if read offset is in current sector */
+    if(pT2T->sSector.bAddress != (uint8_t)(wOffset / PHAL_TOP_T2T_SECTOR_SIZE))
+    {
+        PH_CHECK_SUCCESS_FCT(status, phalMful_SectorSelect(
+            pT2T->pAlT2TDataParams,
+            (uint8_t)(wOffset / PHAL_TOP_T2T_SECTOR_SIZE)));
+
+        PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T2T_UpdateLockReservedOtp(
+            pT2T,
+            (uint8_t)(wOffset / PHAL_TOP_T2T_SECTOR_SIZE)));
+    }
+
+    /* Pages covering the requested range, limited to frame size and sector */
+    wStartPage = (wOffset % PHAL_TOP_T2T_SECTOR_SIZE) / PHAL_TOP_T2T_BYTES_PER_BLOCK;
+    wEndPage = wStartPage + ((wLength + PHAL_TOP_T2T_BYTES_PER_BLOCK - 1) / PHAL_TOP_T2T_BYTES_PER_BLOCK) - 1;
+
+    if(wEndPage >= (wStartPage + PHAL_TOP_T2T_FAST_READ_MAX_PAGES))
+    {
+        wEndPage = wStartPage + PHAL_TOP_T2T_FAST_READ_MAX_PAGES - 1;
+    }
+    if(wEndPage > PHAL_TOP_T2T_BLOCKS_PER_SECTOR)
+    {
+        wEndPage = PHAL_TOP_T2T_BLOCKS_PER_SECTOR;
+    }
+
+    wOffset = (wOffset - (wOffset % PHAL_TOP_T2T_SECTOR_SIZE)) + (wStartPage * PHAL_TOP_T2T_BYTES_PER_BLOCK);
+    wLength = ((wEndPage - wStartPage) + 1) * PHAL_TOP_T2T_BYTES_PER_BLOCK;
+
+    /* Serve from tag image cache */
+    if(phalTop_Sw_CacheRead(pT2T->pCache, wOffset, wLength, ppData) == PH_ON)
+    {
+        *pDataLen = wLength;
+
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+    }
+
+    /* Read data; returned in HAL RX buffer */
+    PH_CHECK_SUCCESS_FCT(status, phalMful_FastRead(
+        pT2T->pAlT2TDataParams,
+        (uint8_t)wStartPage,
+        (uint8_t)wEndPage,
+        ppData,
+        pDataLen));
+
+    phalTop_Sw_CacheUpdate(pT2T->pCache, wOffset, *ppData, *pDataLen);
+
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
 }
 
@@ -802,6 +890,14 @@ phStatus_t phalTop_Sw_Int_T2T_Write(
                                     )
 {
     phStatus_t PH_MEMLOC_REM status;
+    uint8_t    PH_MEMLOC_REM * pCached;
+
+    /* Skip write if tag already holds the data */
+    if((phalTop_Sw_CacheRead(pT2T->pCache, wOffset, PHAL_TOP_T2T_BYTES_PER_BLOCK, &pCached) == PH_ON) &&
+        (memcmp(pCached, pData, PHAL_TOP_T2T_BYTES_PER_BLOCK) == 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+    }
 
     /* Check if write offset is in current sector */
     if(pT2T->sSector.bAddress != (uint8_t)(wOffset / PHAL_TOP_T2T_SECTOR_SIZE))
@@ -821,6 +917,17 @@ phStatus_t phalTop_Sw_Int_T2T_Write(
         (uint8_t)((wOffset % PHAL_TOP_T2T_SECTOR_SIZE) / PHAL_TOP_T2T_BYTES_PER_BLOCK),
         pData));
 
+    /* Lock/OTP bits are OR-ed by tag; re-read such blocks */
+    if((wOffset < PHAL_TOP_T2T_DATA_AREA_OFFSET) || (!phalTop_Sw_Int_T2T_CheckLockReservedOtp(pT2T,
+        ((wOffset % PHAL_TOP_T2T_SECTOR_SIZE) / PHAL_TOP_T2T_BYTES_PER_BLOCK))))
+    {
+        phalTop_Sw_CacheInvalidate(pT2T->pCache, wOffset, PHAL_TOP_T2T_BYTES_PER_BLOCK);
+    }
+    else
+    {
+        phalTop_Sw_CacheUpdate(pT2T->pCache, wOffset, pData, PHAL_TOP_T2T_BYTES_PER_BLOCK);
+    }
+
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
 }
 
@@ -836,6 +943,8 @@ phStatus_t phalTop_Sw_Int_T2T_ReadNdef(
     uint16_t      PH_MEMLOC_COUNT wCount;
     uint8_t       PH_MEMLOC_BUF   aData[16];
     uint16_t      PH_MEMLOC_REM   wIndexInit = 0;
+    uint8_t       PH_MEMLOC_BUF * pRxData;
+    uint16_t      PH_MEMLOC_REM   wRxLength;
     phalTop_T2T_t PH_MEMLOC_REM * pT2T = pDataParams->pT2T;
 
     /* Reset NDEF length */
@@ -861,6 +970,40 @@ phStatus_t phalTop_Sw_Int_T2T_ReadNdef(
     /* Block to start read */
     wIndexInit = pT2T->wNdefMsgAddr % PHAL_TOP_T2T_BYTES_PER_BLOCK;
 
+    /* Read NDEF data in as few FAST_READ frames as possible */
+    if(pT2T->bFastReadSupported == PH_ON)
+    {
+        for(wIndex = pT2T->wNdefMsgAddr - wIndexInit, wTempIndex = 0;
+            wTempIndex < pDataParams->wNdefLength;
+            wIndex += wRxLength)
+        {
+            PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T2T_FastRead(
+                pT2T,
+                wIndex,
+                (pDataParams->wNdefLength - wTempIndex) + wIndexInit,
+                &pRxData,
+                &wRxLength));
+
+            /* Copy valid data bytes, skipping lock/reserved/OTP blocks */
+            for(wCount = wIndexInit; ((wCount < wRxLength) && (wTempIndex < pDataParams->wNdefLength)); wCount++)
+            {
+                if(phalTop_Sw_Int_T2T_CheckLockReservedOtp(pT2T,
+                    (((wIndex + wCount) % PHAL_TOP_T2T_SECTOR_SIZE) / PHAL_TOP_T2T_BYTES_PER_BLOCK)))
+                {
+                    pData[wTempIndex] = pRxData[wCount];
+                    wTempIndex++;
+                }
+            }
+
+            wIndexInit = 0;
+        }
+
+        /* Update NDEF length */
+        *pLength = pDataParams->wNdefLength;
+
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+    }
+
     /* Read NDEF data */
     for(wIndex = pT2T->wNdefMsgAddr, wTempIndex = 0;
         wTempIndex < pDataParams->wNdefLength;
@@ -34,6 +34,8 @@
 #define PHAL_TOP_T2T_CC_BLOCK                    0x03U        /**< CC block number */
 #define PHAL_TOP_T2T_STATIC_LOCK_BLOCK           0x02U        /**< Static lock block number */
 #define PHAL_TOP_T2T_BYTES_PER_BLOCK             0x04U        /**< Number of bytes per block */
+#define PHAL_TOP_T2T_READ_LENGTH                 0x10U        /**< Number of bytes returned by READ command */
+#define PHAL_TOP_T2T_DATA_AREA_OFFSET            0x10U        /**< Offset of data area; UID, lock and CC blocks before */
 #define PHAL_TOP_T2T_NDEF_TLV_HEADER_LEN         0x01U        /**< NDEF TLV header(T field) length */
 
 #define PHAL_TOP_T2T_NULL_TLV                    0x00U        /**< NULL TLV. */
@@ -49,6 +51,11 @@
 /**< Get length of TLV length field */
 #define PHAL_TOP_T2T_GET_TLV_LEN_BYTES(len)      ((len) > 0xFE? 3: 1)
 
+#define PHAL_TOP_T2T_FAST_READ_MAX_PAGES         0x3CU        /**< Max pages per FAST_READ; 240 bytes + CRC fits a 256 byte frame */
+#define PHAL_TOP_T2T_VERSION_VENDOR_NXP          0x04U        /**< GET_VERSION vendor ID of NXP */
+#define PHAL_TOP_T2T_VERSION_TYPE_MFUL           0x03U        /**< GET_VERSION product type of MIFARE Ultralight EV1 */
+#define PHAL_TOP_T2T_VERSION_TYPE_NTAG           0x04U        /**< GET_VERSION product type of NTAG */
+
 void phalTop_Sw_Int_T2T_CalculateMaxNdefSize(
                                              phalTop_Sw_DataParams_t * pDataParams,
                                              phalTop_T2T_t * pT2T
@@ -64,6 +71,14 @@ uint8_t phalTop_Sw_Int_T2T_CheckLockReservedOtp(
                                                 uint16_t wIndex
                                                 );
 
+phStatus_t phalTop_Sw_Int_T2T_FastRead(
+                                       phalTop_T2T_t * pT2T,
+                                       uint16_t wOffset,
+                                       uint16_t wLength,
+                                       uint8_t ** ppData,
+                                       uint16_t * pDataLen
+                                       );
+
 phStatus_t phalTop_Sw_Int_T2T_DetectTlvBlocks(
                                               phalTop_Sw_DataParams_t * pDataParams,
                                               phalTop_T2T_t * pT2T
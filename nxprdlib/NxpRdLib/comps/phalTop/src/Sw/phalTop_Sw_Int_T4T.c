@@ -25,6 +25,8 @@
 #include <ph_RefDefs.h>
 #include <phacDiscLoop.h>
 #include <phalMfdf.h>
+#include <phpalMifare.h>
+#include <phpalI14443p4.h>
 #include <phalTop.h>
 
 #ifdef NXPBUILD__PHAL_TOP_SW
@@ -32,6 +34,10 @@
 
 #include "phalTop_Sw_Int_T4T.h"
 
+/* Frame sizes coded by FSDI / FSCI, refer ISO/IEC 14443-4 */
+static const uint16_t PH_MEMLOC_CONST_ROM aT4TFrameSizes[13] = {16, 24, 32,
+    40, 48, 64, 96, 128, 256, 512, 1024, 2048, 4096};
+
 phStatus_t phalTop_Sw_Int_T4T_ClearState(
                                          phalTop_Sw_DataParams_t * pDataParams,
                                          phalTop_T4T_t * pT4T
@@ -82,6 +88,119 @@ phStatus_t phalTop_Sw_Int_T4T_ClearState(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
 }
 
+phStatus_t phalTop_Sw_Int_T4T_GetChunkSize(
+                                           phalTop_T4T_t * pT4T,
+                                           uint8_t bRead,
+                                           uint16_t wMaxLength,
+                                           uint16_t * pChunkSize
+                                           )
+{
+    phStatus_t                 PH_MEMLOC_REM status;
+    uint16_t                   PH_MEMLOC_REM wFsi;
+    uint16_t                   PH_MEMLOC_REM wCid;
+    uint16_t                   PH_MEMLOC_REM wRxBufferSize;
+    uint16_t                   PH_MEMLOC_REM wFrameSize;
+    uint16_t                   PH_MEMLOC_REM wOverhead;
+    uint16_t                   PH_MEMLOC_REM wBlocks;
+    phalMfdf_Sw_DataParams_t   PH_MEMLOC_REM * pAlMfdf = (phalMfdf_Sw_DataParams_t *)(pT4T->pAlT4TDataParams);
+    phpalMifare_Sw_DataParams_t PH_MEMLOC_REM * pPalMifare = (phpalMifare_Sw_DataParams_t *)(pAlMfdf->pPalMifareDataParams);
+
+    PH_CHECK_SUCCESS_FCT(status, phpalI14443p4_GetConfig(
+        pPalMifare->pPalI14443p4DataParams,
+        PHPAL_I14443P4_CONFIG_FSI,
+        &wFsi));
+
+    PH_CHECK_SUCCESS_FCT(status, phpalI14443p4_GetConfig(
+        pPalMifare->pPalI14443p4DataParams,
+        PHPAL_I14443P4_CONFIG_CID,
+        &wCid));
+
+    if(bRead != PH_OFF)
+    {
+        /* R-APDU is received in frames of FSD */
+        wFsi = (uint16_t)(wFsi >> 8);
+        wOverhead = PHAL_TOP_T4T_RAPDU_TRAILER_LENGTH;
+
+        /* Complete response has to fit into the Rx buffer without phalMfdf
+         * interrupting the chaining */
+        PH_CHECK_SUCCESS_FCT(status, phhalHw_GetConfig(
+            pAlMfdf->pHalDataParams,
+            PHHAL_HW_CONFIG_RXBUFFER_BUFSIZE,
+            &wRxBufferSize));
+
+        if(wRxBufferSize > (PHAL_TOP_T4T_RX_BUFFER_MARGIN + wOverhead))
+        {
+            wRxBufferSize -= (PHAL_TOP_T4T_RX_BUFFER_MARGIN + wOverhead);
+            wMaxLength = (wMaxLength < wRxBufferSize)? wMaxLength : wRxBufferSize;
+        }
+    }
+    else
+    {
+        /* C-APDU is sent in frames of FSC */
+        wFsi = (uint16_t)(wFsi & 0x00FF);
+        wOverhead = PHAL_TOP_T4T_CAPDU_HEADER_LENGTH;
+    }
+
+    if(wFsi > 12)
+    {
+        wFsi = 12;
+    }
+
+    /* Information field of one I-block */
+    wFrameSize = aT4TFrameSizes[wFsi] - PHAL_TOP_T4T_BLOCK_OVERHEAD;
+    if(wCid & 0xFF00)
+    {
+        wFrameSize--;
+    }
+
+    /* Largest length for which the APDU fills whole I-blocks, so that
+     * no partially filled block is chained in between */
+    wBlocks = (uint16_t)(((uint32_t)wMaxLength + wOverhead) / wFrameSize);
+
+    if((wBlocks != 0) && ((wBlocks * wFrameSize) > wOverhead))
+    {
+        *pChunkSize = (wBlocks * wFrameSize) - wOverhead;
+    }
+    else
+    {
+        *pChunkSize = wMaxLength;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+phStatus_t phalTop_Sw_Int_T4T_ReadBinary(
+                                         phalTop_T4T_t * pT4T,
+                                         uint8_t bOffset,
+                                         uint8_t bSfid,
+                                         uint16_t wLength,
+                                         uint8_t ** ppRxBuffer,
+                                         uint16_t * pBytesRead
+                                         )
+{
+    if(wLength > PHAL_TOP_T4T_SHORT_APDU_MAX_LENGTH)
+    {
+        /* Extended length Le */
+        return phalMfdf_IsoReadBinaryExt(
+            pT4T->pAlT4TDataParams,
+            PH_EXCHANGE_DEFAULT,
+            bOffset,
+            bSfid,
+            wLength,
+            ppRxBuffer,
+            pBytesRead);
+    }
+
+    return phalMfdf_IsoReadBinary(
+        pT4T->pAlT4TDataParams,
+        PH_EXCHANGE_DEFAULT,
+        bOffset,
+        bSfid,
+        (uint8_t)wLength,
+        ppRxBuffer,
+        pBytesRead);
+}
+
 phStatus_t phalTop_Sw_Int_T4T_CheckNdef(
                                         phalTop_Sw_DataParams_t * pDataParams,
                                         uint8_t * pTagState
@@ -95,6 +214,7 @@ phStatus_t phalTop_Sw_Int_T4T_CheckNdef(
     uint8_t       PH_MEMLOC_REM * pFCI;
     uint16_t      PH_MEMLOC_REM wFCILen;
     phalTop_T4T_t PH_MEMLOC_REM * pT4T = pDataParams->pT4T;
+    phalTop_Sw_Cache_t PH_MEMLOC_REM * pCache = &pDataParams->sCache;
 
     /* Reset tag state */
     *pTagState = PHAL_TOP_STATE_NONE;
@@ -123,28 +243,46 @@ phStatus_t phalTop_Sw_Int_T4T_CheckNdef(
 
     pT4T->bCurrentSelectedFile = PHAL_TOP_T4T_SELECTED_NDEF_APP;
 
-    /* Select the Capability Container (CC) file */
-    PH_CHECK_SUCCESS_FCT(status, phalMfdf_IsoSelectFile(
-        pT4T->pAlT4TDataParams,
-        0x0C,
-        0x00,
-        aFidCc,
-        NULL,
-        0x00,
-        &pFCI,
-        &wFCILen));
+    if((pCache->bUidLength != 0) && (pCache->bUidLength == pCache->bT4TUidLength) &&
+        (memcmp(pCache->aUid, pCache->aT4TUid, pCache->bUidLength) == 0))
+    {
+        /* Same tag as in a previous session, use the cached CC file */
+        pRxBuffer = pCache->aT4TCc;
+    }
+    else
+    {
+        /* Select the Capability Container (CC) file */
+        PH_CHECK_SUCCESS_FCT(status, phalMfdf_IsoSelectFile(
+            pT4T->pAlT4TDataParams,
+            0x0C,
+            0x00,
+            aFidCc,
+            NULL,
+            0x00,
+            &pFCI,
+            &wFCILen));
 
-    pT4T->bCurrentSelectedFile = PHAL_TOP_T4T_SELECTED_CC_FILE;
+        pT4T->bCurrentSelectedFile = PHAL_TOP_T4T_SELECTED_CC_FILE;
 
-    /* Read the CC file */
-    PH_CHECK_SUCCESS_FCT(status, phalMfdf_IsoReadBinary(
-        pT4T->pAlT4TDataParams,
-        PH_EXCHANGE_DEFAULT,
-        0x00,
-        0x00,
-        0x0F,
-        &pRxBuffer,
-        &wBytesRead));
+        /* Read the CC file */
+        PH_CHECK_SUCCESS_FCT(status, phalMfdf_IsoReadBinary(
+            pT4T->pAlT4TDataParams,
+            PH_EXCHANGE_DEFAULT,
+            0x00,
+            0x00,
+            0x0F,
+            &pRxBuffer,
+            &wBytesRead));
+
+        /* Keep CC file for later sessions with the same tag */
+        pCache->bT4TUidLength = 0;
+        if((pCache->bUidLength != 0) && (wBytesRead >= PHAL_TOP_CACHE_T4T_CC_LENGTH))
+        {
+            memcpy(pCache->aT4TCc, pRxBuffer, PHAL_TOP_CACHE_T4T_CC_LENGTH);  /* PRQA S 3200 */
+            memcpy(pCache->aT4TUid, pCache->aUid, pCache->bUidLength);  /* PRQA S 3200 */
+            pCache->bT4TUidLength = pCache->bUidLength;
+        }
+    }
 
     /* Validate CC length (CCLEN) */
     if((((uint16_t)pRxBuffer[0] << 8) | pRxBuffer[1]) < 0x0F)
@@ -325,6 +463,9 @@ phStatus_t phalTop_Sw_Int_T4T_FormatNdef(
         return PH_ADD_COMPCODE(PHAL_TOP_ERR_FORMATTED_TAG, PH_COMP_AL_TOP);
     }
 
+    /* CC file is rewritten, drop the cached one */
+    pDataParams->sCache.bT4TUidLength = 0;
+
     /* Validate and update NDEF file ID */
     if(!(((((uint16_t)pT4T->aNdefFileID[1] << 8) | pT4T->aNdefFileID[0]) == 0x0000) ||
         ((((uint16_t)pT4T->aNdefFileID[1] << 8) | pT4T->aNdefFileID[0]) == 0xE102) ||
@@ -591,8 +732,13 @@ phStatus_t phalTop_Sw_Int_T4T_ReadNdef(
     /* NDEF length to be read */
     wNdefLen = pDataParams->wNdefLength;
 
-    /* Max read length in single command is from 1 - 255 */
-    wReadLength = (pT4T->wMLe < 0xFF)? pT4T->wMLe : 0xFF;
+    /* Max read length in single command is from 1 - 255, or up to MLe
+     * with extended length Le if the CC announces MLe > 255 */
+    PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T4T_GetChunkSize(
+        pT4T,
+        PH_ON,
+        pT4T->wMLe,
+        &wReadLength));
 
     for(wCount = 0; wNdefLen > wReadLength; wNdefLen -= wReadLength, wCount += wReadLength)
     {
@@ -602,12 +748,11 @@ phStatus_t phalTop_Sw_Int_T4T_ReadNdef(
         P1 = (uint8_t)((wOffset & 0xFF00) >> 8);
         P2 = (uint8_t)(wOffset & 0x00FF);
 
-        PH_CHECK_SUCCESS_FCT(status, phalMfdf_IsoReadBinary(
-            pT4T->pAlT4TDataParams,
-            PH_EXCHANGE_DEFAULT,
+        PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T4T_ReadBinary(
+            pT4T,
             P2,
             P1,
-            (uint8_t)wReadLength,
+            wReadLength,
             &pRxBuffer,
             &wBytesRead));
 
@@ -621,12 +766,11 @@ phStatus_t phalTop_Sw_Int_T4T_ReadNdef(
     P1 = (uint8_t)((wOffset & 0xFF00) >> 8);
     P2 = (uint8_t)(wOffset & 0x00FF);
 
-    PH_CHECK_SUCCESS_FCT(status, phalMfdf_IsoReadBinary(
-        pT4T->pAlT4TDataParams,
-        PH_EXCHANGE_DEFAULT,
+    PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T4T_ReadBinary(
+        pT4T,
         P2,
         P1,
-        (uint8_t)wNdefLen,
+        wNdefLen,
         &pRxBuffer,
         &wBytesRead));
 
@@ -688,7 +832,11 @@ phStatus_t phalTop_Sw_Int_T4T_WriteNdef(
     wNdefLen = wLength;
 
     /* Max write length in single command is from 1 - 255 */
-    wWriteLength = (pT4T->wMLc < 0xFF)? pT4T->wMLc : 0xFF;
+    PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T4T_GetChunkSize(
+        pT4T,
+        PH_OFF,
+        ((pT4T->wMLc < PHAL_TOP_T4T_SHORT_APDU_MAX_LENGTH)? pT4T->wMLc : PHAL_TOP_T4T_SHORT_APDU_MAX_LENGTH),
+        &wWriteLength));
 
     /* Write the NDEF message from 2nd Byte in memory */
     for(wCount = 0; wNdefLen > wWriteLength; wNdefLen -= wWriteLength, wCount += wWriteLength)
@@ -48,11 +48,33 @@
 #define PHAL_TOP_T4T_NDEF_FILE_WRITE_ACCESS         0x00U        /**< Read/Write access */
 #define PHAL_TOP_T4T_NDEF_FILE_NO_WRITE_ACCESS      0xFFU        /**< Read Only access */
 
+#define PHAL_TOP_T4T_SHORT_APDU_MAX_LENGTH          0xFFU        /**< Max. Lc / Le of a short length APDU */
+#define PHAL_TOP_T4T_RAPDU_TRAILER_LENGTH           0x02U        /**< SW1 SW2 following the R-APDU data */
+#define PHAL_TOP_T4T_CAPDU_HEADER_LENGTH            0x05U        /**< CLA INS P1 P2 Lc preceding the C-APDU data */
+#define PHAL_TOP_T4T_BLOCK_OVERHEAD                 0x03U        /**< PCB and CRC of an I-block */
+#define PHAL_TOP_T4T_RX_BUFFER_MARGIN               0x40U        /**< Rx buffer space phalMfdf keeps free for one more chained frame */
+
 phStatus_t phalTop_Sw_Int_T4T_ClearState(
                                          phalTop_Sw_DataParams_t * pDataParams,
                                          phalTop_T4T_t * pT4T
                                          );
 
+phStatus_t phalTop_Sw_Int_T4T_GetChunkSize(
+                                           phalTop_T4T_t * pT4T,
+                                           uint8_t bRead,
+                                           uint16_t wMaxLength,
+                                           uint16_t * pChunkSize
+                                           );
+
+phStatus_t phalTop_Sw_Int_T4T_ReadBinary(
+                                         phalTop_T4T_t * pT4T,
+                                         uint8_t bOffset,
+                                         uint8_t bSfid,
+                                         uint16_t wLength,
+                                         uint8_t ** ppRxBuffer,
+                                         uint16_t * pBytesRead
+                                         );
+
 phStatus_t phalTop_Sw_Int_T4T_CheckNdef(
                                         phalTop_Sw_DataParams_t * pDataParams,
                                         uint8_t * pNdefPresence
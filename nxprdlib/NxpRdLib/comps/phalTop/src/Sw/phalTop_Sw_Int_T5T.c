@@ -31,6 +31,7 @@
 
 #ifdef NXPBUILD__PHAL_I15693_SW
 
+#include "phalTop_Sw.h"
 #include "phalTop_Sw_Int_T5T.h"
 
 phStatus_t phalTop_Sw_Int_LockBlock(
@@ -73,12 +74,21 @@ phStatus_t phalTop_Sw_Int_T5T_Read(
 {
     phStatus_t PH_MEMLOC_REM status;
     uint8_t    PH_MEMLOC_REM bOptionFlag = PHAL_I15693_OPTION_OFF;
+    uint16_t   PH_MEMLOC_COUNT wIndex;
 
     if(pT5T->bSplFrm == 1)
     {
         bOptionFlag = PHAL_I15693_OPTION_ON;
     }
 
+    /* Serve from tag image cache */
+    if(phalTop_Sw_CacheRead(pT5T->pCache, (wBlockNum * pT5T->bBlockSize), (wNumberOfBlocks * pT5T->bBlockSize), pRxBuffer) == PH_ON)
+    {
+        *wLength = wNumberOfBlocks * pT5T->bBlockSize;
+
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+    }
+
     if(wNumberOfBlocks == PHAL_TOP_T5T_MIMIMUM_NO_OF_BLOCK)
     {
         if(wBlockNum <= PHAL_TOP_T5T_DEFAULT_BLOCK_NUMBER)
@@ -135,7 +145,13 @@ phStatus_t phalTop_Sw_Int_T5T_Read(
         /*Check if Special Frame of Tag and the Option Flag during Transmit is enabled. Then discard the Block security Status Bytes depending on the number of blocks*/
         if ((pT5T->bSplFrm == 1) && (pT5T->bOptionFlag == PH_ON ))
         {
-            wLength = wLength -wBlockNum;
+            for(wIndex = 0; wIndex < wNumberOfBlocks; wIndex++)
+            {
+                memmove(&(*pRxBuffer)[wIndex * pT5T->bBlockSize],
+                    &(*pRxBuffer)[(wIndex * (pT5T->bBlockSize + 1)) + 1],
+                    pT5T->bBlockSize);  /* PRQA S 3200 */
+            }
+            *wLength = wNumberOfBlocks * pT5T->bBlockSize;
         }
     }
     else
@@ -143,6 +159,9 @@ phStatus_t phalTop_Sw_Int_T5T_Read(
         return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_AL_TOP);
     }
 
+    /* Block size is known from CC read on; CC block is at address 0 */
+    phalTop_Sw_CacheUpdate(pT5T->pCache, (wBlockNum * (*wLength / wNumberOfBlocks)), *pRxBuffer, *wLength);
+
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
 }
 
@@ -154,6 +173,14 @@ phStatus_t phalTop_Sw_Int_T5T_Write(
                                     )
 {
     phStatus_t PH_MEMLOC_REM status;
+    uint8_t    PH_MEMLOC_REM * pCached;
+
+    /* Skip write if tag already holds the data */
+    if((phalTop_Sw_CacheRead(pT5T->pCache, (wBlockNum * wLength), wLength, &pCached) == PH_ON) &&
+        (memcmp(pCached, pRxBuffer, wLength) == 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+    }
 
     if(wBlockNum <= PHAL_TOP_T5T_DEFAULT_BLOCK_NUMBER)
     {
@@ -174,6 +201,195 @@ phStatus_t phalTop_Sw_Int_T5T_Write(
             wLength));
     }
 
+    phalTop_Sw_CacheUpdate(pT5T->pCache, (wBlockNum * wLength), pRxBuffer, wLength);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+phStatus_t phalTop_Sw_Int_T5T_ReadBlocks(
+                                         phalTop_T5T_t * pT5T,
+                                         uint16_t wBlockNum,
+                                         uint16_t wNumberOfBlocks,
+                                         uint8_t * pData
+                                         )
+{
+    phStatus_t PH_MEMLOC_REM status;
+    uint8_t    PH_MEMLOC_REM * pRxBuffer;
+    uint16_t   PH_MEMLOC_REM wRxLength;
+    uint16_t   PH_MEMLOC_REM wCount;
+
+    while(wNumberOfBlocks > 0)
+    {
+        /* Group blocks in one Read Multiple Blocks command if supported */
+        wCount = 1;
+        if(pT5T->bMbRead == 1)
+        {
+            wCount = (PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE / pT5T->bBlockSize);
+            if(wCount > wNumberOfBlocks)
+            {
+                wCount = wNumberOfBlocks;
+            }
+        }
+
+        PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Read(
+            pT5T,
+            wBlockNum,
+            wCount,
+            &pRxBuffer,
+            &wRxLength));
+
+        if(wRxLength != (wCount * pT5T->bBlockSize))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_TOP);
+        }
+
+        memcpy(pData, pRxBuffer, wRxLength);    /* PRQA S 3200 */
+
+        pData += wRxLength;
+        wBlockNum += wCount;
+        wNumberOfBlocks -= wCount;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+phStatus_t phalTop_Sw_Int_T5T_WriteBlocks(
+                                          phalTop_T5T_t * pT5T,
+                                          uint16_t wBlockNum,
+                                          uint16_t wNumberOfBlocks,
+                                          uint8_t * pData
+                                          )
+{
+    phStatus_t PH_MEMLOC_REM status;
+    uint16_t   PH_MEMLOC_REM wCount;
+    uint16_t   PH_MEMLOC_COUNT wIndex;
+
+    while(wNumberOfBlocks > 0)
+    {
+        wCount = 1;
+
+        if((pT5T->bMbWrite == PH_ON) && (wNumberOfBlocks > 1))
+        {
+            wCount = (wNumberOfBlocks > PHAL_TOP_T5T_MB_WRITE_MAX_BLOCKS)? PHAL_TOP_T5T_MB_WRITE_MAX_BLOCKS : wNumberOfBlocks;
+
+            if((wBlockNum + wCount) <= (PHAL_TOP_T5T_DEFAULT_BLOCK_NUMBER + 1))
+            {
+                status = phalI15693_WriteMultipleBlocks(
+                    pT5T->pAlI15693DataParams,
+                    PHPAL_SLI15693_ACTIVATE_DEFAULT,
+                    (uint8_t)(wBlockNum),
+                    wCount,
+                    pData,
+                    (wCount * pT5T->bBlockSize));
+            }
+            else
+            {
+                status = phalI15693_ExtendedWriteMultipleBlocks(
+                    pT5T->pAlI15693DataParams,
+                    PHPAL_SLI15693_ACTIVATE_DEFAULT,
+                    wBlockNum,
+                    wCount,
+                    pData,
+                    (wCount * pT5T->bBlockSize));
+            }
+
+            /* Command is optional; fall back to single block writes for rest of session */
+            if((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+            {
+                pT5T->bMbWrite = PH_OFF;
+
+                for(wIndex = 0; wIndex < wCount; wIndex++)
+                {
+                    PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Write(
+                        pT5T,
+                        (wBlockNum + wIndex),
+                        &pData[wIndex * pT5T->bBlockSize],
+                        pT5T->bBlockSize));
+                }
+            }
+            else
+            {
+                phalTop_Sw_CacheUpdate(pT5T->pCache, (wBlockNum * pT5T->bBlockSize), pData, (wCount * pT5T->bBlockSize));
+            }
+        }
+        else
+        {
+            PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Write(
+                pT5T,
+                wBlockNum,
+                pData,
+                pT5T->bBlockSize));
+        }
+
+        pData += (wCount * pT5T->bBlockSize);
+        wBlockNum += wCount;
+        wNumberOfBlocks -= wCount;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+phStatus_t phalTop_Sw_Int_T5T_UpdateBlocks(
+                                           phalTop_T5T_t * pT5T,
+                                           uint16_t wBlockNum,
+                                           uint16_t wNumberOfBlocks,
+                                           uint8_t * pCurrent,
+                                           uint8_t * pData
+                                           )
+{
+    phStatus_t PH_MEMLOC_REM status;
+    uint16_t   PH_MEMLOC_REM wFirst = 0;
+    uint16_t   PH_MEMLOC_REM wLast = 0;
+    uint16_t   PH_MEMLOC_COUNT wIndex;
+    uint16_t   PH_MEMLOC_COUNT wStart;
+
+    /* Write each run of blocks differing from current tag content */
+    for(wIndex = 0; wIndex < wNumberOfBlocks; )
+    {
+        if(memcmp(&pCurrent[wIndex * pT5T->bBlockSize], &pData[wIndex * pT5T->bBlockSize], pT5T->bBlockSize) == 0)
+        {
+            wIndex++;
+            continue;
+        }
+
+        for(wStart = wIndex; (wIndex < wNumberOfBlocks) &&
+            (memcmp(&pCurrent[wIndex * pT5T->bBlockSize], &pData[wIndex * pT5T->bBlockSize], pT5T->bBlockSize) != 0);
+            wIndex++)
+        {
+        }
+
+        PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_WriteBlocks(
+            pT5T,
+            (wBlockNum + wStart),
+            (wIndex - wStart),
+            &pData[wStart * pT5T->bBlockSize]));
+
+        if(wLast == 0)
+        {
+            wFirst = wStart;
+        }
+        wLast = wIndex;
+    }
+
+    /* Read back written range in grouped reads and compare */
+    if((pT5T->bWriteVerify == PH_ON) && (wLast != 0))
+    {
+        /* Bypass tag image cache */
+        phalTop_Sw_CacheInvalidate(pT5T->pCache, ((wBlockNum + wFirst) * pT5T->bBlockSize), ((wLast - wFirst) * pT5T->bBlockSize));
+
+        PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_ReadBlocks(
+            pT5T,
+            (wBlockNum + wFirst),
+            (wLast - wFirst),
+            &pCurrent[wFirst * pT5T->bBlockSize]));
+
+        if(memcmp(&pCurrent[wFirst * pT5T->bBlockSize], &pData[wFirst * pT5T->bBlockSize],
+            ((wLast - wFirst) * pT5T->bBlockSize)) != 0)
+        {
+            return PH_ADD_COMPCODE(PHAL_TOP_ERR_VERIFY, PH_COMP_AL_TOP);
+        }
+    }
+
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
 }
 
@@ -528,6 +744,7 @@ phStatus_t phalTop_Sw_Int_T5T_EraseNdef(
                                         )
 {
     phStatus_t    PH_MEMLOC_REM status;
+    uint8_t       PH_MEMLOC_BUF aData[PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE];
     uint8_t       PH_MEMLOC_REM * pRxBuffer;
     uint16_t      PH_MEMLOC_REM wRxLength;
     phalTop_T5T_t PH_MEMLOC_REM * pT5T = pDataParams->pT5T;
@@ -558,14 +775,15 @@ phStatus_t phalTop_Sw_Int_T5T_EraseNdef(
         &pRxBuffer,
         &wRxLength));
 
-    /* Set NDEF length as '0' */
-    pRxBuffer[(pT5T->wNdefHeaderAddr + 1) % pT5T->bBlockSize] = 0x00;
+    /* Set NDEF length as '0'; copy as read data may be in tag image cache */
+    memcpy(aData, pRxBuffer, pT5T->bBlockSize);  /* PRQA S 3200 */
+    aData[(pT5T->wNdefHeaderAddr + 1) % pT5T->bBlockSize] = 0x00;
 
     /* Write NDEF length as '0' */
     PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Write(
         pT5T,
         ((pT5T->wNdefHeaderAddr + 1) / pT5T->bBlockSize),
-        pRxBuffer,
+        aData,
         pT5T->bBlockSize));
 
     /* Update tag state */
@@ -928,13 +1146,18 @@ phStatus_t phalTop_Sw_Int_T5T_WriteNdef(
                                         )
 {
     phStatus_t    PH_MEMLOC_REM   status;
-    uint8_t       PH_MEMLOC_REM   * pRxBuffer;
-    uint8_t       PH_MEMLOC_BUF   aTemp[PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE] = {0};
+    uint8_t       PH_MEMLOC_BUF   aCurrent[PHAL_TOP_T5T_WRITE_WINDOW_SIZE];
+    uint8_t       PH_MEMLOC_BUF   aNew[PHAL_TOP_T5T_WRITE_WINDOW_SIZE];
+    uint8_t       PH_MEMLOC_BUF   aLenBlock[PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE];
+    uint8_t       PH_MEMLOC_REM   bTerminator;
     uint16_t      PH_MEMLOC_REM   wBlockNum;
-    uint16_t      PH_MEMLOC_REM   wByteNum;
+    uint16_t      PH_MEMLOC_REM   wEndBlock;
+    uint16_t      PH_MEMLOC_REM   wLenBlock;
+    uint16_t      PH_MEMLOC_REM   wNumBlocks;
+    uint16_t      PH_MEMLOC_REM   wMsgAddr;
+    uint16_t      PH_MEMLOC_REM   wEndAddr;
+    uint16_t      PH_MEMLOC_REM   wAddr;
     uint16_t      PH_MEMLOC_COUNT wIndex;
-    uint16_t      PH_MEMLOC_REM   wRxLength = 0;
-    uint16_t      PH_MEMLOC_REM   wTempLength = 0;
     phalTop_T5T_t PH_MEMLOC_REM * pT5T = pDataParams->pT5T;
 
     /* Check if tag is in valid state */
@@ -955,207 +1178,115 @@ phStatus_t phalTop_Sw_Int_T5T_WriteNdef(
         return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_TOP);
     }
 
-    /* Reading first 32 (PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE ) Byte chunk starting
-     * from NDEF TLV */
-    if(pT5T->bMbRead == 0)
-    {
-        for(wIndex = 0;
-            wIndex < (PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE / pT5T->bBlockSize);
-            wIndex++)
-        {
-            PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Read(
-                pT5T,
-                ((pT5T->wNdefHeaderAddr / pT5T->bBlockSize) + wIndex),
-                1,
-                &pRxBuffer,
-                &wRxLength));
-            memcpy(&aTemp[wIndex * wRxLength], pRxBuffer, wRxLength);   /* PRQA S 3200 */
-        }
-    }
-    else
+    /* Message follows 1 or 3 byte TLV length field */
+    wMsgAddr = pT5T->wNdefHeaderAddr + 1 + ((wLength > 0xFE)? 3 : 1);
+    wEndAddr = wMsgAddr + wLength;
+
+    if(wEndAddr > ((pT5T->bMaxBlockNum + 1) * pT5T->bBlockSize))
     {
-        PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Read(
-            pT5T,
-            (pT5T->wNdefHeaderAddr / pT5T->bBlockSize),
-            (PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE / pT5T->bBlockSize),
-            &pRxBuffer,
-            &wRxLength));
-        memcpy(aTemp, pRxBuffer, wRxLength);    /* PRQA S 3200 */
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_TOP);
     }
 
-    /* Updating the Length in NDEF TLV to 1 byte long and value zero */
-    aTemp[(pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 1] = 0x00;
+    /* Append Terminator TLV if there is space left */
+    bTerminator = (wEndAddr < ((pT5T->bMaxBlockNum + 1) * pT5T->bBlockSize))? 1 : 0;
 
-    /* Appending message bytes after the length field of Ndef TLV */
-    /* TLV length is of 3 byte */
-    if(wLength > 0xFE)
-    {
-        wIndex = ((pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 4);
-        memcpy(&aTemp[wIndex],&pData[wIndex - ((pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 4)],(PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE - ((pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 4)));   /* PRQA S 3200 */
-        wByteNum = (PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE - ((pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 4));
-    }
-    /* TLV length is of 1 bytes */
-    else
-    {
-        wIndex = ((pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 2);
-        if(wLength < (PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE - ((pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 2)))
-        {
-            memcpy(&aTemp[wIndex], &pData[wIndex - ((pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 2)], wLength);  /* PRQA S 3200 */
-            wByteNum = wLength;
-        }
-        else
-        {
-            memcpy(&aTemp[wIndex], &pData[wIndex - ((pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 2)],(PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE - ((pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 2))); /* PRQA S 3200 */
-            wByteNum = (PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE - ((pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 2));
-        }
-    }
+    wLenBlock = (pT5T->wNdefHeaderAddr + 1) / pT5T->bBlockSize;
+    wEndBlock = (wEndAddr + bTerminator - 1) / pT5T->bBlockSize;
 
     /* Update the ndef length to zero */
     pDataParams->wNdefLength = 0;
 
-    /* Write the first 32 bytes to the ndef tlv */
-    for(wIndex = 0;
-        wIndex < (PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE / pT5T->bBlockSize);
-        wIndex++)
-    {
-        PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Write(
-            pT5T,
-            ((pT5T->wNdefHeaderAddr / pT5T->bBlockSize) + wIndex),
-            &aTemp[wIndex * pT5T->bBlockSize],
-            pT5T->bBlockSize));
-    }
-
-    /* Update the block number */
-    wBlockNum = (PHAL_TOP_T5T_MAXIMUM_BLOCK_SIZE / pT5T->bBlockSize) + 1;
-
-    /* Keep writing while all the data is written in the NDEF TLV  */
-    while((wLength - wByteNum) > pT5T->bBlockSize)
+    /* Write NDEF TLV with length zero, message and Terminator TLV window by
+     * window; only blocks differing from tag content are written */
+    for(wBlockNum = (pT5T->wNdefHeaderAddr / pT5T->bBlockSize);
+        wBlockNum <= wEndBlock;
+        wBlockNum += wNumBlocks)
     {
-        memcpy(aTemp, &pData[wByteNum], pT5T->bBlockSize);  /* PRQA S 3200 */
-        PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Write(
-            pT5T,
-            wBlockNum,
-            aTemp,
-            pT5T->bBlockSize));
-        wBlockNum += 1;
-        wByteNum += pT5T->bBlockSize;
-    }
-
-    /* check if there are any bytes, which would be less than the block size, are left to be written */
-    if(wLength > wByteNum)
-    {   wTempLength = wLength - wByteNum;
-        memcpy(aTemp, &pData[wByteNum], wTempLength);  /* PRQA S 3200 */
-
-        if(((wTempLength) < pT5T->bBlockSize) && (wBlockNum < pT5T->bMaxBlockNum))
+        wNumBlocks = PHAL_TOP_T5T_WRITE_WINDOW_SIZE / pT5T->bBlockSize;
+        if(wNumBlocks > ((wEndBlock - wBlockNum) + 1))
         {
-            aTemp[wTempLength] = 0xFE; /* Appending Terminator TVL */
-            for(wIndex = ((wTempLength) + 1);
-                wIndex < pT5T->bBlockSize;
-                wIndex++)
-            {
-                aTemp[wIndex] = 0x00;
-            }
-            pT5T->bTerminatorTlvPresence = 1; /* Updating Terminator TVL dataparam */
+            wNumBlocks = (wEndBlock - wBlockNum) + 1;
         }
 
-        PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Write(
+        PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_ReadBlocks(
             pT5T,
             wBlockNum,
-            aTemp,
-            pT5T->bBlockSize));
-
-        wBlockNum += 1;
-        wByteNum = wLength;
+            wNumBlocks,
+            aCurrent));
 
-        if((pT5T->bTerminatorTlvPresence != 1) && (wBlockNum < pT5T->bMaxBlockNum))
+        for(wIndex = 0; wIndex < (wNumBlocks * pT5T->bBlockSize); wIndex++)
         {
-            aTemp[0] = 0xFE; /* Appending Terminator TVL */
+            wAddr = (wBlockNum * pT5T->bBlockSize) + wIndex;
 
-            for(wIndex = 1; wIndex < pT5T->bBlockSize; wIndex++)
+            if(wAddr < pT5T->wNdefHeaderAddr)
             {
-                aTemp[wIndex] = 0x00;
+                /* Preserve data before NDEF TLV */
+                aNew[wIndex] = aCurrent[wIndex];
             }
-
-            PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Write(
-                pT5T,
-                wBlockNum,
-                aTemp,
-                pT5T->bBlockSize));
-            pT5T->bTerminatorTlvPresence = 1; /* Updating Terminator TVL dataparam */
-        }
-    }
-    /* No bytes are left to be written in the ndef tlv, directly append the Terminator tlv */
-    else
-    {
-        if((pT5T->bTerminatorTlvPresence != 1) && (wBlockNum < pT5T->bMaxBlockNum))
-        {
-            aTemp[0] = 0xFE; /* Appending Terminator TVL */
-
-            for(wIndex = 1; wIndex < pT5T->bBlockSize; wIndex++)
+            else if(wAddr == pT5T->wNdefHeaderAddr)
             {
-                aTemp[wIndex] = 0x00;
+                aNew[wIndex] = PHAL_TOP_T5T_NDEF_TLV;
             }
-
-            PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Write(
-                pT5T,
-                wBlockNum,
-                aTemp,
-                pT5T->bBlockSize));
-
-            pT5T->bTerminatorTlvPresence = 1; /* Updating Terminator TVL data parameter */
-        }
-    }
-
-    /* Updating the length Field after completing the write process */
-    if(wByteNum == wLength)
-    {
-        if(pT5T->bMbRead == 0)
-        {
-            for(wIndex = 0; wIndex < 2; wIndex++)
+            else if(wAddr == (pT5T->wNdefHeaderAddr + 1))
             {
-                PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Read(
-                    pT5T,
-                    ((pT5T->wNdefHeaderAddr / pT5T->bBlockSize) + wIndex),
-                    1,
-                    &pRxBuffer,
-                    &wRxLength));
-                memcpy(&aTemp[wIndex * wRxLength], pRxBuffer, wRxLength);   /* PRQA S 3200 */
+                aNew[wIndex] = 0x00;
+            }
+            else if((wLength > 0xFE) && (wAddr == (pT5T->wNdefHeaderAddr + 2)))
+            {
+                /* 3 byte length; final value already, ignored while length is zero */
+                aNew[wIndex] = (uint8_t)(wLength >> 8);
+            }
+            else if(wAddr < wMsgAddr)
+            {
+                aNew[wIndex] = (uint8_t)(wLength);
+            }
+            else if(wAddr < wEndAddr)
+            {
+                aNew[wIndex] = pData[wAddr - wMsgAddr];
+            }
+            else if((wAddr == wEndAddr) && (bTerminator == 1))
+            {
+                aNew[wIndex] = PHAL_TOP_T5T_TERMINATOR_TLV;
+            }
+            else
+            {
+                aNew[wIndex] = 0x00;
             }
-        }
-        else
-        {
-            PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Read(
-                pT5T,
-                (pT5T->wNdefHeaderAddr / pT5T->bBlockSize),
-                2,
-                &pRxBuffer,
-                &wRxLength));
-            memcpy(aTemp, pRxBuffer, wRxLength);    /* PRQA S 3200 */
         }
 
-        if(wLength < 0xFF)
-        {
-            aTemp[(pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 1] = (uint8_t)wLength;
-        }
-        else
+        /* Keep block holding length field for final update */
+        if((wLenBlock >= wBlockNum) && (wLenBlock < (wBlockNum + wNumBlocks)))
         {
-            aTemp[(pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 1] = 0xFF;
-            aTemp[(pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 2] = (uint8_t)(wLength >> 8);
-            aTemp[(pT5T->wNdefHeaderAddr % pT5T->bBlockSize) + 3] = (uint8_t)(wLength);
+            memcpy(aLenBlock, &aNew[(wLenBlock - wBlockNum) * pT5T->bBlockSize], pT5T->bBlockSize);  /* PRQA S 3200 */
         }
 
-        for(wIndex = 0; wIndex < 2; wIndex++)
-        {
-            PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_Write(
-                pT5T,
-                ((pT5T->wNdefHeaderAddr / pT5T->bBlockSize) + wIndex),
-                &aTemp[wIndex * pT5T->bBlockSize],
-                pT5T->bBlockSize));
-        }
+        PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_UpdateBlocks(
+            pT5T,
+            wBlockNum,
+            wNumBlocks,
+            aCurrent,
+            aNew));
+    }
 
-        pDataParams->wNdefLength = wLength;
+    if(bTerminator == 1)
+    {
+        pT5T->bTerminatorTlvPresence = 1;
     }
 
+    /* Updating the length Field after completing the write process */
+    memcpy(aCurrent, aLenBlock, pT5T->bBlockSize);  /* PRQA S 3200 */
+    aLenBlock[(pT5T->wNdefHeaderAddr + 1) % pT5T->bBlockSize] = (wLength > 0xFE)? 0xFF : (uint8_t)wLength;
+
+    PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Int_T5T_UpdateBlocks(
+        pT5T,
+        wLenBlock,
+        1,
+        aCurrent,
+        aLenBlock));
+
+    pDataParams->wNdefLength = wLength;
+    pT5T->wNdefMsgAddr = wMsgAddr;
+
     /* Update tag state */
     pDataParams->bTagState = PHAL_TOP_STATE_READWRITE;
 
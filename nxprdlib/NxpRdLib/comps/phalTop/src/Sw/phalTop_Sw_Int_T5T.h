@@ -46,6 +46,9 @@
 #define PHAL_TOP_T5T_CC_RWA_RW                   0x00U        /**< Read/Write access */
 #define PHAL_TOP_T5T_CC_RWA_RO                   0x03U        /**< Read Only access */
 
+#define PHAL_TOP_T5T_WRITE_WINDOW_SIZE           0x40U        /**< Bytes compared/written per window in WriteNdef */
+#define PHAL_TOP_T5T_MB_WRITE_MAX_BLOCKS         0x04U        /**< Max blocks per Write Multiple Blocks command */
+
 phStatus_t phalTop_Sw_Int_T5T_SetReadOnly(
                                           phalTop_Sw_DataParams_t * pDataParams
                                           );
@@ -70,6 +73,28 @@ phStatus_t phalTop_Sw_Int_T5T_Write(
                                     uint16_t wLength
                                     );
 
+phStatus_t phalTop_Sw_Int_T5T_ReadBlocks(
+                                         phalTop_T5T_t * pT5T,
+                                         uint16_t wBlockNum,
+                                         uint16_t wNumberOfBlocks,
+                                         uint8_t * pData
+                                         );
+
+phStatus_t phalTop_Sw_Int_T5T_WriteBlocks(
+                                          phalTop_T5T_t * pT5T,
+                                          uint16_t wBlockNum,
+                                          uint16_t wNumberOfBlocks,
+                                          uint8_t * pData
+                                          );
+
+phStatus_t phalTop_Sw_Int_T5T_UpdateBlocks(
+                                           phalTop_T5T_t * pT5T,
+                                           uint16_t wBlockNum,
+                                           uint16_t wNumberOfBlocks,
+                                           uint8_t * pCurrent,
+                                           uint8_t * pData
+                                           );
+
 phStatus_t phalTop_Sw_Int_T5T_ClearState(
                                          phalTop_Sw_DataParams_t * pDataParams,
                                          phalTop_T5T_t * pT5T
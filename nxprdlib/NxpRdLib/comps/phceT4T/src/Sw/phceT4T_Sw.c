@@ -53,11 +53,19 @@ phStatus_t phceT4T_Sw_Init(
 
 #ifdef NXPBUILD__PHCE_T4T_PROPRIETARY
     pDataParams->bProprietaryFileCount    = 0;
+    pDataParams->bStaticResponseCount     = 0;
 #endif /* NXPBUILD__PHCE_T4T_PROPRIETARY */
 
     pDataParams->bHandleUpdateCmd         = PH_OFF;
     pDataParams->bSupportProprietaryCmd   = PH_OFF;
 
+    /* No flush callback, nothing updated yet */
+    pDataParams->pFlushCallback           = NULL;
+    pDataParams->pFlushContext            = NULL;
+    pDataParams->pDirtyFile               = NULL;
+    pDataParams->bDirtyRanges             = 0;
+    pDataParams->wDirtyFileId             = 0;
+
     /* Reset tag state */
     pDataParams->bTagState                = PHCE_T4T_STATE_NONE;
 
@@ -69,6 +77,9 @@ phStatus_t phceT4T_Sw_Reset(
                             phceT4T_Sw_DataParams_t *pDataParams
                             )
 {
+    /* Report files updated in the last session */
+    phceT4T_Sw_Int_FlushDirty(pDataParams);
+
     /* If reset is called before NDEF file is set, do not reset tag state. */
     if(pDataParams->bTagState > PHCE_T4T_STATE_NDEF_FILE_CREATED)
     {
@@ -156,6 +167,65 @@ phStatus_t phceT4T_Sw_SetElementaryFile(
     return PH_ERR_SUCCESS;
 }
 
+phStatus_t phceT4T_Sw_SetStaticResponse(
+                                        phceT4T_Sw_DataParams_t *pDataParams,
+                                        uint8_t *pCApdu,
+                                        uint16_t wCApduLen,
+                                        uint8_t *pRApdu,
+                                        uint16_t wRApduLen
+                                        )
+{
+#ifdef NXPBUILD__PHCE_T4T_PROPRIETARY
+    /* NULL C-APDU removes all static responses */
+    if(pCApdu == NULL)
+    {
+        pDataParams->bStaticResponseCount = 0;
+        return PH_ERR_SUCCESS;
+    }
+
+    /* At least CLA, INS, P1, P2 to match and SW1, SW2 to send */
+    if((wCApduLen < 4) || (pRApdu == NULL) || (wRApduLen < 2))
+    {
+        return (PH_ERR_INVALID_PARAMETER | PH_COMP_CE_T4T);
+    }
+
+    if(pDataParams->bStaticResponseCount == PHCE_T4T_MAX_STATIC_RESPONSE)
+    {
+        return (PH_ERR_BUFFER_OVERFLOW | PH_COMP_CE_T4T);
+    }
+
+    pDataParams->asStaticResponse[pDataParams->bStaticResponseCount].pCApdu = pCApdu;
+    pDataParams->asStaticResponse[pDataParams->bStaticResponseCount].wCApduLen = wCApduLen;
+    pDataParams->asStaticResponse[pDataParams->bStaticResponseCount].pRApdu = pRApdu;
+    pDataParams->asStaticResponse[pDataParams->bStaticResponseCount].wRApduLen = wRApduLen;
+    pDataParams->bStaticResponseCount++;
+
+    return PH_ERR_SUCCESS;
+#else
+    PH_UNUSED_VARIABLE(pDataParams);
+    PH_UNUSED_VARIABLE(pCApdu);
+    PH_UNUSED_VARIABLE(wCApduLen);
+    PH_UNUSED_VARIABLE(pRApdu);
+    PH_UNUSED_VARIABLE(wRApduLen);
+    return (PH_ERR_UNSUPPORTED_COMMAND | PH_COMP_CE_T4T);
+#endif /* NXPBUILD__PHCE_T4T_PROPRIETARY */
+}
+
+phStatus_t phceT4T_Sw_SetFlushCallback(
+                                       phceT4T_Sw_DataParams_t *pDataParams,
+                                       phceT4T_FlushCallback_t pFlushCallback,
+                                       void *pContext
+                                       )
+{
+    /* Report pending range to the previous callback */
+    phceT4T_Sw_Int_FlushDirty(pDataParams);
+
+    pDataParams->pFlushCallback = pFlushCallback;
+    pDataParams->pFlushContext  = pContext;
+
+    return PH_ERR_SUCCESS;
+}
+
 phStatus_t phceT4T_Sw_ProcessCmd(
                                  phceT4T_Sw_DataParams_t *pDataParams,
                                  uint16_t wOption,
@@ -213,6 +283,24 @@ phStatus_t phceT4T_Sw_ProcessCmd(
             return (PH_CE_T4T_FAILURE | PH_COMP_CE_T4T);
         }
 
+#ifdef NXPBUILD__PHCE_T4T_PROPRIETARY
+        /* Answer from response cache, if a static response is registered */
+        if((wOption == PHCE_T4T_RXDEFAULT) && (pDataParams->bStaticResponseCount))
+        {
+            status = phceT4T_Sw_Int_StaticResponse(
+                pDataParams,
+                pRxData,
+                wRxDataLen,
+                pStatusWord,
+                ppTxData,
+                pTxDataLen);
+            if((status & PH_ERR_MASK) == PH_CE_T4T_STATIC_RESPONSE)
+            {
+                return status;
+            }
+        }
+#endif /* NXPBUILD__PHCE_T4T_PROPRIETARY */
+
         /* Check for Instruction Byte */
         switch(pRxData[1])
         {
@@ -467,7 +555,8 @@ phStatus_t phceT4T_Sw_AppProcessCmd(
                 /* Update file with RX Data */
                 if(pDataParams->bTagState == PHCE_T4T_STATE_FILE_UPDATE)
                 {
-                    phceT4T_Sw_Int_UpdateFile(
+                    /* Range is recorded by the reader library thread */
+                    phceT4T_Sw_Int_WriteFile(
                         pDataParams,
                         &pDataParams->pSharedData[bDataOffset],
                         (pDataParams->wSharedDataLen - bDataOffset));
@@ -37,6 +37,20 @@ phStatus_t phceT4T_Sw_SetElementaryFile(
                                         uint32_t dwContentLen
                                         );
 
+phStatus_t phceT4T_Sw_SetStaticResponse(
+                                        phceT4T_Sw_DataParams_t * pDataParams,
+                                        uint8_t *pCApdu,
+                                        uint16_t wCApduLen,
+                                        uint8_t *pRApdu,
+                                        uint16_t wRApduLen
+                                        );
+
+phStatus_t phceT4T_Sw_SetFlushCallback(
+                                       phceT4T_Sw_DataParams_t * pDataParams,
+                                       phceT4T_FlushCallback_t pFlushCallback,
+                                       void *pContext
+                                       );
+
 phStatus_t phceT4T_Sw_ProcessCmd(
                                  phceT4T_Sw_DataParams_t *pDataParams,
                                  uint16_t wOption,
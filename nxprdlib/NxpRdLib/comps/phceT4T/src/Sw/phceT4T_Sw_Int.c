@@ -280,8 +280,9 @@ phStatus_t phceT4T_Sw_Int_SetNdefFile(
                                       uint32_t dwNdefContentLen
                                       )
 {
-    /* Check current state */
-    if(pDataParams->bTagState != PHCE_T4T_STATE_CC_FILE_CREATED)
+    /* Check current state. NDEF file can be replaced while not activated. */
+    if((pDataParams->bTagState != PHCE_T4T_STATE_CC_FILE_CREATED)
+       && (pDataParams->bTagState != PHCE_T4T_STATE_NDEF_FILE_CREATED))
     {
         return (PH_ERR_USE_CONDITION | PH_COMP_CE_T4T);
     }
@@ -375,6 +376,9 @@ phStatus_t phceT4T_Sw_Int_SetNdefFile(
     }
 #endif /* NXPBUILD__PHCE_T4T_EXT_NDEF */
 
+    /* Report updates of the file being replaced */
+    phceT4T_Sw_Int_FlushDirty(pDataParams);
+
     /* Update file ID in CC */
     pDataParams->pCcFile[9]  = (uint8_t)((wNdefFileId & 0xFF00) >> 8);
     pDataParams->pCcFile[10] = (uint8_t)(wNdefFileId & 0xFF);
@@ -514,6 +518,43 @@ phStatus_t phceT4T_Sw_Int_SetProprietaryFile(
 
     return PH_ERR_SUCCESS;
 }
+
+phStatus_t phceT4T_Sw_Int_StaticResponse(
+                                         phceT4T_Sw_DataParams_t *pDataParams,
+                                         uint8_t *pRxData,
+                                         uint16_t wRxDataLen,
+                                         uint16_t *pStatusWord,
+                                         uint8_t **ppTxData,
+                                         uint16_t *pTxDataLen
+                                         )
+{
+    uint8_t PH_MEMLOC_REM bCount;
+    uint8_t PH_MEMLOC_BUF *pRApdu;
+    uint16_t PH_MEMLOC_REM wRApduLen;
+
+    for(bCount = 0; bCount < pDataParams->bStaticResponseCount; bCount++)
+    {
+        /* Received C-APDU shall start with the registered C-APDU */
+        if((wRxDataLen >= pDataParams->asStaticResponse[bCount].wCApduLen)
+           && (memcmp(pRxData, pDataParams->asStaticResponse[bCount].pCApdu,
+           pDataParams->asStaticResponse[bCount].wCApduLen) == 0))
+        {
+            pRApdu = pDataParams->asStaticResponse[bCount].pRApdu;
+            wRApduLen = pDataParams->asStaticResponse[bCount].wRApduLen;
+
+            /* Last 2 bytes of R-APDU are the status word */
+            pDataParams->wStatusWord = (uint16_t)(((uint16_t)pRApdu[wRApduLen - 2] << 8)
+                | pRApdu[wRApduLen - 1]);
+            *pStatusWord = pDataParams->wStatusWord;
+            *ppTxData = (wRApduLen > 2)? pRApdu : NULL;
+            *pTxDataLen = wRApduLen - 2;
+
+            return (PH_CE_T4T_STATIC_RESPONSE | PH_COMP_CE_T4T);
+        }
+    }
+
+    return PH_ERR_SUCCESS;
+}
 #endif /* NXPBUILD__PHCE_T4T_PROPRIETARY */
 
 phStatus_t phceT4T_Sw_Int_Select(
@@ -950,6 +991,7 @@ phStatus_t phceT4T_Sw_Int_Activate(
     uint16_t           PH_MEMLOC_REM wFsd;
     uint16_t           PH_MEMLOC_REM wCidPresence;
     uint16_t           PH_MEMLOC_REM wNadPresence;
+    uint32_t           PH_MEMLOC_REM dwUpdateOffset;
     uint8_t            PH_MEMLOC_REM bTxType = PHCE_SEND_NO_DATA;
     uint8_t            PH_MEMLOC_REM bExitLoop = false;
     uint8_t            PH_MEMLOC_REM bWaitForData;
@@ -1085,6 +1127,9 @@ phStatus_t phceT4T_Sw_Int_Activate(
                     pDataParams->wSharedDataLen = wRxDataLen;
                 }
 
+                /* File offset before AppProcessCmd writes the update */
+                dwUpdateOffset = pDataParams->dwFileOffset;
+
                 /* Set RX Data available event */
                 PH_CHECK_SUCCESS_FCT(status, phOsal_Event_Post(
                     E_PH_OSAL_EVT_RXDATA_AVAILABLE,
@@ -1123,6 +1168,15 @@ phStatus_t phceT4T_Sw_Int_Activate(
                             E_PH_OSAL_EVT_TXDATA_AVAILABLE,
                             E_PH_OSAL_EVT_SRC_APP));
 
+                        /* Record range updated by AppProcessCmd, on this thread */
+                        if(pDataParams->bTagState == PHCE_T4T_STATE_FILE_UPDATE)
+                        {
+                            phceT4T_Sw_Int_MarkDirty(
+                                pDataParams,
+                                dwUpdateOffset,
+                                (pDataParams->dwFileOffset - dwUpdateOffset));
+                        }
+
                         /* Update TX Data */
                         pTxData = pDataParams->pSharedData;
                         wTxDataLen = pDataParams->wSharedDataLen;
@@ -1145,6 +1199,7 @@ phStatus_t phceT4T_Sw_Int_Activate(
             case PH_CE_T4T_SELECT:
             case PH_CE_T4T_FAILURE:
             case PH_CE_T4T_READ_BINARY:
+            case PH_CE_T4T_STATIC_RESPONSE:
                 /* For select and failure, only status word is send */
                 if(((status & PH_ERR_MASK) == PH_CE_T4T_FAILURE)
                    || ((status & PH_ERR_MASK) == PH_CE_T4T_SELECT))
@@ -1242,6 +1297,9 @@ phStatus_t phceT4T_Sw_Int_Activate(
         }
     }
 
+    /* Report files updated in this session */
+    phceT4T_Sw_Int_FlushDirty(pDataParams);
+
     return status;
 #endif /* _WIN32 */
 #ifdef _WIN32
@@ -1250,11 +1308,96 @@ phStatus_t phceT4T_Sw_Int_Activate(
 #endif /* _WIN32 */
 }
 
-void phceT4T_Sw_Int_UpdateFile(
-                               phceT4T_Sw_DataParams_t *pDataParams,
-                               uint8_t *pData,
-                               uint32_t dwDataLen
+void phceT4T_Sw_Int_FlushDirty(
+                               phceT4T_Sw_DataParams_t *pDataParams
                                )
+{
+    uint8_t PH_MEMLOC_COUNT bIndex;
+
+    if(pDataParams->pDirtyFile != NULL)
+    {
+        if(pDataParams->pFlushCallback != NULL)
+        {
+            for(bIndex = 0; bIndex < pDataParams->bDirtyRanges; bIndex++)
+            {
+                (void)pDataParams->pFlushCallback(
+                    pDataParams->pFlushContext,
+                    pDataParams->wDirtyFileId,
+                    pDataParams->pDirtyFile,
+                    pDataParams->aDirtyStart[bIndex],
+                    (pDataParams->aDirtyEnd[bIndex] - pDataParams->aDirtyStart[bIndex]));
+            }
+        }
+
+        pDataParams->pDirtyFile = NULL;
+        pDataParams->bDirtyRanges = 0;
+    }
+}
+
+void phceT4T_Sw_Int_MarkDirty(
+                              phceT4T_Sw_DataParams_t *pDataParams,
+                              uint32_t dwOffset,
+                              uint32_t dwLength
+                              )
+{
+    uint32_t PH_MEMLOC_REM dwEnd = dwOffset + dwLength;
+    uint8_t  PH_MEMLOC_COUNT bIndex = 0;
+
+    if((pDataParams->pFlushCallback == NULL) || (dwLength == 0))
+    {
+        return;
+    }
+
+    /* Ranges are tracked for one file at a time */
+    if(pDataParams->pDirtyFile != pDataParams->pSelectedFile)
+    {
+        phceT4T_Sw_Int_FlushDirty(pDataParams);
+    }
+
+    /* Merge overlapping and adjacent ranges into the new one */
+    while(bIndex < pDataParams->bDirtyRanges)
+    {
+        if((dwOffset <= pDataParams->aDirtyEnd[bIndex])
+           && (dwEnd >= pDataParams->aDirtyStart[bIndex]))
+        {
+            if(pDataParams->aDirtyStart[bIndex] < dwOffset)
+            {
+                dwOffset = pDataParams->aDirtyStart[bIndex];
+            }
+            if(pDataParams->aDirtyEnd[bIndex] > dwEnd)
+            {
+                dwEnd = pDataParams->aDirtyEnd[bIndex];
+            }
+
+            /* Remove merged range */
+            pDataParams->bDirtyRanges--;
+            pDataParams->aDirtyStart[bIndex] = pDataParams->aDirtyStart[pDataParams->bDirtyRanges];
+            pDataParams->aDirtyEnd[bIndex]   = pDataParams->aDirtyEnd[pDataParams->bDirtyRanges];
+        }
+        else
+        {
+            bIndex++;
+        }
+    }
+
+    /* No room for another separate range, report the pending ones */
+    if(pDataParams->bDirtyRanges == PHCE_T4T_MAX_DIRTY_RANGES)
+    {
+        phceT4T_Sw_Int_FlushDirty(pDataParams);
+    }
+
+    pDataParams->pDirtyFile   = pDataParams->pSelectedFile;
+    pDataParams->wDirtyFileId = pDataParams->wSelectedFileId;
+    pDataParams->aDirtyStart[pDataParams->bDirtyRanges] = dwOffset;
+    pDataParams->aDirtyEnd[pDataParams->bDirtyRanges]   = dwEnd;
+    pDataParams->bDirtyRanges++;
+}
+
+void phceT4T_Sw_Int_WriteFile(
+                              phceT4T_Sw_DataParams_t *pDataParams,
+                              uint8_t *pData,
+                              uint32_t dwDataLen
+                              )
 {
     /* Update File */
     memcpy(                                                    /* PRQA S 3200 */
@@ -1266,4 +1409,16 @@ void phceT4T_Sw_Int_UpdateFile(
     pDataParams->dwFileOffset += dwDataLen;
 }
 
+void phceT4T_Sw_Int_UpdateFile(
+                               phceT4T_Sw_DataParams_t *pDataParams,
+                               uint8_t *pData,
+                               uint32_t dwDataLen
+                               )
+{
+    /* Track updated range */
+    phceT4T_Sw_Int_MarkDirty(pDataParams, pDataParams->dwFileOffset, dwDataLen);
+
+    phceT4T_Sw_Int_WriteFile(pDataParams, pData, dwDataLen);
+}
+
 #endif /* NXPBUILD__PHCE_T4T_SW */
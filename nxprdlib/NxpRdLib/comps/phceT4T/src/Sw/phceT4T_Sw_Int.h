@@ -107,12 +107,37 @@ phStatus_t phceT4T_Sw_Int_SetProprietaryFile(
                                              uint16_t wFileSize,
                                              uint16_t wContentLen
                                              );
+
+phStatus_t phceT4T_Sw_Int_StaticResponse(
+                                         phceT4T_Sw_DataParams_t *pDataParams,
+                                         uint8_t *pRxData,
+                                         uint16_t wRxDataLen,
+                                         uint16_t *pStatusWord,
+                                         uint8_t **ppTxData,
+                                         uint16_t *pTxDataLen
+                                         );
 #endif /* NXPBUILD__PHCE_T4T_PROPRIETARY */
 
 phStatus_t phceT4T_Sw_Int_Activate(
                                    phceT4T_Sw_DataParams_t *pDataParams
                                    );
 
+void phceT4T_Sw_Int_FlushDirty(
+                               phceT4T_Sw_DataParams_t *pDataParams
+                               );
+
+void phceT4T_Sw_Int_MarkDirty(
+                               phceT4T_Sw_DataParams_t *pDataParams,
+                               uint32_t dwOffset,
+                               uint32_t dwLength
+                               );
+
+void phceT4T_Sw_Int_WriteFile(
+                              phceT4T_Sw_DataParams_t *pDataParams,
+                              uint8_t *pData,
+                              uint32_t dwDataLen
+                              );
+
 void phceT4T_Sw_Int_UpdateFile(
                                phceT4T_Sw_DataParams_t *pDataParams,
                                uint8_t *pData,
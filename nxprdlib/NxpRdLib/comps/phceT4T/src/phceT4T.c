@@ -92,6 +92,115 @@ phStatus_t phceT4T_SetElementaryFile(
     return status;
 }
 
+phStatus_t phceT4T_SetStaticResponse(
+                                     void *pDataParams,
+                                     uint8_t *pCApdu,
+                                     uint16_t wCApduLen,
+                                     uint8_t *pRApdu,
+                                     uint16_t wRApduLen
+                                     )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phceT4T_SetStaticResponse");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pCApdu);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pRApdu);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pCApdu_log, pCApdu, wCApduLen);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pRApdu_log, pRApdu, wRApduLen);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+
+    PH_ASSERT_NULL (pDataParams);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_CE_T4T)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CE_T4T);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHCE_T4T_SW
+    case PHCE_T4T_SW_ID:
+        status = phceT4T_Sw_SetStaticResponse(
+            (phceT4T_Sw_DataParams_t *) pDataParams,
+            pCApdu,
+            wCApduLen,
+            pRApdu,
+            wRApduLen);
+        break;
+#endif /* NXPBUILD__PHCE_T4T_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CE_T4T);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phceT4T_SetFlushCallback(
+                                    void *pDataParams,
+                                    phceT4T_FlushCallback_t pFlushCallback,
+                                    void *pContext
+                                    )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phceT4T_SetFlushCallback");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+
+    PH_ASSERT_NULL (pDataParams);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_CE_T4T)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CE_T4T);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHCE_T4T_SW
+    case PHCE_T4T_SW_ID:
+        status = phceT4T_Sw_SetFlushCallback(
+            (phceT4T_Sw_DataParams_t *) pDataParams,
+            pFlushCallback,
+            pContext);
+        break;
+#endif /* NXPBUILD__PHCE_T4T_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CE_T4T);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
 phStatus_t phceT4T_ProcessCmd(
                               void *pDataParams,
                               uint16_t wOption,
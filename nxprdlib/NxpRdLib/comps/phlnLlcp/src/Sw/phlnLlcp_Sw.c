@@ -138,6 +138,7 @@ phStatus_t phlnLlcp_Sw_Activate(
     uint16_t                       PH_MEMLOC_REM wRxLen;
     uint16_t                       PH_MEMLOC_REM wTempLen;
     uint16_t                       PH_MEMLOC_REM wSymmTime;
+    uint16_t                       PH_MEMLOC_REM wSymmCurTime;
     uint16_t                       PH_MEMLOC_REM wLtoTime;
 
     /* Reset Pointer to head of Registered Sockets to NULL. */
@@ -155,6 +156,7 @@ phStatus_t phlnLlcp_Sw_Activate(
 
     /* Initialize MAC layer. */
     PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_MacInit(pDataParams, bDevType, &wSymmTime, &wLtoTime));
+    wSymmCurTime = wSymmTime;
 
     /* Initialize Tools for Message Queues. */
     PH_CHECK_SUCCESS_FCT(statusTmp, phTools_Q_Init());
@@ -187,7 +189,8 @@ phStatus_t phlnLlcp_Sw_Activate(
 
         /* Stop LinkLoss Timer & Start SYMM Timer. */
         PH_CHECK_SUCCESS_FCT(wStatus, phlnLlcp_Timers_LtoStop());
-        PH_CHECK_SUCCESS_FCT(wStatus, phlnLlcp_Timers_SymStart(wSymmTime));
+        wSymmCurTime = phlnLlcp_Sw_Int_SymmAdapt(pRxBuffer, wRxLen, wSymmCurTime, wSymmTime);
+        PH_CHECK_SUCCESS_FCT(wStatus, phlnLlcp_Timers_SymStart(wSymmCurTime));
 
         /* Post to the Queue PH_TOOLS_Q_RX_DATA */
         PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_Int_PostRxMsgQueue(pRxBuffer, wRxLen));
@@ -207,7 +210,11 @@ phStatus_t phlnLlcp_Sw_Activate(
         case PH_TOOLS_Q_DATA_TO_BE_SENT:
             /* Stop SYMM Timer & perform 18092 Transmit. */
             PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Timers_SymStop());
+#if PHLN_LLCP_AGF
+            wStatus = phlnLlcp_Sw_Int_SendAgf(pDataParams, psMsgQueue, &bPerformRx);
+#else
             wStatus = phlnLlcp_Sw_Int_Send(psMsgQueue, &bPerformRx);
+#endif /* PHLN_LLCP_AGF */
             if (wStatus != PH_ERR_SUCCESS)
             {
                 (void)phlnLlcp_MacDeactivation();
@@ -282,7 +289,8 @@ phStatus_t phlnLlcp_Sw_Activate(
 
                 /* Stop LinkLoss Timer & Start SymmTimer */
                 PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Timers_LtoStop());
-                PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Timers_SymStart(wSymmTime));
+                wSymmCurTime = phlnLlcp_Sw_Int_SymmAdapt(pRxBuffer, wRxLen, wSymmCurTime, wSymmTime);
+                PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Timers_SymStart(wSymmCurTime));
 
                 /* Post the Received Data to the Message queue */
                 PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_Int_PostRxMsgQueue(pRxBuffer, wRxLen));
@@ -454,12 +462,33 @@ phStatus_t phlnLlcp_Sw_Transport_Socket_Receive(
                                                 )
 {
     phStatus_t PH_MEMLOC_REM wStatus;
+    uint8_t    PH_MEMLOC_REM bNr;
+
     /* Check for Valid input parameters. */
     if (psSocket == NULL)
     {
         return (PH_ERR_INVALID_PARAMETER | PH_COMP_LN_LLCP);
     }
 
+    /* Deliver the I PDUs held in the receive ring before blocking for the next one. */
+    if ((psSocket->fReady == true) && (phlnLlcp_Sw_Int_RxRing_Count(psSocket) != 0))
+    {
+        psSocket->fReady = false;
+        phlnLlcp_Sw_Int_RxRing_Get(psSocket);
+
+        /* Delivered I PDU frees a slot in the receive ring, acknowledge it to open the Receive Window of the peer. */
+        if ((psSocket->bState == PHLN_LLCP_SOCKET_INFO_EX) || (psSocket->bState == PHLN_LLCP_SOCKET_INFO_SEND_EX))
+        {
+            bNr = phlnLlcp_Sw_Int_RxAck(psSocket);
+            if ((PHLN_LLCP_SW_MOD16_DIFF(bNr, psSocket->sSeq.bRxAck_Vra) != 0) &&
+                (PHLN_LLCP_SW_MOD16_DIFF(bNr, psSocket->sSeq.bRxAck_Vra) <= psSocket->bLRw))
+            {
+                PH_CHECK_SUCCESS_FCT(wStatus, phlnLlcp_Sw_Int_Pdu_RrOrRnr(psSocket, PHLN_LLCP_PTYPE_RR));
+            }
+        }
+        return PH_ERR_SUCCESS;
+    }
+
     /* Block on receive semaphore */
     PH_CHECK_SUCCESS_FCT(wStatus, phOsal_Semaphore_Take(psSocket->xRxSema, 0xFFFFFFFFUL));
 
@@ -81,6 +81,11 @@
 * Received SNL PDU with no SDREQ TLV. No need to send SNL PDU back.
 */
 #define PH_ERR_LLCP_NO_SDREQ                                 0x93
+
+/**
+* Received I PDU is held in the Socket receive ring as the Socket is not ready.
+*/
+#define PH_ERR_LLCP_INFO_QUEUED                              0x94
 /*@}*/
 
 
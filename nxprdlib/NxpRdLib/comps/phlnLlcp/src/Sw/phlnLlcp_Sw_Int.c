@@ -83,6 +83,7 @@ phStatus_t phlnLlcp_Sw_Int_Transport_Socket_Register(
     pSocket->sSeq.bRxState_Vr = 0;
     pSocket->sSeq.bRxAck_Vra = 0;
     pSocket->pNext = NULL;
+    phlnLlcp_Sw_Int_RxRing_Init(pSocket);
 
     if ((eType != PHLN_LLCP_DEFAULTLINK_SOCKET) && (gpphlnLlcp_Socket_RegSockets == NULL))
     {
@@ -310,8 +311,8 @@ phStatus_t phlnLlcp_Sw_Int_ParseGenBytes(uint8_t *pGenBytes, uint16_t wLength, p
             wIndex += 3;
             break;
 
-            /* discard RW as we are fixed to 1 */
         case PHLN_LLCP_TLV_TYPE_RW:
+            pLMBytes->bRw = pGenBytes[wIndex + 2] & 0x0F;
             wIndex += 3;
             break;
 
@@ -599,6 +600,90 @@ phStatus_t phlnLlcp_Sw_Int_PostRxMsgQueue(uint8_t *pRxBuffer, uint16_t wRxLen)
     return PH_ERR_SUCCESS;
 }
 
+void phlnLlcp_Sw_Int_RxRing_Init(phlnLlcp_Transport_Socket_t *psSocket)
+{
+    uint32_t PH_MEMLOC_REM dwSlots;
+
+    psSocket->wLMiu = (uint16_t)((psSocket->dwBufLen > PHLN_LLCP_MIU) ? PHLN_LLCP_MIU : psSocket->dwBufLen);
+
+    /* First MIU bytes of the Socket Rx Buffer hold the Packet delivered to the Application,
+    * remaining bytes are split into receive ring slots of Length field + MIU bytes. */
+    dwSlots = (psSocket->dwBufLen - psSocket->wLMiu) / (psSocket->wLMiu + PHLN_LLCP_SW_RXRING_LEN_SIZE);
+    if (dwSlots > PHLN_LLCP_RW_MAX)
+    {
+        dwSlots = PHLN_LLCP_RW_MAX;
+    }
+
+    psSocket->bLRw = (uint8_t)((dwSlots == 0) ? PHLN_LLCP_TLV_RW_VALUE : dwSlots);
+    psSocket->bRRw = PHLN_LLCP_TLV_RW_VALUE;
+    psSocket->bRxHead = 0;
+    psSocket->bRxTail = 0;
+    psSocket->fTxWait = false;
+}
+
+uint8_t phlnLlcp_Sw_Int_RxRing_Count(phlnLlcp_Transport_Socket_t *psSocket)
+{
+    uint8_t PH_MEMLOC_REM bSlots = psSocket->bLRw;
+
+    if (psSocket->dwBufLen < (((uint32_t)psSocket->wLMiu * 2U) + PHLN_LLCP_SW_RXRING_LEN_SIZE))
+    {
+        return 0;
+    }
+
+    /* Head and Tail run modulo 2 * Slots to differentiate between full and empty ring. */
+    return (uint8_t)(((psSocket->bRxTail + (2U * bSlots)) - psSocket->bRxHead) % (2U * bSlots));
+}
+
+phStatus_t phlnLlcp_Sw_Int_RxRing_Put(phlnLlcp_Transport_Socket_t *psSocket,
+                                      uint8_t *pData,
+                                      uint16_t wLength)
+{
+    uint8_t * PH_MEMLOC_REM pSlot;
+    uint8_t   PH_MEMLOC_REM bSlots = psSocket->bLRw;
+    uint8_t   PH_MEMLOC_REM bTail = psSocket->bRxTail;
+
+    if ((psSocket->dwBufLen < (((uint32_t)psSocket->wLMiu * 2U) + PHLN_LLCP_SW_RXRING_LEN_SIZE)) ||
+        (phlnLlcp_Sw_Int_RxRing_Count(psSocket) >= bSlots))
+    {
+        return PH_ERR_LLCP_BUSY;
+    }
+
+    pSlot = &psSocket->pbRxBuffer[psSocket->wLMiu + ((uint32_t)(bTail % bSlots) * (psSocket->wLMiu + PHLN_LLCP_SW_RXRING_LEN_SIZE))];
+    pSlot[0] = (uint8_t)(wLength >> 8);
+    pSlot[1] = (uint8_t)(wLength & 0xFF);
+    memcpy(&pSlot[PHLN_LLCP_SW_RXRING_LEN_SIZE], pData, wLength); /* PRQA S 3200 */
+
+    /* Tail is only updated by LLCP Task after the slot is filled. */
+    psSocket->bRxTail = (uint8_t)(((bTail + 1U) == (2U * bSlots)) ? 0U : (bTail + 1U));
+
+    return PH_ERR_LLCP_INFO_QUEUED;
+}
+
+void phlnLlcp_Sw_Int_RxRing_Get(phlnLlcp_Transport_Socket_t *psSocket)
+{
+    uint8_t * PH_MEMLOC_REM pSlot;
+    uint8_t   PH_MEMLOC_REM bSlots = psSocket->bLRw;
+    uint8_t   PH_MEMLOC_REM bHead = psSocket->bRxHead;
+
+    pSlot = &psSocket->pbRxBuffer[psSocket->wLMiu + ((uint32_t)(bHead % bSlots) * (psSocket->wLMiu + PHLN_LLCP_SW_RXRING_LEN_SIZE))];
+    psSocket->dwLength = ((uint32_t)pSlot[0] << 8) | pSlot[1];
+    memcpy(psSocket->pbRxBuffer, &pSlot[PHLN_LLCP_SW_RXRING_LEN_SIZE], psSocket->dwLength); /* PRQA S 3200 */
+
+    /* Head is only updated by Application Task after the slot is consumed. */
+    psSocket->bRxHead = (uint8_t)(((bHead + 1U) == (2U * bSlots)) ? 0U : (bHead + 1U));
+}
+
+uint8_t phlnLlcp_Sw_Int_RxAck(phlnLlcp_Transport_Socket_t *psSocket)
+{
+    uint8_t PH_MEMLOC_REM bVr;
+
+    /* Read V(R) before the ring count, as LLCP Task updates the ring Tail before V(R)
+    * this will never acknowledge an I PDU that is still held in the receive ring. */
+    bVr = psSocket->sSeq.bRxState_Vr;
+
+    return PHLN_LLCP_SW_MOD16_DIFF(bVr, phlnLlcp_Sw_Int_RxRing_Count(psSocket));
+}
+
 phStatus_t phlnLlcp_Sw_Int_Send(phTools_Q_t *psMsgQueue, uint8_t *pbPerformRx)
 {
     phStatus_t                    PH_MEMLOC_REM wStatus = PH_ERR_INTERNAL_ERROR;
@@ -652,6 +737,22 @@ phStatus_t phlnLlcp_Sw_Int_Send(phTools_Q_t *psMsgQueue, uint8_t *pbPerformRx)
             case PHLN_LLCP_SOCKET_INFO_SEND_EX :
                 wStatus = phlnLlcp_Sw_Int_Pdu_InfoEx (psSocket, psMsgQueue->pbData, (uint16_t)psMsgQueue->dwLength, psMsgQueue->wFrameOpt,
                     pbPerformRx);
+
+                if ((wStatus == PH_ERR_SUCCESS) &&
+                    ((psMsgQueue->wFrameOpt == PH_TRANSMIT_DEFAULT) || (psMsgQueue->wFrameOpt == PH_TRANSMIT_BUFFER_LAST)))
+                {
+                    if (PHLN_LLCP_SW_TXWINDOW_OPEN(psSocket))
+                    {
+                        /* Remote Receive Window allows more I PDUs, unblock the Send without waiting for RR PDU. */
+                        psSocket->bState = PHLN_LLCP_SOCKET_INFO_EX;
+                        psSocket->wStatus = PH_ERR_SUCCESS;
+                        PH_CHECK_SUCCESS_FCT(wStatustmp, phOsal_Semaphore_Give(psSocket->xSema));
+                    }
+                    else
+                    {
+                        psSocket->fTxWait = true;
+                    }
+                }
                 break;
 
             case PHLN_LLCP_SOCKET_CONN_PEND  :
@@ -678,6 +779,137 @@ phStatus_t phlnLlcp_Sw_Int_Send(phTools_Q_t *psMsgQueue, uint8_t *pbPerformRx)
     return wStatus;
 }
 
+#if PHLN_LLCP_AGF
+/* Returns the size an LLC PDU will occupy inside an AGF PDU, zero if the message can not be aggregated. */
+static uint16_t phlnLlcp_Sw_Int_AgfPduLength(phTools_Q_t *psMsgQueue)
+{
+    phlnLlcp_Transport_Socket_t * PH_MEMLOC_REM psSocket;
+
+    if ((psMsgQueue == NULL) || (psMsgQueue->bType != PH_TOOLS_Q_DATA_TO_BE_SENT))
+    {
+        return 0;
+    }
+
+    /* Internal PDUs (RR, RNR, DM, CC, queued DISC, SNL SDRES...) are already framed and may be aggregated. */
+    if (psMsgQueue->bLlcpData == PH_ON)
+    {
+        return (uint16_t)(PHLN_LLCP_AGF_LEN_FIELD_SIZE + psMsgQueue->dwLength);
+    }
+
+    /* Link Management PDUs without a socket, SNL requests of the socket and chained Application data are sent alone. */
+    psSocket = psMsgQueue->pSender;
+    if ((psSocket == NULL) || ((psSocket->bLsap == 0) && (psSocket->bRsap == 0)) ||
+        (psMsgQueue->wFrameOpt != PH_TRANSMIT_DEFAULT))
+    {
+        return 0;
+    }
+
+    if (psSocket->eSocketType == PHLN_LLCP_TRANSPORT_CONNECTIONLESS)
+    {
+        if (psSocket->bState == PHLN_LLCP_SOCKET_SNL)
+        {
+            return 0;
+        }
+        return (uint16_t)(PHLN_LLCP_AGF_LEN_FIELD_SIZE + PHLN_LLCP_UI_HEADER_SIZE + psMsgQueue->dwLength);
+    }
+
+    if (psSocket->bState == PHLN_LLCP_SOCKET_INFO_SEND_EX)
+    {
+        return (uint16_t)(PHLN_LLCP_AGF_LEN_FIELD_SIZE + PHLN_LLCP_HEADER_SIZE + psMsgQueue->dwLength);
+    }
+
+    return 0;
+}
+
+phStatus_t phlnLlcp_Sw_Int_SendAgf(phlnLlcp_Sw_DataParams_t *pDataParams, phTools_Q_t *psMsgQueue, uint8_t *pbPerformRx)
+{
+    phStatus_t    PH_MEMLOC_REM wStatus;
+    phTools_Q_t * PH_MEMLOC_REM psFirstMsg = psMsgQueue;
+    phTools_Q_t * PH_MEMLOC_REM psNextMsg;
+    uint16_t      PH_MEMLOC_REM wPduLen;
+    uint16_t      PH_MEMLOC_REM wNextLen;
+    uint16_t      PH_MEMLOC_REM wAgfLen;
+    uint16_t      PH_MEMLOC_REM wMiu;
+    uint8_t       PH_MEMLOC_REM baHeader[PHLN_LLCP_AGF_HEADER_SIZE];
+
+    /* Remote Link MIU limits the information field of the AGF PDU. */
+    wMiu = (pDataParams->sRemoteLMParams.wMiu & 0x07FF) + PHLN_LLCP_DEFAULT_SPEC_MIU;
+
+    wPduLen = phlnLlcp_Sw_Int_AgfPduLength(psMsgQueue);
+    psNextMsg = phTools_Q_Peek();
+    wNextLen = phlnLlcp_Sw_Int_AgfPduLength(psNextMsg);
+
+    /* Nothing to aggregate, send the PDU as it is. */
+    if ((wPduLen == 0) || (wNextLen == 0) || ((wPduLen + wNextLen) > wMiu))
+    {
+        return phlnLlcp_Sw_Int_Send(psMsgQueue, pbPerformRx);
+    }
+
+    (void)phlnLlcp_Sw_Int_Pdu_FrameHeader(PHLN_LLCP_PTYPE_AGF, 0, 0, 0, 0, baHeader);
+    PH_CHECK_SUCCESS_FCT(wStatus, phlnLlcp_MacTransmit(PH_TRANSMIT_BUFFER_FIRST, baHeader, PHLN_LLCP_AGF_HEADER_SIZE));
+
+    wAgfLen = 0;
+    do
+    {
+        /* Length field of the enclosed PDU. */
+        baHeader[0] = (uint8_t)((wPduLen - PHLN_LLCP_AGF_LEN_FIELD_SIZE) >> 8);
+        baHeader[1] = (uint8_t)(wPduLen - PHLN_LLCP_AGF_LEN_FIELD_SIZE);
+        wStatus = phlnLlcp_MacTransmit(PH_TRANSMIT_BUFFER_CONT, baHeader, PHLN_LLCP_AGF_LEN_FIELD_SIZE);
+
+        if (wStatus == PH_ERR_SUCCESS)
+        {
+            phlnLlcp_MacSetAggregate(PH_ON);
+            wStatus = phlnLlcp_Sw_Int_Send(psMsgQueue, pbPerformRx);
+            phlnLlcp_MacSetAggregate(PH_OFF);
+        }
+
+        /* The first message is released by the caller. */
+        if (psMsgQueue != psFirstMsg)
+        {
+            (void)phTools_Q_Release(psMsgQueue, 0xFFFFFFFFUL);
+        }
+
+        if (wStatus != PH_ERR_SUCCESS)
+        {
+            return wStatus;
+        }
+        wAgfLen += wPduLen;
+
+        /* Append the next queued PDU while it fits into the remote Link MIU. */
+        psMsgQueue = NULL;
+        psNextMsg = phTools_Q_Peek();
+        wNextLen = phlnLlcp_Sw_Int_AgfPduLength(psNextMsg);
+        if ((wNextLen != 0) && ((wAgfLen + wNextLen) <= wMiu))
+        {
+            psMsgQueue = phTools_Q_ReceiveIf(psNextMsg);
+            wPduLen = wNextLen;
+        }
+    }
+    while (psMsgQueue != NULL);
+
+    /* Close the AGF PDU and send it. */
+    *pbPerformRx = true;
+    return phlnLlcp_MacTransmit(PH_TRANSMIT_BUFFER_LAST, baHeader, 0);
+}
+#endif /* PHLN_LLCP_AGF */
+
+uint16_t phlnLlcp_Sw_Int_SymmAdapt(uint8_t *pRxBuffer, uint16_t wRxLength, uint16_t wSymmTime, uint16_t wSymmTimeMax)
+{
+    if ((wRxLength >= PHLN_LLCP_UI_HEADER_SIZE) &&
+        (PHLN_LLCP_PDU_GET_PTYPE(pRxBuffer[0], pRxBuffer[1]) == PHLN_LLCP_PTYPE_SYMM))
+    {
+        /* Link is idle, back off towards the SYMM timeout derived from LTO. */
+        wSymmTime = (wSymmTime > (wSymmTimeMax >> 1)) ? wSymmTimeMax : (uint16_t)(wSymmTime << 1);
+    }
+    else
+    {
+        /* LLC PDUs are flowing, keep the link turnaround short. */
+        wSymmTime = (wSymmTimeMax > PHLN_LLCP_SYMM_ACTIVE_MS) ? PHLN_LLCP_SYMM_ACTIVE_MS : wSymmTimeMax;
+    }
+
+    return wSymmTime;
+}
+
 phStatus_t phlnLlcp_Sw_Int_Pdu_Process(phlnLlcp_Sw_DataParams_t * pDataParams,
                                        uint8_t *pRxBuffer,
                                        uint32_t dwLength,
@@ -754,6 +986,7 @@ phStatus_t phlnLlcp_Sw_Int_Pdu_Process(phlnLlcp_Sw_DataParams_t * pDataParams,
         (*ppsSocket)->bRsap = bRsap;
         (void)phlnLlcp_Sw_Int_ParseGenBytes(&pRxBuffer[2], (uint16_t)(dwLength - 2), &sLMBytes);
         (*ppsSocket)->wRMiu = sLMBytes.wMiu + 128;
+        (*ppsSocket)->bRRw = (sLMBytes.bRw != 0) ? sLMBytes.bRw : PHLN_LLCP_TLV_RW_VALUE;
         break;
 
     case PHLN_LLCP_PTYPE_CC:
@@ -762,6 +995,7 @@ phStatus_t phlnLlcp_Sw_Int_Pdu_Process(phlnLlcp_Sw_DataParams_t * pDataParams,
         (*ppsSocket)->bRsap = bRsap; /* Helps while connected through Uri */
         //(*ppsSocket)->wRMiu = sLMBytes.wMiu + 128;
         (*ppsSocket)->wRMiu = sLMBytes.wMiu + 128;
+        (*ppsSocket)->bRRw = (sLMBytes.bRw != 0) ? sLMBytes.bRw : PHLN_LLCP_TLV_RW_VALUE;
         break;
 
     case PHLN_LLCP_PTYPE_DISC:
@@ -785,31 +1019,34 @@ phStatus_t phlnLlcp_Sw_Int_Pdu_Process(phlnLlcp_Sw_DataParams_t * pDataParams,
         }
         else
         {
-            if((*ppsSocket)->sSeq.bSendState_Vs == bNr)
+            if(PHLN_LLCP_SW_NR_VALID(*ppsSocket, bNr))
             {
                 /* Update the Vsa */
                 (*ppsSocket)->sSeq.bSendAck_Vsa = bNr;
 
+                /* If Received Data length is more than the Local MIU then throw
+                * Information Error and send FRMR PDU to Peer. */
+                if ((dwLength - PHLN_LLCP_HEADER_SIZE) > (*ppsSocket)->wLMiu)
+                {
+                    wStatus = PH_ERR_LLCP_PDU_INFO_ERR;
+                }
                 /* CHeck for the ready flag to copy the received data to the sockets Rx buffer */
-                if((*ppsSocket)->fReady == true)
+                else if(((*ppsSocket)->fReady == true) && (phlnLlcp_Sw_Int_RxRing_Count(*ppsSocket) == 0))
                 {
                     (*ppsSocket)->fReady = false;
-                    /* If Received Data length is more than the Socket Buffer Size then throw
-                    * Information Error and send FRMR PDU to Peer. */
-                    if ((dwLength - PHLN_LLCP_HEADER_SIZE) <= (*ppsSocket)->dwBufLen)
-                    {
-                        (*ppsSocket)->dwLength = dwLength - PHLN_LLCP_HEADER_SIZE;
-                        memcpy((*ppsSocket)->pbRxBuffer, (uint8_t *)(pRxBuffer + PHLN_LLCP_HEADER_SIZE), (*ppsSocket)->dwLength); /* PRQA S 3200 */
-                        PHLN_LLCP_SW_MOD16_INC((*ppsSocket)->sSeq.bRxState_Vr);
-                    }
-                    else
-                    {
-                        wStatus = PH_ERR_LLCP_PDU_INFO_ERR;
-                    }
+                    (*ppsSocket)->dwLength = dwLength - PHLN_LLCP_HEADER_SIZE;
+                    memcpy((*ppsSocket)->pbRxBuffer, (uint8_t *)(pRxBuffer + PHLN_LLCP_HEADER_SIZE), (*ppsSocket)->dwLength); /* PRQA S 3200 */
+                    PHLN_LLCP_SW_MOD16_INC((*ppsSocket)->sSeq.bRxState_Vr);
                 }
                 else
                 {
-                    wStatus = PH_ERR_LLCP_BUSY;
+                    /* Socket is still processing previous Packet, hold the I PDU in receive ring if space is available. */
+                    wStatus = phlnLlcp_Sw_Int_RxRing_Put(*ppsSocket, (uint8_t *)(pRxBuffer + PHLN_LLCP_HEADER_SIZE),
+                        (uint16_t)(dwLength - PHLN_LLCP_HEADER_SIZE));
+                    if (wStatus == PH_ERR_LLCP_INFO_QUEUED)
+                    {
+                        PHLN_LLCP_SW_MOD16_INC((*ppsSocket)->sSeq.bRxState_Vr);
+                    }
                 }
             }
             else
@@ -876,7 +1113,7 @@ phStatus_t phlnLlcp_Sw_Int_Pdu_Process(phlnLlcp_Sw_DataParams_t * pDataParams,
 
     case PHLN_LLCP_PTYPE_RR:
         bNr = pRxBuffer[2] & 0x0F;
-        if((*ppsSocket)->sSeq.bSendState_Vs == bNr)
+        if(PHLN_LLCP_SW_NR_VALID(*ppsSocket, bNr))
         {
             /* Update the Vsa */
             (*ppsSocket)->sSeq.bSendAck_Vsa = bNr;
@@ -990,6 +1227,7 @@ phStatus_t phlnLlcp_Sw_Int_Pdu_Handle(phStatus_t wProcessStatus,
         switch(wProcessStatus)
         {
         case PH_ERR_SUCCESS:
+        case PH_ERR_LLCP_INFO_QUEUED:
             /* Send RR PDU. */
             wStatus = phlnLlcp_Sw_Int_Pdu_RrOrRnr(psSocket, PHLN_LLCP_PTYPE_RR);
             break;
@@ -1119,17 +1357,23 @@ uint16_t phlnLlcp_Sw_Int_PostEvents(phStatus_t wProcessStatus,
             break;
 
         case PHLN_LLCP_PTYPE_INFO:
-            if (psSocket->bState == PHLN_LLCP_SOCKET_INFO_SEND_EX)
+            if ((psSocket->fTxWait == true) && (PHLN_LLCP_SW_TXWINDOW_OPEN(psSocket)))
             {
-                psSocket->wStatus = PH_ERR_SUCCESS_INFO_RECEIVED;
+                /* I PDU acknowledged the pending Send, data held in receive ring is delivered by next Receive. */
+                psSocket->fTxWait = false;
+                psSocket->wStatus = (wProcessStatus == PH_ERR_LLCP_INFO_QUEUED) ? PH_ERR_SUCCESS : PH_ERR_SUCCESS_INFO_RECEIVED;
                 psSocket->bState = PHLN_LLCP_SOCKET_INFO_EX;
                 PH_CHECK_SUCCESS_FCT(wStatus, phOsal_Semaphore_Give(psSocket->xSema));
             }
-            else
+            else if (wProcessStatus != PH_ERR_LLCP_INFO_QUEUED)
             {
                 psSocket->wStatus = PH_ERR_SUCCESS;
                 PH_CHECK_SUCCESS_FCT(wStatus, phOsal_Semaphore_Give(psSocket->xRxSema));
             }
+            else
+            {
+                /* Nothing to do. */
+            }
             break;
 
 
@@ -1167,9 +1411,14 @@ uint16_t phlnLlcp_Sw_Int_PostEvents(phStatus_t wProcessStatus,
 
         case PHLN_LLCP_PTYPE_RR:
             wTxFlag = PH_OFF;
-            psSocket->bState = PHLN_LLCP_SOCKET_INFO_EX;
-            psSocket->wStatus = PH_ERR_SUCCESS;
-            PH_CHECK_SUCCESS_FCT(wStatus, phOsal_Semaphore_Give(psSocket->xSema));
+            /* Unblock the Send only if it is waiting for the Transmit Window to be opened. */
+            if ((psSocket->fTxWait == true) && (PHLN_LLCP_SW_TXWINDOW_OPEN(psSocket)))
+            {
+                psSocket->fTxWait = false;
+                psSocket->bState = PHLN_LLCP_SOCKET_INFO_EX;
+                psSocket->wStatus = PH_ERR_SUCCESS;
+                PH_CHECK_SUCCESS_FCT(wStatus, phOsal_Semaphore_Give(psSocket->xSema));
+            }
             break;
 
         case PHLN_LLCP_PTYPE_RNR:
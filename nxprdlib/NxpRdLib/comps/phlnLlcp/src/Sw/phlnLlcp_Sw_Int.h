@@ -53,7 +53,27 @@ typedef enum phlnLlcp_SocketType{
     }
 
 #define PHLN_LLCP_SW_MOD16_INC(x) (((x) > 14)? (x) = 0 : (x)++)
-#define PHLN_LLCP_SW_MOD16_DEC(x) (((x) == 0)? (x) = 14 : (x)--)
+#define PHLN_LLCP_SW_MOD16_DEC(x) (((x) == 0)? (x) = 15 : (x)--)
+
+/**
+* Number of sequence numbers from y to x as per mod16.
+*/
+#define PHLN_LLCP_SW_MOD16_DIFF(x, y)  ((uint8_t)((x) - (y)) & 0x0F)
+
+/**
+* Transmit Window is open if the number of unacknowledged I PDUs is less than the remote Receive Window.
+*/
+#define PHLN_LLCP_SW_TXWINDOW_OPEN(psSocket)                                                        \
+    (PHLN_LLCP_SW_MOD16_DIFF((psSocket)->sSeq.bSendState_Vs, (psSocket)->sSeq.bSendAck_Vsa) < (psSocket)->bRRw)
+
+/**
+* Received N(R) is valid if it lies between V(SA) and V(S).
+*/
+#define PHLN_LLCP_SW_NR_VALID(psSocket, bNr)                                                        \
+    (PHLN_LLCP_SW_MOD16_DIFF((psSocket)->sSeq.bSendState_Vs, (bNr)) <=                              \
+     PHLN_LLCP_SW_MOD16_DIFF((psSocket)->sSeq.bSendState_Vs, (psSocket)->sSeq.bSendAck_Vsa))
+
+#define PHLN_LLCP_SW_RXRING_LEN_SIZE   2U                                           /**< Size of the Length field stored in front of each I PDU held in the receive ring. */
 
 #define PHLN_LLCP_SW_FIRST_TID    0x80
 /**
@@ -120,6 +140,19 @@ phStatus_t phlnLlcp_Sw_Int_Send(phTools_Q_t *psMsgQueue,
                                 uint8_t *pbPerformRx
                                 );
 
+#if PHLN_LLCP_AGF
+phStatus_t phlnLlcp_Sw_Int_SendAgf(phlnLlcp_Sw_DataParams_t *pDataParams,
+                                   phTools_Q_t *psMsgQueue,
+                                   uint8_t *pbPerformRx
+                                   );
+#endif /* PHLN_LLCP_AGF */
+
+uint16_t phlnLlcp_Sw_Int_SymmAdapt(uint8_t *pRxBuffer,
+                                   uint16_t wRxLength,
+                                   uint16_t wSymmTime,
+                                   uint16_t wSymmTimeMax
+                                   );
+
 uint16_t phlnLlcp_Sw_Int_Pdu_FrameHeader(phlnLlcp_PType_t ePType,
                                          uint8_t bDsap,
                                          uint8_t bSsap,
@@ -172,6 +205,35 @@ phStatus_t phlnLlcp_Sw_Int_Pdu_RrOrRnr(phlnLlcp_Transport_Socket_t *psSocket,
                                        phlnLlcp_PType_t bPtype
                                        );
 
+/**
+* Configure Local MIU and Local Receive Window of the socket based on the Socket Rx Buffer size.
+*/
+void phlnLlcp_Sw_Int_RxRing_Init(phlnLlcp_Transport_Socket_t *psSocket);
+
+/**
+* Hold the received information field in the socket receive ring.
+*/
+phStatus_t phlnLlcp_Sw_Int_RxRing_Put(phlnLlcp_Transport_Socket_t *psSocket,
+                                      uint8_t *pData,
+                                      uint16_t wLength
+                                      );
+
+/**
+* Move the oldest I PDU held in the socket receive ring to the start of the Socket Rx Buffer.
+*/
+void phlnLlcp_Sw_Int_RxRing_Get(phlnLlcp_Transport_Socket_t *psSocket);
+
+/**
+* Number of I PDUs held in the socket receive ring.
+*/
+uint8_t phlnLlcp_Sw_Int_RxRing_Count(phlnLlcp_Transport_Socket_t *psSocket);
+
+/**
+* N(R) to be sent to the peer. I PDUs held in the receive ring are not yet acknowledged, so that
+* the peer will never send more I PDUs than the socket is able to hold.
+*/
+uint8_t phlnLlcp_Sw_Int_RxAck(phlnLlcp_Transport_Socket_t *psSocket);
+
 phStatus_t phlnLlcp_Sw_Int_Pdu_Process(phlnLlcp_Sw_DataParams_t * pDataParams,
                                        uint8_t *pRxBuffer,
                                        uint32_t dwLength,
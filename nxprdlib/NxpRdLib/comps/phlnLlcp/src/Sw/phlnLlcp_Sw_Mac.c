@@ -49,6 +49,7 @@
 * ***************************************************************************************************************** */
 void *gphlnLlcp_MacDataParams;
 uint32_t gphlnLlcp_MacType;
+static uint8_t gbphlnLlcp_MacAggregate = PH_OFF;
 
 /* *****************************************************************************************************************
 * Private Functions
@@ -177,9 +178,21 @@ phStatus_t phlnLlcp_Sw_MacInit(phlnLlcp_Sw_DataParams_t * pDataParams, uint8_t b
     return wStatus;
 }
 
+void phlnLlcp_MacSetAggregate(uint8_t bOnOff)
+{
+    gbphlnLlcp_MacAggregate = bOnOff;
+}
+
 phStatus_t phlnLlcp_MacTransmit(uint16_t wFrameOpt, uint8_t* pTxBuffer, uint16_t wTxLength)
 {
     phStatus_t PH_MEMLOC_REM wStatus = PH_ERR_USE_CONDITION;
+
+    /* While an AGF is being built the enclosed PDU is only appended, the AGF owner closes the frame. */
+    if (gbphlnLlcp_MacAggregate == PH_ON)
+    {
+        wFrameOpt = PH_TRANSMIT_BUFFER_CONT;
+    }
+
     if (gphlnLlcp_MacType == PHLN_LLCP_INITIATOR)
     {
 #ifdef NXPBUILD__PHPAL_I18092MPI
@@ -49,6 +49,11 @@ phStatus_t phlnLlcp_Sw_MacInit(phlnLlcp_Sw_DataParams_t * pDataParams, uint8_t b
 
 void phlnLlcp_Sw_MacHAL_ShutDown();
 
+/**
+* When enabled all transmissions are buffered with #PH_TRANSMIT_BUFFER_CONT, used to append PDUs to an AGF.
+*/
+void phlnLlcp_MacSetAggregate(uint8_t bOnOff);
+
 phStatus_t phlnLlcp_MacTransmit(uint16_t wFrameOpt, uint8_t* pTxBuffer, uint16_t wTxLength);
 
 phStatus_t phlnLlcp_MacReceive(uint16_t wFrameOpt, uint8_t **ppRxBuffer, uint16_t *pRxLength);
@@ -94,18 +94,18 @@ phStatus_t phlnLlcp_Sw_Int_Pdu_CcOrC(phlnLlcp_Transport_Socket_t *psSocket,
     baPdu[wLength++] = PHLN_LLCP_TLV_TYPE_MIUX;
     baPdu[wLength++] = PHLN_LLCP_TLV_LENGTH_MIUX;
 
-    wLMiu = (uint16_t)((psSocket->dwBufLen > PHLN_LLCP_MIU) ? PHLN_LLCP_MIU: psSocket->dwBufLen);
-    wLMiu -= 128;
+    wLMiu = psSocket->wLMiu - 128;
 
     baPdu[wLength++] = (uint8_t)((wLMiu & 0xFF00) >> 8);
     baPdu[wLength++] = (uint8_t)(wLMiu & 0xFF);
 
+    /* Receive Window is based on the number of I PDUs the Socket Rx Buffer can hold. */
+    baPdu[wLength++] = PHLN_LLCP_TLV_TYPE_RW;
+    baPdu[wLength++] = PHLN_LLCP_TLV_LENGTH_RW;
+    baPdu[wLength++] = psSocket->bLRw;
+
     if((psSocket->bRsap == 0x01) && (bPtype == PHLN_LLCP_PTYPE_CONNECT))
     {
-        baPdu[wLength++] = PHLN_LLCP_TLV_TYPE_RW;
-        baPdu[wLength++] = PHLN_LLCP_TLV_LENGTH_RW;
-        baPdu[wLength++] = PHLN_LLCP_TLV_RW_VALUE;
-
         /* Add SN to TLV bytes sent during Connect PDU. */
         baPdu[wLength++] = PHLN_LLCP_TLV_TYPE_SN;
         baPdu[wLength++] = bSnLength;
@@ -120,10 +120,6 @@ phStatus_t phlnLlcp_Sw_Int_Pdu_CcOrC(phlnLlcp_Transport_Socket_t *psSocket,
     }
     else if (bPtype == PHLN_LLCP_PTYPE_CONNECT)
     {
-        baPdu[wLength++] = PHLN_LLCP_TLV_TYPE_RW;
-        baPdu[wLength++] = PHLN_LLCP_TLV_LENGTH_RW;
-        baPdu[wLength++] = PHLN_LLCP_TLV_RW_VALUE;
-
         wStatus = phlnLlcp_MacTransmit(PH_TRANSMIT_DEFAULT, baPdu, wLength);
     }
     else
@@ -207,11 +203,14 @@ phStatus_t phlnLlcp_Sw_Int_Pdu_RrOrRnr(phlnLlcp_Transport_Socket_t *psSocket,
 {
     uint16_t PH_MEMLOC_REM wLength;
     uint8_t  PH_MEMLOC_REM pResPdu[3];
+    uint8_t  PH_MEMLOC_REM bNr;
+
+    /* I PDUs held in the receive ring are acknowledged only after delivery to the Application. */
+    bNr = phlnLlcp_Sw_Int_RxAck(psSocket);
 
-    wLength = phlnLlcp_Sw_Int_Pdu_FrameHeader(bPtype, psSocket->bRsap, psSocket->bLsap, psSocket->sSeq.bRxState_Vr,
-        0, pResPdu);
+    wLength = phlnLlcp_Sw_Int_Pdu_FrameHeader(bPtype, psSocket->bRsap, psSocket->bLsap, bNr, 0, pResPdu);
 
-    psSocket->sSeq.bRxAck_Vra = psSocket->sSeq.bRxState_Vr;
+    psSocket->sSeq.bRxAck_Vra = bNr;
 
     return phlnLlcp_Sw_Int_HandleMsgQueue(pResPdu, wLength, (uint8_t)PH_TOOLS_Q_DATA_TO_BE_SENT);
 }
@@ -100,6 +100,8 @@ phStatus_t phlnLlcp_Sw_Transport_Socket_WaitForConnection(
             pServerSocket->eSocketType, pServerSocket->bLsap, pServerSocket->pUri, PHLN_LLCP_CONNECTIONSERVER_SOCKET));
 
         pConnServerSocket->bRsap = pServerSocket->bRsap;
+        pConnServerSocket->wRMiu = pServerSocket->wRMiu;
+        pConnServerSocket->bRRw = pServerSocket->bRRw;
         pServerSocket->bRsap = 0;
         pConnServerSocket->bState = pServerSocket->bState;
         pServerSocket->bState = PHLN_LLCP_SOCKET_WAITONCONN;
@@ -270,13 +272,18 @@ phStatus_t phlnLlcp_Sw_Int_Pdu_InfoEx(phlnLlcp_Transport_Socket_t *psSocket,
 {
     phStatus_t PH_MEMLOC_REM wStatus;
     uint8_t    PH_MEMLOC_REM baLlcpHeader[3];
+    uint8_t    PH_MEMLOC_REM bNr;
+
+    /* Piggyback acknowledgement of the I PDUs already delivered to the Application. */
+    bNr = phlnLlcp_Sw_Int_RxAck(psSocket);
 
     switch(wFrameOpt)
     {
     case PH_TRANSMIT_BUFFER_FIRST:
         /* frame I PDU */
         PHLN_LLCP_PDU_FRAME_HEADER(psSocket->bRsap, PHLN_LLCP_PTYPE_INFO, psSocket->bLsap, psSocket->sSeq.bSendState_Vs,
-            psSocket->sSeq.bRxState_Vr, baLlcpHeader);
+            bNr, baLlcpHeader);
+        psSocket->sSeq.bRxAck_Vra = bNr;
         /* Send I PDU frame Header */
         PH_CHECK_SUCCESS_FCT(wStatus, phlnLlcp_MacTransmit(PH_TRANSMIT_BUFFER_FIRST, baLlcpHeader, 3));
         /* Append above layers header, inform above layers header is NOT the last fragment */
@@ -288,15 +295,14 @@ phStatus_t phlnLlcp_Sw_Int_Pdu_InfoEx(phlnLlcp_Transport_Socket_t *psSocket,
         /* Just pass the buffer to the lower layer */
         wStatus = phlnLlcp_MacTransmit(PH_TRANSMIT_BUFFER_LAST, pbTxData, wLength);
         PHLN_LLCP_SW_MOD16_INC(psSocket->sSeq.bSendState_Vs);
-        psSocket->sSeq.bRxAck_Vra = psSocket->sSeq.bRxState_Vr;
         break;
 
     case PH_TRANSMIT_DEFAULT:
         /* frame I PDU */
         PHLN_LLCP_PDU_FRAME_HEADER(psSocket->bRsap, PHLN_LLCP_PTYPE_INFO, psSocket->bLsap, psSocket->sSeq.bSendState_Vs,
-            psSocket->sSeq.bRxState_Vr, baLlcpHeader);
+            bNr, baLlcpHeader);
         PHLN_LLCP_SW_MOD16_INC(psSocket->sSeq.bSendState_Vs);
-        psSocket->sSeq.bRxAck_Vra = psSocket->sSeq.bRxState_Vr;
+        psSocket->sSeq.bRxAck_Vra = bNr;
         /* Send I PDU frame Header */
         PH_CHECK_SUCCESS_FCT(wStatus, phlnLlcp_MacTransmit(PH_TRANSMIT_BUFFER_FIRST, baLlcpHeader, 3));
         /* Append above layers data, inform above layers data is the last fragment */
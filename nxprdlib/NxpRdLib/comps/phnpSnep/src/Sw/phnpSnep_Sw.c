@@ -740,6 +740,464 @@ phStatus_t phnpSnep_Sw_Get(
     return wStatus;
 }
 
+/**
+ * Pulls the next fragment of the NDEF message to be sent from the application reader.
+ */
+static phStatus_t phnpSnep_Sw_Int_Pull(
+                                       pphnpSnep_TxReader_t pfReader,
+                                       void * pContext,
+                                       uint32_t dwOffset,
+                                       uint32_t dwMaxLen,
+                                       uint8_t ** ppData,
+                                       uint32_t * pdwDataLen
+                                       )
+{
+    phStatus_t PH_MEMLOC_REM wStatus;
+
+    *ppData = NULL;
+    *pdwDataLen = 0;
+    PH_CHECK_SUCCESS_FCT(wStatus, pfReader(pContext, dwOffset, dwMaxLen, ppData, pdwDataLen));
+
+    if ((*ppData == NULL) || (*pdwDataLen == 0) || (*pdwDataLen > dwMaxLen))
+    {
+        return (PH_ERR_INTERNAL_ERROR | PH_COMP_NP_SNEP);
+    }
+
+    return PH_ERR_SUCCESS;
+}
+
+/**
+ * Sends a SNEP Request/Response of dwMsgLen bytes pulled from the reader, fragmented as per Remote MIU.
+ * If the message does not fit into the first fragment, bContField is expected from the peer before the
+ * remaining fragments are sent.
+ * Returns #PH_ERR_SUCCESS_INFO_RECEIVED if the peer already answered the last fragment.
+ */
+static phStatus_t phnpSnep_Sw_Int_SendStream(
+                                             phnpSnep_Sw_DataParams_t * pDataParams,
+                                             uint8_t bReqResField,
+                                             uint8_t bContField,
+                                             uint32_t dwMsgLen,
+                                             pphnpSnep_TxReader_t pfReader,
+                                             void * pContext
+                                             )
+{
+    phStatus_t                    PH_MEMLOC_REM wStatus;
+    uint8_t                       PH_MEMLOC_REM baSnepHeader[PHNP_SNEP_HEADER_SIZE];
+    uint8_t *                     PH_MEMLOC_REM pData = NULL;
+    uint32_t                      PH_MEMLOC_REM dwDataLen = 0;
+    uint32_t                      PH_MEMLOC_REM dwOffset;
+    uint8_t                       PH_MEMLOC_REM bRxResponse;
+    phlnLlcp_Transport_Socket_t * PH_MEMLOC_REM pLocSocket;
+
+    pLocSocket = (phlnLlcp_Transport_Socket_t *)pDataParams->psSocket;
+
+    /* Pull the first fragment before buffering the header, so that a failing reader leaves nothing queued. */
+    if (dwMsgLen != 0)
+    {
+        PH_CHECK_SUCCESS_FCT(wStatus, phnpSnep_Sw_Int_Pull(pfReader, pContext, 0,
+            (((dwMsgLen + PHNP_SNEP_HEADER_SIZE) <= pLocSocket->wRMiu)? dwMsgLen : (pLocSocket->wRMiu - PHNP_SNEP_HEADER_SIZE)),
+            &pData, &dwDataLen));
+    }
+
+    phnpSnep_GetHeader(bReqResField, dwMsgLen, baSnepHeader);
+    PH_CHECK_SUCCESS_FCT(wStatus, phlnLlcp_Transport_Socket_Send(pDataParams->plnLlcpDataParams, pLocSocket, baSnepHeader,
+        PHNP_SNEP_HEADER_SIZE, PH_TRANSMIT_BUFFER_FIRST));
+    wStatus = phlnLlcp_Transport_Socket_Send(pDataParams->plnLlcpDataParams, pLocSocket, pData, dwDataLen, PH_TRANSMIT_BUFFER_LAST);
+
+    dwOffset = dwDataLen;
+    if (dwOffset >= dwMsgLen)
+    {
+        return wStatus;
+    }
+
+    if (wStatus == PH_ERR_SUCCESS)
+    {
+        /* Wait for the CONTINUE from the peer. */
+        wStatus = phlnLlcp_Transport_Socket_Receive(pDataParams->plnLlcpDataParams, pLocSocket);
+        if (wStatus != PH_ERR_SUCCESS)
+        {
+            /* Set the Ready flag in Socket to True to receive next Packet and return with error. */
+            pLocSocket->fReady = true;
+            return wStatus;
+        }
+    }
+    else if ((wStatus & PH_ERR_MASK) != PH_ERR_SUCCESS_INFO_RECEIVED)
+    {
+        /* Return in case of any other error. */
+        return wStatus;
+    }
+
+    bRxResponse = pLocSocket->pbRxBuffer[1];
+    dwDataLen = pLocSocket->dwLength;
+    /* Set the Ready flag in Socket to True to receive next Packet. */
+    pLocSocket->fReady = true;
+
+    if ((dwDataLen != PHNP_SNEP_HEADER_SIZE) || (bRxResponse != bContField))
+    {
+        return (PH_ERR_PROTOCOL_ERROR | PH_COMP_NP_SNEP);
+    }
+
+    /* Send the remaining fragments, each one filling the Remote MIU. */
+    do
+    {
+        PH_CHECK_SUCCESS_FCT(wStatus, phnpSnep_Sw_Int_Pull(pfReader, pContext, dwOffset,
+            (((dwMsgLen - dwOffset) > pLocSocket->wRMiu)? pLocSocket->wRMiu : (dwMsgLen - dwOffset)), &pData, &dwDataLen));
+
+        wStatus = phlnLlcp_Transport_Socket_Send(pDataParams->plnLlcpDataParams, pLocSocket, pData, dwDataLen, PH_TRANSMIT_DEFAULT);
+        dwOffset += dwDataLen;
+
+        if ((wStatus != PH_ERR_SUCCESS) && (dwOffset < dwMsgLen))
+        {
+            if ((wStatus & PH_ERR_MASK) == PH_ERR_SUCCESS_INFO_RECEIVED)
+            {
+                /* Peer is not expected to send anything in between the fragments. */
+                pLocSocket->fReady = true;
+                return (PH_ERR_PROTOCOL_ERROR | PH_COMP_NP_SNEP);
+            }
+            return wStatus;
+        }
+    } while (dwOffset < dwMsgLen);
+
+    return wStatus;
+}
+
+/**
+ * Delivers the NDEF message of dwMsgLen bytes, whose first fragment including the SNEP header is in the socket, to the
+ * application callback. If more fragments are expected bContField is sent to the peer first.
+ */
+static phStatus_t phnpSnep_Sw_Int_ReceiveStream(
+                                                phnpSnep_Sw_DataParams_t * pDataParams,
+                                                uint8_t bContField,
+                                                uint32_t dwMsgLen,
+                                                pphnpSnep_RxCallback_t pfRxCallback,
+                                                void * pContext,
+                                                uint32_t * pdwRxLen
+                                                )
+{
+    phStatus_t                    PH_MEMLOC_REM wStatus = PH_ERR_SUCCESS;
+    uint32_t                      PH_MEMLOC_REM dwLength;
+    phlnLlcp_Transport_Socket_t * PH_MEMLOC_REM pLocSocket;
+
+    pLocSocket = (phlnLlcp_Transport_Socket_t *)pDataParams->psSocket;
+
+    dwLength = pLocSocket->dwLength - PHNP_SNEP_HEADER_SIZE;
+    if (dwLength > dwMsgLen)
+    {
+        pLocSocket->fReady = true;
+        return (PH_ERR_PROTOCOL_ERROR | PH_COMP_NP_SNEP);
+    }
+
+    if (dwLength != 0)
+    {
+        wStatus = pfRxCallback(pContext, &pLocSocket->pbRxBuffer[PHNP_SNEP_HEADER_SIZE], dwLength, 0, dwMsgLen);
+    }
+    /* Set the Ready flag in Socket to True to receive next Packet. */
+    pLocSocket->fReady = true;
+    if (wStatus != PH_ERR_SUCCESS)
+    {
+        return wStatus;
+    }
+
+    if (dwMsgLen > dwLength)
+    {
+        wStatus = phnpSnep_Sw_SendCmds(pDataParams, bContField);
+        if ((wStatus != PH_ERR_SUCCESS) && ((wStatus & PH_ERR_MASK) != PH_ERR_SUCCESS_INFO_RECEIVED))
+        {
+            return wStatus;
+        }
+
+        while (dwLength < dwMsgLen)
+        {
+            if ((wStatus & PH_ERR_MASK) != PH_ERR_SUCCESS_INFO_RECEIVED)
+            {
+                wStatus = phlnLlcp_Transport_Socket_Receive(pDataParams->plnLlcpDataParams, pLocSocket);
+                if (wStatus != PH_ERR_SUCCESS)
+                {
+                    /* Set the Ready flag in Socket to True to receive next Packet and return with error. */
+                    pLocSocket->fReady = true;
+                    return wStatus;
+                }
+            }
+
+            if ((dwLength + pLocSocket->dwLength) > dwMsgLen)
+            {
+                pLocSocket->fReady = true;
+                return (PH_ERR_PROTOCOL_ERROR | PH_COMP_NP_SNEP);
+            }
+
+            /* Hand over the fragment while LLCP keeps receiving the next ones. */
+            wStatus = pfRxCallback(pContext, pLocSocket->pbRxBuffer, pLocSocket->dwLength, dwLength, dwMsgLen);
+            dwLength += pLocSocket->dwLength;
+            /* Set the Ready flag in Socket to True to receive next Packet. */
+            pLocSocket->fReady = true;
+            if (wStatus != PH_ERR_SUCCESS)
+            {
+                return wStatus;
+            }
+        }
+    }
+
+    *pdwRxLen = dwLength;
+    return PH_ERR_SUCCESS;
+}
+
+phStatus_t phnpSnep_Sw_PutStream(
+                                 phnpSnep_Sw_DataParams_t * pDataParams,
+                                 uint32_t dwMsgLen,
+                                 pphnpSnep_TxReader_t pfReader,
+                                 void * pContext
+                                 )
+{
+    phStatus_t                    PH_MEMLOC_REM wStatus;
+    phlnLlcp_Transport_Socket_t * PH_MEMLOC_REM pLocSocket;
+    uint8_t                       PH_MEMLOC_REM bRxResponse;
+
+    pLocSocket = (phlnLlcp_Transport_Socket_t *)pDataParams->psSocket;
+
+    /* Check for Valid input parameters. */
+    if ((pfReader == NULL) || (dwMsgLen == 0))
+    {
+        return (PH_ERR_INVALID_PARAMETER | PH_COMP_NP_SNEP);
+    }
+
+    wStatus = phnpSnep_Sw_Int_SendStream(pDataParams, (uint8_t)PHNP_SNEP_REQ_PUT, (uint8_t)PHNP_SNEP_RES_CONT, dwMsgLen,
+        pfReader, pContext);
+    if (wStatus == PH_ERR_SUCCESS)
+    {
+        /* Wait for the SUCCESS response from  the SNEP server. */
+        wStatus = phlnLlcp_Transport_Socket_Receive(pDataParams->plnLlcpDataParams, pLocSocket);
+        if (wStatus != PH_ERR_SUCCESS)
+        {
+            /* Set the Ready flag in Socket to True to receive next Packet and return with error. */
+            pLocSocket->fReady = true;
+            return wStatus;
+        }
+    }
+    else if ((wStatus & PH_ERR_MASK) != PH_ERR_SUCCESS_INFO_RECEIVED)
+    {
+        /* Return in case of any other error. */
+        return wStatus;
+    }
+
+    bRxResponse = pLocSocket->pbRxBuffer[1];
+    /* Set the Ready flag in Socket to True to receive next Packet. */
+    pLocSocket->fReady = true;
+
+    /* Check for the SUCCESS response from the SNEP server. */
+    if (bRxResponse != PHNP_SNEP_RES_SUCCESS)
+    {
+        return (PH_ERR_PROTOCOL_ERROR | PH_COMP_NP_SNEP);
+    }
+
+    return PH_ERR_SUCCESS;
+}
+
+phStatus_t phnpSnep_Sw_GetStream(
+                                 phnpSnep_Sw_DataParams_t * pDataParams,
+                                 uint8_t *pNdefMsg,
+                                 uint32_t dwNdefMsgLen,
+                                 uint32_t dwAcceptableLen,
+                                 pphnpSnep_RxCallback_t pfRxCallback,
+                                 void * pContext,
+                                 uint32_t *pdwRxLen
+                                 )
+{
+    phlnLlcp_Transport_Socket_t * PH_MEMLOC_REM pLocSocket;
+    uint8_t                       PH_MEMLOC_BUF baSnepHeader[10];
+    phStatus_t                    PH_MEMLOC_REM wStatus;
+    uint32_t                      PH_MEMLOC_REM dwLength;
+
+    pLocSocket = (phlnLlcp_Transport_Socket_t *)pDataParams->psSocket;
+
+    /* Check for Valid input parameters. */
+    if ((pNdefMsg == NULL) || (pfRxCallback == NULL) || (pdwRxLen == NULL) || (dwAcceptableLen == 0))
+    {
+        return (PH_ERR_INVALID_PARAMETER | PH_COMP_NP_SNEP);
+    }
+
+    /* If the GET Message + Header Size is more than Remote MIU then this GET Request should not be sent. */
+    if ((dwNdefMsgLen + PHNP_SNEP_ACCEPTABLE_LEN_FIELD + PHNP_SNEP_HEADER_SIZE) > pLocSocket->wRMiu)
+    {
+        return (PH_ERR_INVALID_PARAMETER | PH_COMP_NP_SNEP);
+    }
+    *pdwRxLen = 0;
+
+    /* Form SNEP Header followed by the Acceptable Length field, most significant octet first. */
+    phnpSnep_GetHeader((uint8_t)PHNP_SNEP_REQ_GET, dwNdefMsgLen + PHNP_SNEP_ACCEPTABLE_LEN_FIELD, baSnepHeader);
+    baSnepHeader[6] = (uint8_t)(dwAcceptableLen >> 24);
+    baSnepHeader[7] = (uint8_t)(dwAcceptableLen >> 16);
+    baSnepHeader[8] = (uint8_t)(dwAcceptableLen >> 8);
+    baSnepHeader[9] = (uint8_t)(dwAcceptableLen);
+
+    PH_CHECK_SUCCESS_FCT(wStatus, phlnLlcp_Transport_Socket_Send(pDataParams->plnLlcpDataParams, pLocSocket, baSnepHeader,
+        (PHNP_SNEP_HEADER_SIZE + PHNP_SNEP_ACCEPTABLE_LEN_FIELD), PH_TRANSMIT_BUFFER_FIRST));
+
+    wStatus = phlnLlcp_Transport_Socket_Send(pDataParams->plnLlcpDataParams, pLocSocket, pNdefMsg,
+        dwNdefMsgLen, PH_TRANSMIT_BUFFER_LAST);
+    if (wStatus == PH_ERR_SUCCESS)
+    {
+        /* Wait for the response Fragment from  the server */
+        wStatus = phlnLlcp_Transport_Socket_Receive(pDataParams->plnLlcpDataParams, pLocSocket);
+        if (wStatus != PH_ERR_SUCCESS)
+        {
+            /* Set the Ready flag in Socket to True to receive next Packet and return with error. */
+            pLocSocket->fReady = true;
+            return wStatus;
+        }
+    }
+    else if ((wStatus & PH_ERR_MASK) != PH_ERR_SUCCESS_INFO_RECEIVED)
+    {
+        /* Return in case of any other error. */
+        return wStatus;
+    }
+
+    if (pLocSocket->dwLength < PHNP_SNEP_HEADER_SIZE)
+    {
+        pLocSocket->fReady = true;
+        return (PH_ERR_PROTOCOL_ERROR | PH_COMP_NP_SNEP);
+    }
+
+    /* Check server returned Excess data response. */
+    if (pLocSocket->pbRxBuffer[1] == PHNP_SNEP_RES_EXCESS_DATA)
+    {
+        pLocSocket->fReady = true;
+        return (PH_ERR_BUFFER_OVERFLOW | PH_COMP_NP_SNEP);
+    }
+
+    if (pLocSocket->pbRxBuffer[1] != PHNP_SNEP_RES_SUCCESS)
+    {
+        pLocSocket->fReady = true;
+        return (PH_ERR_SNEP_GET_FAILED | PH_COMP_NP_SNEP);
+    }
+
+    /* Extract Length Field in SUCCESS Response. */
+    dwLength = ((uint32_t)pLocSocket->pbRxBuffer[2] << 24) | ((uint32_t)pLocSocket->pbRxBuffer[3] << 16) |
+        ((uint32_t)pLocSocket->pbRxBuffer[4] << 8) | pLocSocket->pbRxBuffer[5];
+
+    if (dwLength > dwAcceptableLen)
+    {
+        pLocSocket->fReady = true;
+        return (PH_ERR_BUFFER_OVERFLOW | PH_COMP_NP_SNEP);
+    }
+
+    return phnpSnep_Sw_Int_ReceiveStream(pDataParams, (uint8_t)PHNP_SNEP_REQ_CONT, dwLength, pfRxCallback, pContext, pdwRxLen);
+}
+
+phStatus_t phnpSnep_Sw_ServerSendResponseStream(
+                                                phnpSnep_Sw_DataParams_t * pDataParams,
+                                                uint8_t bClientReq,
+                                                uint32_t dwRespDataLen,
+                                                pphnpSnep_TxReader_t pfReader,
+                                                void * pReaderContext,
+                                                uint32_t dwPutMaxLen,
+                                                pphnpSnep_RxCallback_t pfRxCallback,
+                                                void * pRxContext,
+                                                uint32_t *pdwPutDataLen
+                                                )
+{
+    phStatus_t                    PH_MEMLOC_REM wStatus;
+    uint32_t                      PH_MEMLOC_REM dwMsgLen;
+    phlnLlcp_Transport_Socket_t * PH_MEMLOC_REM pLocSocket;
+    uint8_t                       PH_MEMLOC_REM bClientRequest;
+    uint8_t                       PH_MEMLOC_REM bRxFlag;
+
+    bClientRequest = bClientReq;
+    pLocSocket = (phlnLlcp_Transport_Socket_t *)pDataParams->psSocket;
+
+    /* Check for Valid input parameters in case of GET. */
+    if ((bClientRequest == PHNP_SNEP_REQ_GET) && (pDataParams->eServerType == phnpSnep_NonDefault_Server))
+    {
+        if ((pfReader == NULL) || (dwRespDataLen == 0))
+        {
+            /* If the Input data is not provided then Not Found response will be sent. */
+            pLocSocket->fReady = true;
+            return phnpSnep_Sw_SendCmds(pDataParams, (uint8_t)PHNP_SNEP_RES_NOT_FOUND);
+        }
+    }
+
+    /* Check for Valid input parameters. pfRxCallback may be NULL for a server accepting GET requests only. */
+    if ((pfRxCallback != NULL) && (pdwPutDataLen == NULL))
+    {
+        return (PH_ERR_INVALID_PARAMETER | PH_COMP_NP_SNEP);
+    }
+
+    do
+    {
+        bRxFlag = 0;
+        switch (bClientRequest)
+        {
+        case PHNP_SNEP_REQ_PUT:
+            /* No PUT support without a callback, Not Implemented response will be sent. */
+            if (pfRxCallback == NULL)
+            {
+                pLocSocket->fReady = true;
+                return phnpSnep_Sw_SendCmds(pDataParams, (uint8_t)PHNP_SNEP_RES_NOT_IMP);
+            }
+
+            /* First SNEP Packet should contain entire SNEP Header. */
+            if (pLocSocket->dwLength < PHNP_SNEP_HEADER_SIZE)
+            {
+                /* Set the Ready flag in Socket to True to receive next Packet and return with error. */
+                pLocSocket->fReady = true;
+                return (PH_ERR_PROTOCOL_ERROR | PH_COMP_NP_SNEP);
+            }
+
+            /* Extract PUT Message Length. */
+            dwMsgLen = ((uint32_t)pLocSocket->pbRxBuffer[2] << 24) | ((uint32_t)pLocSocket->pbRxBuffer[3] << 16) |
+                ((uint32_t)pLocSocket->pbRxBuffer[4] << 8) | pLocSocket->pbRxBuffer[5];
+
+            /* If the received PUT Request Message length is more than acceptable then Reject Response will be sent. */
+            if (dwMsgLen > dwPutMaxLen)
+            {
+                /* Set the Ready flag in Socket to True to receive next Packet and return with error. */
+                pLocSocket->fReady = true;
+                PH_CHECK_SUCCESS_FCT(wStatus, phnpSnep_Sw_SendCmds(pDataParams, (uint8_t)PHNP_SNEP_RES_REJECT));
+                return (PH_ERR_BUFFER_OVERFLOW | PH_COMP_NP_SNEP);
+            }
+
+            wStatus = phnpSnep_Sw_Int_ReceiveStream(pDataParams, (uint8_t)PHNP_SNEP_RES_CONT, dwMsgLen,
+                pfRxCallback, pRxContext, pdwPutDataLen);
+            if (wStatus != PH_ERR_SUCCESS)
+            {
+                /* Set the Ready flag in Socket to True to receive next Packet and return with error. */
+                pLocSocket->fReady = true;
+                return wStatus;
+            }
+
+            wStatus = phnpSnep_Sw_SendCmds(pDataParams, (uint8_t)PHNP_SNEP_RES_SUCCESS);
+            if ((wStatus & PH_ERR_MASK) == PH_ERR_SUCCESS_INFO_RECEIVED)
+            {
+                bRxFlag = 1;
+                bClientRequest = pLocSocket->pbRxBuffer[1];
+            }
+            break;
+
+        case PHNP_SNEP_REQ_GET:
+            /* Extract the Acceptable Length of the Client. */
+            dwMsgLen = ((uint32_t)pLocSocket->pbRxBuffer[6] << 24) | ((uint32_t)pLocSocket->pbRxBuffer[7] << 16) |
+            ((uint32_t)pLocSocket->pbRxBuffer[8] << 8) | pLocSocket->pbRxBuffer[9];
+            pLocSocket->fReady = true;
+            if (dwMsgLen < dwRespDataLen)
+            {
+                wStatus = phnpSnep_Sw_SendCmds(pDataParams, (uint8_t)PHNP_SNEP_RES_EXCESS_DATA);
+            }
+            else
+            {
+                wStatus = phnpSnep_Sw_Int_SendStream(pDataParams, (uint8_t)PHNP_SNEP_RES_SUCCESS, (uint8_t)PHNP_SNEP_REQ_CONT,
+                    dwRespDataLen, pfReader, pReaderContext);
+            }
+            break;
+
+        default:
+            /* Set the Ready flag in Socket to True to receive next Packet and return with error. */
+            pLocSocket->fReady = true;
+            wStatus = (PH_ERR_INVALID_PARAMETER | PH_COMP_NP_SNEP);
+        }
+    } while (bRxFlag == 1);
+
+    return wStatus;
+}
+
 phStatus_t phnpSnep_Sw_SendCmds(
                                 phnpSnep_Sw_DataParams_t * pDataParams,
                                 uint8_t eReqResField
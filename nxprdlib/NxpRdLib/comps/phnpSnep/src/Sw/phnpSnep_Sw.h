@@ -123,6 +123,35 @@ phStatus_t phnpSnep_Sw_Put(
                            uint32_t dwTxBufferSize
                            );
 
+phStatus_t phnpSnep_Sw_PutStream(
+                                 phnpSnep_Sw_DataParams_t * pDataParams,
+                                 uint32_t dwMsgLen,
+                                 pphnpSnep_TxReader_t pfReader,
+                                 void * pContext
+                                 );
+
+phStatus_t phnpSnep_Sw_GetStream(
+                                 phnpSnep_Sw_DataParams_t * pDataParams,
+                                 uint8_t *pNdefMsg,
+                                 uint32_t dwNdefMsgLen,
+                                 uint32_t dwAcceptableLen,
+                                 pphnpSnep_RxCallback_t pfRxCallback,
+                                 void * pContext,
+                                 uint32_t *pdwRxLen
+                                 );
+
+phStatus_t phnpSnep_Sw_ServerSendResponseStream(
+                                                phnpSnep_Sw_DataParams_t * pDataParams,
+                                                uint8_t bClientReq,
+                                                uint32_t dwRespDataLen,
+                                                pphnpSnep_TxReader_t pfReader,
+                                                void * pReaderContext,
+                                                uint32_t dwPutMaxLen,
+                                                pphnpSnep_RxCallback_t pfRxCallback,
+                                                void * pRxContext,
+                                                uint32_t *pdwPutDataLen
+                                                );
+
 phStatus_t phnpSnep_Sw_SendCmds(
                                 phnpSnep_Sw_DataParams_t * pDataParams,
                                 uint8_t eReqResField
@@ -343,6 +343,158 @@ phStatus_t phnpSnep_ServerSendResponse(
     return status ;
 }
 
+phStatus_t phnpSnep_PutStream(
+                              void * pDataParams,
+                              uint32_t dwMsgLen,
+                              pphnpSnep_TxReader_t pfReader,
+                              void * pContext
+                              )
+{
+    phStatus_t status = PH_ERR_SUCCESS;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phnpSnep_PutStream");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_NP_SNEP)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_NP_SNEP);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+        return status;
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHNP_SNEP_SW
+    case PHNP_SNEP_SW_ID:
+        status = phnpSnep_Sw_PutStream((phnpSnep_Sw_DataParams_t *) pDataParams, dwMsgLen, pfReader, pContext);
+        break;
+#endif /* NXPBUILD__PHNP_SNEP_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_NP_SNEP);
+        break;
+    }
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status ;
+}
+
+phStatus_t phnpSnep_GetStream(
+                              void * pDataParams,
+                              uint8_t *pNdefMsg,
+                              uint32_t dwNdefMsgLen,
+                              uint32_t dwAcceptableLen,
+                              pphnpSnep_RxCallback_t pfRxCallback,
+                              void * pContext,
+                              uint32_t *pdwRxLen
+                              )
+{
+    phStatus_t status = PH_ERR_SUCCESS;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phnpSnep_GetStream");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pNdefMsg);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pNdefMsg_log, pNdefMsg, dwNdefMsgLen);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_NP_SNEP)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_NP_SNEP);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+        return status;
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHNP_SNEP_SW
+    case PHNP_SNEP_SW_ID:
+        status = phnpSnep_Sw_GetStream((phnpSnep_Sw_DataParams_t *) pDataParams, pNdefMsg, dwNdefMsgLen, dwAcceptableLen,
+            pfRxCallback, pContext, pdwRxLen);
+        break;
+#endif /* NXPBUILD__PHNP_SNEP_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_NP_SNEP);
+        break;
+    }
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status ;
+}
+
+phStatus_t phnpSnep_ServerSendResponseStream(
+                                             void * pDataParams,
+                                             uint8_t bClientReq,
+                                             uint32_t dwRespDataLen,
+                                             pphnpSnep_TxReader_t pfReader,
+                                             void * pReaderContext,
+                                             uint32_t dwPutMaxLen,
+                                             pphnpSnep_RxCallback_t pfRxCallback,
+                                             void * pRxContext,
+                                             uint32_t *pdwPutDataLen
+                                             )
+{
+    phStatus_t status = PH_ERR_SUCCESS;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phnpSnep_ServerSendResponseStream");
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bClientReq);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bClientReq_log, &bClientReq);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_NP_SNEP)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_NP_SNEP);
+
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+        return status;
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHNP_SNEP_SW
+    case PHNP_SNEP_SW_ID:
+        status = phnpSnep_Sw_ServerSendResponseStream((phnpSnep_Sw_DataParams_t *) pDataParams, bClientReq, dwRespDataLen,
+            pfReader, pReaderContext, dwPutMaxLen, pfRxCallback, pRxContext, pdwPutDataLen);
+        break;
+#endif /* NXPBUILD__PHNP_SNEP_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_NP_SNEP);
+        break;
+    }
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status ;
+}
+
 phStatus_t phnpSnep_ClientDeInit(
                                  void * pDataParams
                                  )
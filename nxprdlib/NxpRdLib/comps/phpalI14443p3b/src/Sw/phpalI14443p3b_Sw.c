@@ -483,6 +483,22 @@ phStatus_t phpalI14443p3b_Sw_Attrib(
     pDataParams->bNadSupported = (pAtqb[11] & 0x02) >> 1;
     pDataParams->bCid = pResp[0] & 0x0F;
     pDataParams->bFsci = (uint8_t)(pAtqb[10] >> 4);
+
+    /* FSCI above 4096 bytes is RFU and interpreted as 4096 bytes (ISO/IEC 14443-3:2016) */
+    if (pDataParams->bOpeMode == RD_LIB_MODE_ISO)
+    {
+        if (pDataParams->bFsci > PHPAL_I14443P3B_FRAMESIZE_MAX)
+        {
+            pDataParams->bFsci = PHPAL_I14443P3B_FRAMESIZE_MAX;
+        }
+    }
+    else
+    {
+        if (pDataParams->bFsci > PHPAL_I14443P3B_EMVCO_FRAMESIZE_MAX)
+        {
+            pDataParams->bFsci = PHPAL_I14443P3B_EMVCO_FRAMESIZE_MAX;
+        }
+    }
     pDataParams->bFsdi = bFsdi;
     pDataParams->bDri = bDri;
     pDataParams->bDsi = bDsi;
@@ -136,6 +136,7 @@ phStatus_t phpalI14443p4_Sw_Init(
     pDataParams->wId            = PH_COMP_PAL_ISO14443P4 | PHPAL_I14443P4_SW_ID;
     pDataParams->pHalDataParams = pHalDataParams;
     pDataParams->bOpeMode       = RD_LIB_MODE_NFC;
+    pDataParams->bIntegrityErrors = 0;
 
     /* Reset protocol to defaults */
     return phpalI14443p4_Sw_ResetProtocol(pDataParams);
@@ -408,6 +409,12 @@ phStatus_t phpalI14443p4_Sw_Exchange(
     wMaxPcdFrameSize = bI14443p4_FsTable[pDataParams->bFsdi];
     wMaxCardFrameSize = bI14443p4_FsTable[pDataParams->bFsci]-2;
 
+    /* Extended frame sizes may exceed the HAL TxBuffer, chain within its size */
+    if (wMaxCardFrameSize > wTxBufferSize)
+    {
+        wMaxCardFrameSize = wTxBufferSize;
+    }
+
     /* R(ACK) transmission in case of Rx-Chaining */
     if (((wOption & PH_EXCHANGE_MODE_MASK) == PH_EXCHANGE_RXCHAINING) ||
         ((wOption & PH_EXCHANGE_MODE_MASK) == PH_EXCHANGE_RXCHAINING_BUFSIZE))
@@ -723,6 +730,9 @@ phStatus_t phpalI14443p4_Sw_Exchange(
     /* Reset RxStartPos */
     wRxStartPos = 0;
 
+    /* R(ACK) frame is built for the first chained block only */
+    wIsoFrameLen = 0;
+
     /* ******************************** */
     /*      I-BLOCK RECEPTION LOOP      */
     /* ******************************** */
@@ -778,14 +788,22 @@ phStatus_t phpalI14443p4_Sw_Exchange(
                 PHHAL_HW_CONFIG_RXBUFFER_STARTPOS,
                 wRxStartPos));
 
-            /* Prepare R(ACK) frame */
-            PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_Sw_BuildRBlock(
-                pDataParams->bCidEnabled,
-                pDataParams->bCid,
-                pDataParams->bPcbBlockNum,
-                1,
-                bIsoFrame,
-                &wIsoFrameLen));
+            if (wIsoFrameLen == 0)
+            {
+                /* Prepare R(ACK) frame */
+                PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_Sw_BuildRBlock(
+                    pDataParams->bCidEnabled,
+                    pDataParams->bCid,
+                    pDataParams->bPcbBlockNum,
+                    1,
+                    bIsoFrame,
+                    &wIsoFrameLen));
+            }
+            else
+            {
+                /* Only the block number alternates between chained blocks */
+                bIsoFrame[PHPAL_I14443P4_SW_PCB_POS] = (uint8_t)((bIsoFrame[PHPAL_I14443P4_SW_PCB_POS] & (uint8_t)~(uint8_t)PHPAL_I14443P4_SW_PCB_BLOCKNR) | pDataParams->bPcbBlockNum);
+            }
 
             /* Perform Exchange using complete ISO handling */
             status = phpalI14443p4_Sw_IsoHandling(
@@ -961,6 +979,12 @@ phStatus_t phpalI14443p4_Sw_IsoHandling(
             pRxLength);
         statusBkUp = status;
 
+        /* Count integrity errors, used for data rate fall back */
+        if (((status & PH_ERR_MASK) == PH_ERR_INTEGRITY_ERROR) && (pDataParams->bIntegrityErrors < 0xFF))
+        {
+            pDataParams->bIntegrityErrors++;
+        }
+
         /* Reset Exchange Option */
         wOption = PH_EXCHANGE_DEFAULT;
 
@@ -1735,6 +1759,13 @@ phStatus_t phpalI14443p4_Sw_SetConfig(
                 return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PAL_ISO14443P4);
             }
 
+            /* Extended frame sizes (FSDI above 8) are only defined by ISO/IEC 14443-4:2016 */
+            if ((pDataParams->bOpeMode != RD_LIB_MODE_ISO) &&
+                ((wValue >> 8) > PHPAL_I14443P4_EMVCO_FRAMESIZE_MAX))
+            {
+                return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PAL_ISO14443P4);
+            }
+
             pDataParams->bFsdi = (uint8_t)(wValue >> 8);
             pDataParams->bFsci = (uint8_t)(wValue);
             break;
@@ -1744,6 +1775,15 @@ phStatus_t phpalI14443p4_Sw_SetConfig(
             pDataParams->bMaxRetryCount = (uint8_t)(wValue);
             break;
         }
+    case PHPAL_I14443P4_CONFIG_INTEGRITY_ERRORS:
+        {
+            if (wValue > 0xFF)
+            {
+                return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PAL_ISO14443P4);
+            }
+            pDataParams->bIntegrityErrors = (uint8_t)(wValue);
+            break;
+        }
     default:
         {
             return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_PAL_ISO14443P4);
@@ -1816,6 +1856,11 @@ phStatus_t phpalI14443p4_Sw_GetConfig(
             *pValue = (uint16_t)pDataParams->bMaxRetryCount;
             break;
         }
+    case PHPAL_I14443P4_CONFIG_INTEGRITY_ERRORS:
+        {
+            *pValue = (uint16_t)pDataParams->bIntegrityErrors;
+            break;
+        }
     default:
         {
             return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_PAL_ISO14443P4);
@@ -68,6 +68,9 @@ phStatus_t phpalI14443p4mC_Sw_Init(
     pDataParams->wWtDelta           = 0;
     /* Default percentage of actual time to be used in WTX timer is set to 75% */
     pDataParams->bWtPercentage      = 75;
+    /* Adaptive WTX is disabled by default, processing time not yet known */
+    pDataParams->bAdaptiveWtx       = PH_OFF;
+    pDataParams->dwProcTimeUs       = 0;
 
     /* Reset protocol to defaults */
     return phpalI14443p4mC_Sw_ResetProtocol(pDataParams);
@@ -98,6 +101,10 @@ phStatus_t phpalI14443p4mC_Sw_ResetProtocol(
     pDataParams->bNadEnable       = PH_OFF;
     pDataParams->bCidPresence     = false;
     pDataParams->bNadPresence     = false;
+    pDataParams->bWtxm            = pDataParams->bWtx;
+    pDataParams->bProcTiming      = PH_OFF;
+    pDataParams->dwWtxTimerUs     = 0;
+    pDataParams->dwProcElapsedUs  = 0;
 
 #ifdef NXPBUILD__PH_PLATFORM
     if((pDataParams->pPlatform != NULL ) &&(pDataParams->dwTimerId != PH_PLATFORM_INVALID_TIMER_ID))
@@ -664,6 +671,12 @@ phStatus_t phpalI14443p4mC_Sw_Transmit(
         /* Stop WTX Timer */
         if((!pDataParams->bDisableWtx) && (pDataParams->dwTimerId != PH_PLATFORM_INVALID_TIMER_ID))
         {
+            /* Measure processing time of the command being answered */
+            if(pDataParams->bAdaptiveWtx && pDataParams->bProcTiming)
+            {
+                PH_CHECK_SUCCESS_FCT(status, phpalI14443p4mC_Sw_Int_UpdateProcTime(pDataParams));
+            }
+
             PH_CHECK_SUCCESS_FCT(status, phPlatform_Timer_Stop(pDataParams->pPlatform, pDataParams->dwTimerId));
             PH_CHECK_SUCCESS_FCT(status, phPlatform_Timer_Reset(pDataParams->pPlatform, pDataParams->dwTimerId));
         }
@@ -941,7 +954,12 @@ phStatus_t phpalI14443p4mC_Sw_Wtx(
         aCmd[1] = pDataParams->bCid;
         wWtxReqLength++;
     }
-    aCmd[wWtxReqLength - 1] = pDataParams->bWtx;
+    /* WTXM is chosen by the WTX timer when adaptive WTX is enabled */
+    if(!pDataParams->bAdaptiveWtx)
+    {
+        pDataParams->bWtxm = pDataParams->bWtx;
+    }
+    aCmd[wWtxReqLength - 1] = pDataParams->bWtxm;
 
     /* Backup TX length (needed in case of error, to re-send) */
     pDataParams->wLastTxLen = wWtxReqLength;
@@ -956,6 +974,12 @@ phStatus_t phpalI14443p4mC_Sw_Wtx(
     /* Update state */
     pDataParams->bStateNow = PHPAL_I14443P4MC_STATE_WTX;
 
+    /* Account the time spent till this WTX to the command being processed */
+    if(pDataParams->bProcTiming)
+    {
+        pDataParams->dwProcElapsedUs += pDataParams->dwWtxTimerUs;
+    }
+
     /* Receive WTX response */
     PH_CHECK_SUCCESS_FCT(status, phpalI14443p4mC_Sw_Receive(
         pDataParams,
@@ -1021,6 +1045,15 @@ phStatus_t phpalI14443p4mC_Sw_SetConfig(
         pDataParams->wWtDelta = wValue;
         break;
 
+    case PHPAL_I14443P4MC_CONFIG_ADAPTIVE_WTX:
+        if((wValue != PH_ON) && (wValue != PH_OFF))
+        {
+            return (PH_ERR_INVALID_PARAMETER | PH_COMP_PAL_I14443P4MC);
+        }
+        pDataParams->bAdaptiveWtx = (uint8_t)(wValue);
+        pDataParams->bProcTiming = PH_OFF;
+        break;
+
     default:
         return (PH_ERR_UNSUPPORTED_PARAMETER | PH_COMP_PAL_I14443P4MC);
     }
@@ -1072,6 +1105,10 @@ phStatus_t phpalI14443p4mC_Sw_GetConfig(
         *pValue = (uint16_t)(pDataParams->bNadPresence);
         break;
 
+    case PHPAL_I14443P4MC_CONFIG_ADAPTIVE_WTX:
+        *pValue = (uint16_t)(pDataParams->bAdaptiveWtx);
+        break;
+
     default:
         return (PH_ERR_UNSUPPORTED_PARAMETER | PH_COMP_PAL_I14443P4MC);
     }
@@ -237,6 +237,10 @@ phStatus_t phpalI14443p4mC_Sw_Int_StartWtxTimer(
                                                 )
 {
     phStatus_t PH_MEMLOC_REM status;
+    uint32_t   PH_MEMLOC_REM dwFwtUs;
+    uint32_t   PH_MEMLOC_REM dwWaitUs;
+    uint32_t   PH_MEMLOC_REM dwRemainUs;
+    uint8_t    PH_MEMLOC_REM bMultiplier;
 
     /* If timer is not yet created, create timer */
     if(pDataParams->dwTimerId == PH_PLATFORM_INVALID_TIMER_ID)
@@ -254,13 +258,72 @@ phStatus_t phpalI14443p4mC_Sw_Int_StartWtxTimer(
             pDataParams->pPlatform,
             pDataParams->dwTimerId));
 
+        if(!pDataParams->bAdaptiveWtx)
+        {
+            pDataParams->bWtxm = pDataParams->bWtx;
+            dwWaitUs = (uint32_t)(((pDataParams->bWtPercentage
+                * (PHPAL_I14443P4MC_SW_CALCULATE_FWT_US(pDataParams->bFwi))
+                * pDataParams->bWtx) / 100) - pDataParams->wWtDelta);
+        }
+        else
+        {
+            /* Usable part of FWT */
+            dwFwtUs = (PHPAL_I14443P4MC_SW_CALCULATE_FWT_US(pDataParams->bFwi)
+                * pDataParams->bWtPercentage) / 100;
+
+            if(pDataParams->bStateNow != PHPAL_I14443P4MC_STATE_TX_I)
+            {
+                /* RX chaining, processing is measured from the last block */
+                pDataParams->bProcTiming = PH_OFF;
+                bMultiplier = 1;
+            }
+            else if(pDataParams->bProcTiming == PH_OFF)
+            {
+                /* New command, reader waits FWT for the response */
+                pDataParams->bProcTiming = PH_ON;
+                pDataParams->dwProcElapsedUs = 0;
+                bMultiplier = 1;
+            }
+            else
+            {
+                /* WTX acknowledged, reader waits FWT * WTXM */
+                bMultiplier = pDataParams->bWtxm;
+            }
+
+            dwWaitUs = dwFwtUs * bMultiplier;
+            if(dwWaitUs > pDataParams->wWtDelta)
+            {
+                dwWaitUs -= pDataParams->wWtDelta;
+            }
+            pDataParams->bWtxm = pDataParams->bWtx;
+
+            /* Request WTX right away, if the response is expected to be late */
+            if((pDataParams->bProcTiming == PH_ON)
+                && (pDataParams->dwProcTimeUs > (pDataParams->dwProcElapsedUs + dwWaitUs)))
+            {
+                dwRemainUs = pDataParams->dwProcTimeUs - pDataParams->dwProcElapsedUs;
+                dwRemainUs = (dwRemainUs + dwFwtUs - 1) / dwFwtUs;
+
+                pDataParams->bWtxm = (uint8_t)((dwRemainUs > PHPAL_I14443P4MC_SW_MAX_WTX_VALUE)?
+                    PHPAL_I14443P4MC_SW_MAX_WTX_VALUE : dwRemainUs);
+                if(pDataParams->bWtxm < PHPAL_I14443P4MC_SW_MIN_WTX_VALUE)
+                {
+                    pDataParams->bWtxm = PHPAL_I14443P4MC_SW_MIN_WTX_VALUE;
+                }
+
+                if(dwWaitUs > PHPAL_I14443P4MC_SW_ADAPTIVE_WTX_DELAY_US)
+                {
+                    dwWaitUs = PHPAL_I14443P4MC_SW_ADAPTIVE_WTX_DELAY_US;
+                }
+            }
+        }
+        pDataParams->dwWtxTimerUs = dwWaitUs;
+
         /* Start Timer */
         PH_CHECK_SUCCESS_FCT(status, phPlatform_Timer_Start(
             pDataParams->pPlatform,
             pDataParams->dwTimerId,
-            (uint32_t)(((pDataParams->bWtPercentage
-               * (PHPAL_I14443P4MC_SW_CALCULATE_FWT_US(pDataParams->bFwi))
-               * pDataParams->bWtx) / 100) - pDataParams->wWtDelta),
+            dwWaitUs,
             PH_PLATFORM_TIMER_UNIT_US,
             (ppCallBck_t)(pDataParams->pWtxTimerCallback),
             (void *)pDataParams));
@@ -268,6 +331,37 @@ phStatus_t phpalI14443p4mC_Sw_Int_StartWtxTimer(
 
     return PH_ERR_SUCCESS;
 }
+
+phStatus_t phpalI14443p4mC_Sw_Int_UpdateProcTime(
+                                                 phpalI14443p4mC_Sw_DataParams_t * pDataParams
+                                                 )
+{
+    phStatus_t PH_MEMLOC_REM status;
+    uint32_t   PH_MEMLOC_REM dwElapsedUs;
+
+    PH_CHECK_SUCCESS_FCT(status, phPlatform_Timer_GetElapsedDelay(
+        pDataParams->pPlatform,
+        pDataParams->dwTimerId,
+        PH_PLATFORM_TIMER_UNIT_US,
+        &dwElapsedUs));
+
+    dwElapsedUs += pDataParams->dwProcElapsedUs;
+
+    /* Follow increase immediately, decay slowly (1/8 per command) */
+    if(dwElapsedUs > pDataParams->dwProcTimeUs)
+    {
+        pDataParams->dwProcTimeUs = dwElapsedUs;
+    }
+    else
+    {
+        pDataParams->dwProcTimeUs -= (pDataParams->dwProcTimeUs - dwElapsedUs) >> 3;
+    }
+
+    pDataParams->bProcTiming = PH_OFF;
+    pDataParams->dwProcElapsedUs = 0;
+
+    return PH_ERR_SUCCESS;
+}
 #endif /* NXPBUILD__PH_PLATFORM */
 
 phStatus_t phpalI14443p4mC_Sw_Int_HandleRxChaining(
@@ -726,7 +820,7 @@ phStatus_t phpalI14443p4mC_Sw_Int_ValidateFrame(
             pDataParams->bOpMode,
             pDataParams->bCidPresence,
             pDataParams->bCid,
-            pDataParams->bWtx,
+            pDataParams->bWtxm,
             pRxBuffer,
             wRxLength));
 
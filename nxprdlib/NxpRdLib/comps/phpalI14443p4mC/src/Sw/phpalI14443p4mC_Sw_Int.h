@@ -158,6 +158,9 @@
 /** WTX min value */
 #define PHPAL_I14443P4MC_SW_MIN_WTX_VALUE         0x01U
 
+/** Delay in microseconds after which WTX is requested when processing is expected to exceed FWT */
+#define PHPAL_I14443P4MC_SW_ADAPTIVE_WTX_DELAY_US 1000U
+
 /** Minimum response waiting time, ISO/IEC 14443-4:2008 section 7.2 */
 #define PHPAL_I14443P4MC_SW_FWT_MIN_US            302U
 
@@ -298,6 +301,18 @@ phStatus_t phpalI14443p4mC_Sw_Int_HandleRxChaining(
 phStatus_t phpalI14443p4mC_Sw_Int_StartWtxTimer(
     phpalI14443p4mC_Sw_DataParams_t * pDataParams       /**< [In] Pointer to this layer's parameter structure */
     );
+
+/**
+* \brief Function to update the estimated command processing time used by
+* adaptive WTX, from the running WTX timer.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other errors depends on lower layers.
+*/
+phStatus_t phpalI14443p4mC_Sw_Int_UpdateProcTime(
+    phpalI14443p4mC_Sw_DataParams_t * pDataParams       /**< [In] Pointer to this layer's parameter structure */
+    );
 #endif /* NXPBUILD__PH_PLATFORM */
 
 #endif /* PHPALI14443P4MC_INT_H */
@@ -0,0 +1,127 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic Random Number Generator Component of Reader Library Framework.
+*
+*/
+
+#ifndef PHCRYPTORNG_H
+#define PHCRYPTORNG_H
+
+#include <ph_Status.h>
+#include <phCryptoSym.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#ifdef NXPBUILD__PH_CRYPTORNG_SW
+
+/** \defgroup phCryptoRng_Sw Component : Software
+* \brief Software implementation of a deterministic random bit generator.
+*
+* CTR_DRBG with AES-128 and without derivation function as per NIST SP 800-90A, built on a
+* dedicated symmetric crypto component. The generator has to be seeded with entropy from the
+* platform before random numbers can be drawn.
+* @{
+*/
+
+#define PH_CRYPTORNG_SW_ID              0x01U   /**< ID for Software RNG component. */
+#define PH_CRYPTORNG_SW_SEED_LENGTH     32U     /**< Seed length of the generator (key length + block size). */
+
+/**
+* \brief Software parameter structure
+*/
+typedef struct
+{
+    uint16_t wId;                                   /**< Layer ID for this component, NEVER MODIFY! */
+    void * pCryptoDataParams;                       /**< Pointer to the crypto layer used by the generator, exclusive to this component. */
+    uint8_t aKey[PH_CRYPTOSYM_AES_BLOCK_SIZE];      /**< Working state Key. */
+    uint8_t aV[PH_CRYPTOSYM_AES_BLOCK_SIZE];        /**< Working state V. */
+    uint8_t bState;                                 /**< #PH_ON once the generator is seeded. */
+} phCryptoRng_Sw_DataParams_t;
+
+/**
+* \brief Initialise the random number generator component.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phCryptoRng_Sw_Init(
+                               phCryptoRng_Sw_DataParams_t * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                               uint16_t wSizeOfDataParams,                  /**< [In] Specifies the size of the data parameter structure. */
+                               void * pCryptoDataParams                     /**< [In] Pointer to a symmetric crypto structure. */
+                               );
+
+/** @} */
+#endif /* NXPBUILD__PH_CRYPTORNG_SW */
+
+
+
+#ifdef NXPBUILD__PH_CRYPTORNG
+
+/** \defgroup phCryptoRng CryptoRng
+*
+* \brief This is only a wrapper layer to abstract the different random number generator implementations.
+* @{
+*/
+
+#ifdef NXPRDLIB_REM_GEN_INTFS
+#include "../comps/phCryptoRng/src/Sw/phCryptoRng_Sw.h"
+
+#define phCryptoRng_Seed(pDataParams, pSeed, bSeedLength) \
+        phCryptoRng_Sw_Seed((phCryptoRng_Sw_DataParams_t *)pDataParams, pSeed, bSeedLength)
+
+#define phCryptoRng_Rnd(pDataParams, wNoOfRndBytes, pRnd) \
+        phCryptoRng_Sw_Rnd((phCryptoRng_Sw_DataParams_t *)pDataParams, wNoOfRndBytes, pRnd)
+
+#else
+
+/**
+* \brief Seed the random number generator.
+*
+* The first call instantiates the generator, further calls reseed it. Seeds of any length are
+* accepted and mixed in portions of #PH_CRYPTORNG_SW_SEED_LENGTH bytes; the seed should contain
+* at least 32 bytes of entropy.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phCryptoRng_Seed(
+                            void * pDataParams,     /**< [In] Pointer to this layer's parameter structure. */
+                            const uint8_t * pSeed,  /**< [In] Seed. */
+                            uint8_t bSeedLength     /**< [In] Length of the seed. */
+                            );
+
+/**
+* \brief Draw random bytes.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_USE_CONDITION The generator is not seeded.
+*/
+phStatus_t phCryptoRng_Rnd(
+                           void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+                           uint16_t wNoOfRndBytes,  /**< [In] Number of random bytes to generate. */
+                           uint8_t * pRnd           /**< [Out] Random bytes. */
+                           );
+
+#endif /* NXPRDLIB_REM_GEN_INTFS */
+
+/** @} */
+#endif /* NXPBUILD__PH_CRYPTORNG */
+
+#ifdef __cplusplus
+} /* Extern C */
+#endif
+
+#endif /* PHCRYPTORNG_H */
@@ -0,0 +1,325 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic Symmetric Cryptography Component of Reader Library Framework.
+*
+*/
+
+#ifndef PHCRYPTOSYM_H
+#define PHCRYPTOSYM_H
+
+#include <ph_Status.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+
+/** \defgroup phCryptoSym_Sw Component : Software
+* \brief Software implementation of the symmetric crypto primitives.
+*
+* AES block operations use the AES-NI instructions (x86, detected at run time) or the ARMv8
+* crypto extension (when the tool chain targets it). Otherwise, and for DES, a constant-time
+* implementation without secret dependent table lookups or branches is used.
+* @{
+*/
+
+#define PH_CRYPTOSYM_SW_ID                  0x01U   /**< ID for Software crypto component. */
+#define PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE      16U     /**< Maximum block size of the supported ciphers. */
+#define PH_CRYPTOSYM_SW_MAX_KEY_SIZE        32U     /**< Maximum size of a key. */
+#define PH_CRYPTOSYM_SW_KEY_SCHEDULE_SIZE   384U    /**< Size of the expanded key, 3 x 16 DES sub keys of 8 x 6 bits (AES-256 needs 240). */
+
+/**
+* \brief Software parameter structure
+*/
+typedef struct
+{
+    uint16_t wId;                                               /**< Layer ID for this component, NEVER MODIFY! */
+    void * pKeyStoreDataParams;                                 /**< Pointer to the parameter structure of the KeyStore layer. */
+    uint8_t pKeySchedule[PH_CRYPTOSYM_SW_KEY_SCHEDULE_SIZE];    /**< Expanded key, AES round keys or DES sub keys. */
+    uint8_t pIV[PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE];                /**< Initialisation vector, carries the CBC chaining value. */
+    uint8_t pCMACSubKey1[PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE];       /**< CMAC sub key K1. */
+    uint8_t pCMACSubKey2[PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE];       /**< CMAC sub key K2. */
+    uint8_t pCMACBuffer[PH_CRYPTOSYM_SW_MAX_BLOCK_SIZE];        /**< Pending MAC input of a buffered MAC calculation. */
+    uint8_t bCMACBufferLength;                                  /**< Number of bytes in pCMACBuffer. */
+    uint8_t bCMACSubKeysInitialized;                            /**< Indicates whether the CMAC sub keys are derived from the loaded key. */
+    uint16_t wKeyType;                                          /**< Type of the loaded key, #PH_CRYPTOSYM_KEY_TYPE_INVALID if none. */
+    uint16_t wKeepIV;                                           /**< Keep the IV after a completed operation, see #PH_CRYPTOSYM_CONFIG_KEEP_IV. */
+    uint8_t bRounds;                                            /**< Number of AES rounds of the loaded key. */
+    uint8_t bHwAcceleration;                                    /**< AES block operations use the CPU crypto instructions. */
+} phCryptoSym_Sw_DataParams_t;
+
+/**
+* \brief Initialise the crypto component.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phCryptoSym_Sw_Init(
+                               phCryptoSym_Sw_DataParams_t * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                               uint16_t wSizeOfDataParams,                  /**< [In] Specifies the size of the data parameter structure. */
+                               void * pKeyStoreDataParams                   /**< [In] Pointer to a key store structure (can be null). */
+                               );
+
+/** @} */
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
+
+
+
+#ifdef NXPBUILD__PH_CRYPTOSYM
+
+/** \defgroup phCryptoSym CryptoSym
+*
+* \brief This is only a wrapper layer to abstract the different symmetric crypto implementations.
+*
+* The IV holds the CBC chaining value of Encrypt, Decrypt and CalculateMac. Buffered calls
+* (#PH_EXCHANGE_BUFFER_FIRST, #PH_EXCHANGE_BUFFER_CONT) always continue from it. A completed
+* call (#PH_EXCHANGE_DEFAULT, #PH_EXCHANGE_BUFFER_LAST) keeps the last cipher block (or the MAC)
+* as IV if #PH_CRYPTOSYM_CONFIG_KEEP_IV is set, otherwise the IV is reset to zero.
+* @{
+*/
+
+/**
+* \name Key Types
+*/
+/*@{*/
+#define PH_CRYPTOSYM_KEY_TYPE_AES128    0x0000U     /**< AES 128 Key [16 Bytes]. */
+#define PH_CRYPTOSYM_KEY_TYPE_AES192    0x0001U     /**< AES 192 Key [24 Bytes]. */
+#define PH_CRYPTOSYM_KEY_TYPE_AES256    0x0002U     /**< AES 256 Key [32 Bytes]. */
+#define PH_CRYPTOSYM_KEY_TYPE_DES       0x0003U     /**< DES Single Key [8 Bytes]. */
+#define PH_CRYPTOSYM_KEY_TYPE_2K3DES    0x0004U     /**< 2 Key Triple Des [16 Bytes]. */
+#define PH_CRYPTOSYM_KEY_TYPE_3K3DES    0x0005U     /**< 3 Key Triple Des [24 Bytes]. */
+#define PH_CRYPTOSYM_KEY_TYPE_INVALID   0xFFFFU     /**< No key loaded. */
+/*@}*/
+
+/**
+* \name Block Sizes
+*/
+/*@{*/
+#define PH_CRYPTOSYM_AES_BLOCK_SIZE     16U     /**< Block size of AES. */
+#define PH_CRYPTOSYM_DES_BLOCK_SIZE     8U      /**< Block size of DES and triple DES. */
+/*@}*/
+
+/**
+* \name Cipher Modes
+* Combined with the PH_EXCHANGE_BUFFER_* options in the wOption parameter of Encrypt and Decrypt.
+*/
+/*@{*/
+#define PH_CRYPTOSYM_CIPHER_MODE_ECB    0x0000U     /**< Electronic code book. */
+#define PH_CRYPTOSYM_CIPHER_MODE_CBC    0x0001U     /**< Cipher block chaining. */
+#define PH_CRYPTOSYM_CIPHER_MODE_MASK   0x00FFU     /**< Mask for the cipher or MAC mode in wOption. */
+/*@}*/
+
+/**
+* \name MAC Modes
+* Combined with the PH_EXCHANGE_BUFFER_* options in the wOption parameter of CalculateMac.
+*/
+/*@{*/
+#define PH_CRYPTOSYM_MAC_MODE_CBCMAC    0x0000U     /**< CBC-MAC, the last block is zero padded. */
+#define PH_CRYPTOSYM_MAC_MODE_CMAC      0x0001U     /**< CMAC as per NIST SP 800-38B. */
+/*@}*/
+
+/**
+* \name Configuration
+*/
+/*@{*/
+#define PH_CRYPTOSYM_CONFIG_KEY_TYPE            0x0000U     /**< Type of the loaded key (read only). */
+#define PH_CRYPTOSYM_CONFIG_KEY_SIZE            0x0001U     /**< Size of the loaded key (read only). */
+#define PH_CRYPTOSYM_CONFIG_BLOCK_SIZE          0x0002U     /**< Block size of the loaded key (read only). */
+#define PH_CRYPTOSYM_CONFIG_KEEP_IV             0x0003U     /**< #PH_CRYPTOSYM_VALUE_KEEP_IV_ON keeps the IV after completed operations. */
+#define PH_CRYPTOSYM_CONFIG_HW_ACCELERATION     0x0004U     /**< #PH_ON if AES uses the CPU crypto instructions; set #PH_OFF to force the software path. */
+/*@}*/
+
+/**
+* \name Configuration Values
+*/
+/*@{*/
+#define PH_CRYPTOSYM_VALUE_KEEP_IV_OFF  0x0000U     /**< IV is reset to zero after each completed operation. */
+#define PH_CRYPTOSYM_VALUE_KEEP_IV_ON   0x0001U     /**< IV is kept after each completed operation. */
+/*@}*/
+
+#ifdef NXPRDLIB_REM_GEN_INTFS
+#include "../comps/phCryptoSym/src/Sw/phCryptoSym_Sw.h"
+
+#define phCryptoSym_InvalidateKey(pDataParams) \
+        phCryptoSym_Sw_InvalidateKey((phCryptoSym_Sw_DataParams_t *)pDataParams)
+
+#define phCryptoSym_Encrypt(pDataParams, wOption, pPlainBuffer, wBufferLength, pEncryptedBuffer) \
+        phCryptoSym_Sw_Encrypt((phCryptoSym_Sw_DataParams_t *)pDataParams, wOption, pPlainBuffer, wBufferLength, pEncryptedBuffer)
+
+#define phCryptoSym_Decrypt(pDataParams, wOption, pEncryptedBuffer, wBufferLength, pPlainBuffer) \
+        phCryptoSym_Sw_Decrypt((phCryptoSym_Sw_DataParams_t *)pDataParams, wOption, pEncryptedBuffer, wBufferLength, pPlainBuffer)
+
+#define phCryptoSym_CalculateMac(pDataParams, wOption, pData, wDataLength, pMac, pMacLength) \
+        phCryptoSym_Sw_CalculateMac((phCryptoSym_Sw_DataParams_t *)pDataParams, wOption, pData, wDataLength, pMac, pMacLength)
+
+#define phCryptoSym_LoadIv(pDataParams, pIV, bIVLength) \
+        phCryptoSym_Sw_LoadIv((phCryptoSym_Sw_DataParams_t *)pDataParams, pIV, bIVLength)
+
+#define phCryptoSym_LoadKey(pDataParams, wKeyNo, wKeyVersion, wKeyType) \
+        phCryptoSym_Sw_LoadKey((phCryptoSym_Sw_DataParams_t *)pDataParams, wKeyNo, wKeyVersion, wKeyType)
+
+#define phCryptoSym_LoadKeyDirect(pDataParams, pKey, wKeyType) \
+        phCryptoSym_Sw_LoadKeyDirect((phCryptoSym_Sw_DataParams_t *)pDataParams, pKey, wKeyType)
+
+#define phCryptoSym_SetConfig(pDataParams, wConfig, wValue) \
+        phCryptoSym_Sw_SetConfig((phCryptoSym_Sw_DataParams_t *)pDataParams, wConfig, wValue)
+
+#define phCryptoSym_GetConfig(pDataParams, wConfig, pValue) \
+        phCryptoSym_Sw_GetConfig((phCryptoSym_Sw_DataParams_t *)pDataParams, wConfig, pValue)
+
+#else
+
+/**
+* \brief Invalidate the currently loaded key.
+*
+* The key schedule, IV and CMAC state are cleared.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phCryptoSym_InvalidateKey(
+                                     void * pDataParams     /**< [In] Pointer to this layer's parameter structure. */
+                                     );
+
+/**
+* \brief Encrypt data with the loaded key.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER wBufferLength is not a multiple of the block size.
+* \retval #PH_ERR_KEY No key loaded.
+*/
+phStatus_t phCryptoSym_Encrypt(
+                               void * pDataParams,          /**< [In] Pointer to this layer's parameter structure. */
+                               uint16_t wOption,            /**< [In] Cipher mode combined with the PH_EXCHANGE_BUFFER_* option. */
+                               const uint8_t * pPlainBuffer,/**< [In] Plain data, may be the same as pEncryptedBuffer. */
+                               uint16_t wBufferLength,      /**< [In] Length of the data, multiple of the block size. */
+                               uint8_t * pEncryptedBuffer   /**< [Out] Encrypted data. */
+                               );
+
+/**
+* \brief Decrypt data with the loaded key.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER wBufferLength is not a multiple of the block size.
+* \retval #PH_ERR_KEY No key loaded.
+*/
+phStatus_t phCryptoSym_Decrypt(
+                               void * pDataParams,                  /**< [In] Pointer to this layer's parameter structure. */
+                               uint16_t wOption,                    /**< [In] Cipher mode combined with the PH_EXCHANGE_BUFFER_* option. */
+                               const uint8_t * pEncryptedBuffer,    /**< [In] Encrypted data, may be the same as pPlainBuffer. */
+                               uint16_t wBufferLength,              /**< [In] Length of the data, multiple of the block size. */
+                               uint8_t * pPlainBuffer               /**< [Out] Plain data. */
+                               );
+
+/**
+* \brief Calculate a MAC with the loaded key.
+*
+* Buffered calls (#PH_EXCHANGE_BUFFER_FIRST, #PH_EXCHANGE_BUFFER_CONT) accept any length and
+* return no MAC; the MAC is returned by the completing call.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_KEY No key loaded.
+*/
+phStatus_t phCryptoSym_CalculateMac(
+                                    void * pDataParams,     /**< [In] Pointer to this layer's parameter structure. */
+                                    uint16_t wOption,       /**< [In] MAC mode combined with the PH_EXCHANGE_BUFFER_* option. */
+                                    const uint8_t * pData,  /**< [In] Input data. */
+                                    uint16_t wDataLength,   /**< [In] Length of the input data. */
+                                    uint8_t * pMac,         /**< [Out] MAC, one block long. */
+                                    uint8_t * pMacLength    /**< [Out] Length of the MAC, zero for buffered calls. */
+                                    );
+
+/**
+* \brief Load an IV.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER bIVLength does not match the block size of the loaded key.
+*/
+phStatus_t phCryptoSym_LoadIv(
+                              void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                              const uint8_t * pIV,  /**< [In] IV. */
+                              uint8_t bIVLength     /**< [In] Length of the IV. */
+                              );
+
+/**
+* \brief Load a key from the key store.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_KEY Key type in the key store does not match wKeyType.
+* \retval Other Depending on the key store.
+*/
+phStatus_t phCryptoSym_LoadKey(
+                               void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+                               uint16_t wKeyNo,         /**< [In] Key number in the key store. */
+                               uint16_t wKeyVersion,    /**< [In] Key version in the key store. */
+                               uint16_t wKeyType        /**< [In] Expected key type. */
+                               );
+
+/**
+* \brief Load a key directly.
+*
+* The IV is reset to zero and the CMAC state is cleared.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Key type not supported.
+*/
+phStatus_t phCryptoSym_LoadKeyDirect(
+                                     void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                                     const uint8_t * pKey,  /**< [In] Key, #phCryptoSym_GetKeySize bytes. */
+                                     uint16_t wKeyType      /**< [In] Key type. */
+                                     );
+
+/**
+* \brief Set configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Configuration or value not supported.
+*/
+phStatus_t phCryptoSym_SetConfig(
+                                 void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                                 uint16_t wConfig,      /**< [In] Configuration Identifier. */
+                                 uint16_t wValue        /**< [In] Configuration Value. */
+                                 );
+
+/**
+* \brief Get configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Configuration not supported.
+*/
+phStatus_t phCryptoSym_GetConfig(
+                                 void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                                 uint16_t wConfig,      /**< [In] Configuration Identifier. */
+                                 uint16_t * pValue      /**< [Out] Configuration Value. */
+                                 );
+
+#endif /* NXPRDLIB_REM_GEN_INTFS */
+
+/**
+* \brief Get the size of a key type.
+* \return Size of the key in bytes, zero for unknown key types.
+*/
+uint16_t phCryptoSym_GetKeySize(
+                                uint16_t wKeyType   /**< [In] Key type. */
+                                );
+
+/** @} */
+#endif /* NXPBUILD__PH_CRYPTOSYM */
+
+#ifdef __cplusplus
+} /* Extern C */
+#endif
+
+#endif /* PHCRYPTOSYM_H */
@@ -98,7 +98,7 @@ typedef struct phTools_Q
                                            bSenderType determines the actual type of the sender to allow proper casting. */
     uint8_t *pbData;                  /**< Content of the message, type of the content is given using bType. */
     uint32_t dwLength;                /**< Length of the message. */
-    uint8_t bLlcpBuf[6];              /**< Buffer used to store LLCP formatted PDUs that needs to be sent while processing Message Queue. */
+    uint8_t bLlcpBuf[9];              /**< Buffer used to store LLCP formatted PDUs that needs to be sent while processing Message Queue. */
     uint8_t bLlcpData;                /**< This variable is used to decide if LLCP framed data should be sent or data from application. */
     struct phTools_Q *pNext;          /**< Pointer to next element in the list/queue. */
     uint16_t wFrameOpt;               /**< Frame Option can take #PH_TRANSMIT_DEFAULT, #PH_TRANSMIT_BUFFER_FIRST,
@@ -295,6 +295,21 @@ phTools_Q_t* phTools_Q_Receive(
                                uint32_t dwBlockTime          /**< [IN] The time in ticks to wait for a empty Queue to become available. */
                                );
 
+/**
+* \brief Returns the message at the head of the send queue list without removing it.
+* Does not block; returns NULL if the list is empty or a producer is still queuing a chained message.
+*/
+phTools_Q_t* phTools_Q_Peek(void);
+
+/**
+* \brief Removes the message at the head of the send queue list only if it is \b psMsgQueue.
+* Does not block; used together with #phTools_Q_Peek to consume a message that was inspected before.
+* Returns NULL if the head changed in between.
+*/
+phTools_Q_t* phTools_Q_ReceiveIf(
+                                 phTools_Q_t *psMsgQueue      /**< [IN] Message previously returned by #phTools_Q_Peek. */
+                                 );
+
 /**
 * \brief Returns a freed message queue back to the free message pool.
 * Usually used by the Message Queue Manager to return the queue to the Free pool.
@@ -242,6 +242,17 @@ extern "C" {
  * send the response.
  * */
 #define PHAC_DISCLOOP_ACTIVATED_BY_PEER                     0x008FU
+
+/**
+ * Single device/card resolved but rejected by the pre-activation filter.
+ *
+ * This status is returned by \ref phacDiscLoop_Run in passive poll mode when
+ * a single card/device got resolved in collision resolution stage but does not
+ * match any entry of \ref phacDiscLoop_Sw_DataParams::pFilterTable for its
+ * technology. The card/device is not activated. If #PHAC_DISCLOOP_CONFIG_FILTER_HALT
+ * is enabled the card/device is additionally sent to halt/quiet state.
+ * */
+#define PHAC_DISCLOOP_DEVICE_FILTERED                       0x0090U
 /*@}*/
 
 /**
@@ -317,6 +328,21 @@ extern "C" {
 #define PHAC_DISCLOOP_FELICA_RD_LENGTH                        0x02U   /**< Request Data (RD) length for Felica SENSF_RES. */
 /*@}*/
 
+/**
+* \name Pre-activation filter fields.
+* \brief Field of the resolved card/device compared by a \ref phacDiscLoop_Sw_Filter_t entry.
+*/
+/*@{*/
+#define PHAC_DISCLOOP_FILTER_FIELD_UID                        0x00U   /**< UID (Type A, V), PUPI (Type B), IDm (Type F) or UII (18000P3M3), compared as prefix. */
+#define PHAC_DISCLOOP_FILTER_FIELD_ATQA                       0x01U   /**< ATQA of Type A. */
+#define PHAC_DISCLOOP_FILTER_FIELD_SAK                        0x02U   /**< SAK of Type A. */
+#define PHAC_DISCLOOP_FILTER_FIELD_AFI                        0x03U   /**< AFI (first byte of application data in ATQB) of Type B. */
+#define PHAC_DISCLOOP_FILTER_FIELD_SYSTEM_CODE                0x04U   /**< System code of Type F, received as request data when request code 0x01 is used. */
+#define PHAC_DISCLOOP_FILTER_FIELD_DSFID                      0x05U   /**< DSFID of Type V. */
+#define PHAC_DISCLOOP_FILTER_MAX_LENGTH                       0x0AU   /**< Maximum number of bytes compared by one filter entry. */
+#define PHAC_DISCLOOP_FILTER_OPTION_AND_NEXT                  0x01U   /**< Entry has to match together with the next entry of the table. */
+/*@}*/
+
 /**
 * \name Select Acknowledge (SAK) mask values for different Type A tags.
 * \brief Application can use these mask values to detect the Type of tag
@@ -606,6 +632,24 @@ typedef struct phacDiscLoop_TargetParams
     uint8_t bRetryCount;                                              /**< Retry count for AUTOCOLL in case of failure. Default is 0. */
 }phacDiscLoop_Sw_TargetParams_t;
 
+/**
+* \brief Pre-activation filter entry
+*
+* Compares \a bLength bytes of the selected field of a resolved card/device
+* with \a aValue, considering only the bits set in \a aMask. Entries of a
+* technology are OR'ed, unless #PHAC_DISCLOOP_FILTER_OPTION_AND_NEXT is set in
+* which case the entry has to match together with the following entry.
+*/
+typedef struct phacDiscLoop_Sw_Filter
+{
+    uint8_t bTechType;                                                /**< Technology of the entry, one of \ref phacDiscLoop_Sw_NfcTech_t. */
+    uint8_t bField;                                                   /**< Compared field, one of PHAC_DISCLOOP_FILTER_FIELD_* values. */
+    uint8_t bLength;                                                  /**< Number of bytes to compare; at most #PHAC_DISCLOOP_FILTER_MAX_LENGTH. */
+    uint8_t bOption;                                                  /**< #PHAC_DISCLOOP_FILTER_OPTION_AND_NEXT or 0. */
+    uint8_t aValue[PHAC_DISCLOOP_FILTER_MAX_LENGTH];                  /**< Expected value. */
+    uint8_t aMask[PHAC_DISCLOOP_FILTER_MAX_LENGTH];                   /**< Bits of \a aValue to be compared. */
+}phacDiscLoop_Sw_Filter_t;
+
 /**
 * \brief Discovery loop parameter structure
 */
@@ -663,6 +707,27 @@ typedef struct phacDiscLoop_Sw_DataParams
      * */
     uint8_t bPasPollBailOut;
 
+    /**
+     * Technologies for which detection is resumed after activation in passive mode.
+     *
+     * When one of these technologies is detected, technology detection stops,
+     * the device is resolved and activated in the same \ref phacDiscLoop_Run and
+     * detection of the remaining technologies is performed in the next
+     * \ref phacDiscLoop_Run. Bit masks are the same as for
+     * \ref phacDiscLoop_Sw_DataParams::bPasPollBailOut.
+     *
+     * Use \ref phacDiscLoop_SetConfig with #PHAC_DISCLOOP_CONFIG_BAIL_OUT_RESUME
+     * option to configure above values.
+     * */
+    uint8_t bPasPollResumeCfg;
+
+    /**
+     * Technologies left to be detected in the next \ref phacDiscLoop_Run, not to be modified.
+     *
+     * Set when detection stopped due to \ref phacDiscLoop_Sw_DataParams::bPasPollResumeCfg.
+     * */
+    uint8_t bPasPollResumeTechs;
+
     /**
      * Technologies to listen for in passive listen mode.
      *
@@ -746,6 +811,120 @@ typedef struct phacDiscLoop_Sw_DataParams
      * */
     uint16_t wActPollGTimeUs;
 
+    /**
+     * Contains polling periods (in discovery loop cycles) for different technologies
+     * in passive poll mode.
+     *
+     * #PHAC_DISCLOOP_CONFIG_TYPEA_POLL_PERIOD      -> Polling period for Type A.\n
+     * #PHAC_DISCLOOP_CONFIG_TYPEB_POLL_PERIOD      -> Polling period for Type B.\n
+     * #PHAC_DISCLOOP_CONFIG_TYPEF212_POLL_PERIOD   -> Polling period for Type F @ 212 kbps.\n
+     * #PHAC_DISCLOOP_CONFIG_TYPEF424_POLL_PERIOD   -> Polling period for Type F @ 424 kbps.\n
+     * #PHAC_DISCLOOP_CONFIG_TYPEV_POLL_PERIOD      -> Polling period for Type V.\n
+     * #PHAC_DISCLOOP_CONFIG_18000P3M3_POLL_PERIOD  -> Polling period for ISO 18000p3m3/ EPC Gen2.\n
+     *
+     * Use \ref phacDiscLoop_SetConfig with above options to configure polling period.
+     * */
+    uint8_t baPasPollPeriod[PHAC_DISCLOOP_PASS_POLL_MAX_TECHS_SUPPORTED];
+
+    /**
+     * Current polling period of each technology in passive poll mode, not to be modified.
+     *
+     * Equals \ref phacDiscLoop_Sw_DataParams::baPasPollPeriod unless adaptive
+     * polling is enabled with #PHAC_DISCLOOP_CONFIG_POLL_ADAPTIVE.
+     * */
+    uint8_t baPasPollCurPeriod[PHAC_DISCLOOP_PASS_POLL_MAX_TECHS_SUPPORTED];
+
+    /**
+     * Number of discovery loop cycles left before a technology is polled again,
+     * not to be modified.
+     * */
+    uint8_t baPasPollCountDown[PHAC_DISCLOOP_PASS_POLL_MAX_TECHS_SUPPORTED];
+
+    /**
+     * Enable/Disable adaptive polling periods in passive poll mode.
+     *
+     * Use \ref phacDiscLoop_SetConfig with #PHAC_DISCLOOP_CONFIG_POLL_ADAPTIVE option
+     * to #PH_ON / #PH_OFF adaptive polling.
+     * */
+    uint8_t bPasPollAdaptive;
+
+    /**
+     * Pointer to the pre-activation filter table.
+     *
+     * Application may initialize this pointer with address of an array of
+     * \ref phacDiscLoop_Sw_Filter_t entries and set \ref phacDiscLoop_Sw_DataParams::bNumFilterEntries.
+     * A single resolved card/device is only activated if it matches the table;
+     * technologies without entries are not filtered. Default is NULL.
+     * */
+    const phacDiscLoop_Sw_Filter_t * pFilterTable;
+
+    /**
+     * Number of entries in \ref phacDiscLoop_Sw_DataParams::pFilterTable.
+     * */
+    uint8_t bNumFilterEntries;
+
+    /**
+     * Enable/Disable halting of cards/devices rejected by the pre-activation filter.
+     *
+     * Use \ref phacDiscLoop_SetConfig with #PHAC_DISCLOOP_CONFIG_FILTER_HALT option
+     * to #PH_ON / #PH_OFF halting.
+     * */
+    uint8_t bFilterHalt;
+
+    /**
+     * Enable/Disable automatic data rate negotiation for ISO/IEC 14443-4 Type A and Type B.
+     *
+     * Use \ref phacDiscLoop_SetConfig with #PHAC_DISCLOOP_CONFIG_I3P4_AUTO_DATARATE option
+     * to #PH_ON / #PH_OFF automatic data rate negotiation.
+     * */
+    uint8_t bI3P4AutoDataRate;
+
+    /**
+     * Number of integrity errors after which the next activation falls back to a lower data rate.
+     *
+     * Use \ref phacDiscLoop_SetConfig with #PHAC_DISCLOOP_CONFIG_I3P4_DATARATE_ERR_LIMIT option
+     * to set the limit. 0 disables the fall back.
+     * */
+    uint8_t bI3P4DataRateErrLimit;
+
+    /**
+     * Highest DRI/DSI used by automatic data rate negotiation.
+     *
+     * Index 0 is Type A, index 1 is Type B. Lowered on fall back and reset
+     * when #PHAC_DISCLOOP_CONFIG_I3P4_AUTO_DATARATE is set.
+     * */
+    uint8_t baI3P4MaxDataRate[2];
+
+    /**
+     * DRI/DSI selected by automatic data rate negotiation for the last activated card.
+     *
+     * Index 0 is Type A, index 1 is Type B. Kept apart from the configured DRI/DSI,
+     * which are used again when #PHAC_DISCLOOP_CONFIG_I3P4_AUTO_DATARATE is cleared.
+     * */
+    uint8_t baI3P4NegDri[2];
+    uint8_t baI3P4NegDsi[2];
+
+    /**
+     * Technology (0 - Type A, 1 - Type B) last activated with a negotiated data rate above
+     * 106 kbps, 0xFF if none. Checked for fall back on the next activation.
+     * */
+    uint8_t bI3P4DataRateTech;
+
+    /**
+     * Enable/Disable automatic LRi and PSL negotiation for NFC-DEP initiator.
+     *
+     * Use \ref phacDiscLoop_SetConfig with #PHAC_DISCLOOP_CONFIG_P2P_AUTO_NEGOTIATE option
+     * to #PH_ON / #PH_OFF automatic negotiation.
+     * */
+    uint8_t bP2PAutoNegotiate;
+
+    /**
+     * Highest DSI/DRI requested with PSL_REQ by automatic negotiation.
+     *
+     * Lowered when PSL_REQ fails and reset when #PHAC_DISCLOOP_CONFIG_P2P_AUTO_NEGOTIATE is set.
+     * */
+    uint8_t bP2PMaxDataRate;
+
     /**
      * Flag to indicate whether collision is pending or not.
      *
@@ -833,6 +1012,15 @@ typedef struct phacDiscLoop_Sw_DataParams
      * */
     uint8_t bDetectedTechs;
 
+    /**
+     * Passive technologies polled during the technology detection stage of the last
+     * \ref phacDiscLoop_Run in poll mode, same bit positions as bDetectedTechs.
+     *
+     * Use \ref phacDiscLoop_GetConfig with #PHAC_DISCLOOP_CONFIG_POLLED_TECHS
+     * option to get polled technologies.
+     * */
+    uint8_t bPolledTechs;
+
     /**
      * Hold error received from lower layer when \ref phacDiscLoop_Run returns #PHAC_DISCLOOP_FAILURE.
      *
@@ -1197,6 +1385,9 @@ phStatus_t phacDiscLoop_Sw_Init(
  * Sets the Frame Size Device Integer (FSDI) value for the Type B tags in
  * passive poll mode.
  *
+ * Values above 0x08 (256 bytes) up to 0x0C (4096 bytes) are only allowed in ISO mode.
+ * The FSD sent to the card is limited to the size of the HAL receive buffer.
+ *
  * Default is 0x08.
  * */
 #define PHAC_DISCLOOP_CONFIG_TYPEB_FSDI                       0x32U
@@ -1226,6 +1417,9 @@ phStatus_t phacDiscLoop_Sw_Init(
  * Sets the Frame Size Device Integer (FSDI) for the 14443P4A tags in passive
  * poll mode.
  *
+ * Values above 0x08 (256 bytes) up to 0x0C (4096 bytes) are only allowed in ISO mode.
+ * The FSD sent to the card is limited to the size of the HAL receive buffer.
+ *
  * Default is 0x08.
  * */
 #define PHAC_DISCLOOP_CONFIG_TYPEA_I3P4_FSDI                  0x40U
@@ -1536,6 +1730,143 @@ phStatus_t phacDiscLoop_Sw_Init(
  * range is from 0 to 255.
  * */
 #define PHAC_DISCLOOP_CONFIG_TARGET_RETRY_COUNT               0x90U
+
+/**
+ * Set/Get the polling period of Type A technology in passive poll mode.
+ *
+ * Type A is polled once in every given number of \ref phacDiscLoop_Run cycles
+ * in technology detection stage. Supported range is from 1 to 255.
+ * Polling periods are not applied in EMVCo mode and when LPCD is enabled.
+ *
+ * Default is 1 (poll in every cycle).
+ * */
+#define PHAC_DISCLOOP_CONFIG_TYPEA_POLL_PERIOD                0xA0U
+
+/**
+ * Set/Get the polling period of Type B technology in passive poll mode.
+ *
+ * Default is 1 (poll in every cycle).
+ * */
+#define PHAC_DISCLOOP_CONFIG_TYPEB_POLL_PERIOD                0xA1U
+
+/**
+ * Set/Get the polling period of Type F technology @ 212 kbps in passive poll mode.
+ *
+ * Default is 1 (poll in every cycle).
+ * */
+#define PHAC_DISCLOOP_CONFIG_TYPEF212_POLL_PERIOD             0xA2U
+
+/**
+ * Set/Get the polling period of Type F technology @ 424 kbps in passive poll mode.
+ *
+ * Default is 1 (poll in every cycle).
+ * */
+#define PHAC_DISCLOOP_CONFIG_TYPEF424_POLL_PERIOD             0xA3U
+
+/**
+ * Set/Get the polling period of Type V technology in passive poll mode.
+ *
+ * Default is 1 (poll in every cycle).
+ * */
+#define PHAC_DISCLOOP_CONFIG_TYPEV_POLL_PERIOD                0xA4U
+
+/**
+ * Set/Get the polling period of 18000P3M3 technology in passive poll mode.
+ *
+ * Default is 1 (poll in every cycle).
+ * */
+#define PHAC_DISCLOOP_CONFIG_18000P3M3_POLL_PERIOD            0xA5U
+
+/**
+ * Enable/Disable adaptive polling periods in passive poll mode (#PH_ON or #PH_OFF).
+ *
+ * When enabled, a technology detected in a cycle is polled again in every
+ * cycle. Each time it is polled but not detected its polling period is doubled,
+ * up to the period configured with #PHAC_DISCLOOP_CONFIG_TYPEA_POLL_PERIOD etc.
+ *
+ * Default is #PH_OFF.
+ * */
+#define PHAC_DISCLOOP_CONFIG_POLL_ADAPTIVE                    0xA6U
+
+/**
+ * Enable/Disable halting of cards/devices rejected by the pre-activation filter (#PH_ON or #PH_OFF).
+ *
+ * When enabled, a rejected Type A card is sent HLTA, a Type B card HLTB and a
+ * Type V card STAY QUIET. Type F and 18000P3M3 devices are only skipped.
+ *
+ * Default is #PH_OFF.
+ * */
+#define PHAC_DISCLOOP_CONFIG_FILTER_HALT                      0xA7U
+
+/**
+ * Set/Get the bail out with resume option for various technologies in passive poll mode.
+ *
+ * Like #PHAC_DISCLOOP_CONFIG_BAIL_OUT, technology detection stops as soon as
+ * one of the given technologies is detected and the device is resolved and
+ * activated. Detection of the technologies not yet polled in this cycle is
+ * resumed by the next \ref phacDiscLoop_Run in detection state, after which
+ * the following cycle polls all technologies again. Not applied in EMVCo mode.
+ *
+ * Default is not set for any technology.\n
+ * #PHAC_DISCLOOP_POS_BIT_MASK_A         -> Bail out with resume for Type A.\n
+ * #PHAC_DISCLOOP_POS_BIT_MASK_B         -> Bail out with resume for Type B.\n
+ * #PHAC_DISCLOOP_POS_BIT_MASK_F212      -> Bail out with resume for Type FELICA @ 212 kbps.\n
+ * #PHAC_DISCLOOP_POS_BIT_MASK_F424      -> Bail out with resume for Type FELICA @ 424 kbps.\n
+ * #PHAC_DISCLOOP_POS_BIT_MASK_V         -> Bail out with resume for Type V / ISO 15693.\n
+ * */
+#define PHAC_DISCLOOP_CONFIG_BAIL_OUT_RESUME                  0xA8U
+
+/**
+ * Enable/Disable automatic data rate negotiation for ISO/IEC 14443-4 Type A and Type B (#PH_ON or #PH_OFF).
+ *
+ * When enabled, the highest data rate supported by both the card (TA(1) of the ATS
+ * or Bit_Rate_capability of the ATQB) and the reader is selected with PPS or ATTRIB,
+ * up to 848 kbps. #PHAC_DISCLOOP_CONFIG_TYPEA_I3P4_DRI, #PHAC_DISCLOOP_CONFIG_TYPEA_I3P4_DSI,
+ * #PHAC_DISCLOOP_CONFIG_TYPEB_DRI and #PHAC_DISCLOOP_CONFIG_TYPEB_DSI are not used
+ * for activation and return the negotiated values. The configured values are kept
+ * and used again once this option is cleared. Not applied in EMVCo mode.
+ *
+ * Setting this option also restores 848 kbps as highest data rate after a fall back.
+ *
+ * Default is #PH_OFF.
+ * */
+#define PHAC_DISCLOOP_CONFIG_I3P4_AUTO_DATARATE               0xA9U
+
+/**
+ * Set/Get the number of integrity errors after which automatic data rate negotiation falls back.
+ *
+ * Integrity errors are counted by the ISO/IEC 14443-4 layer while the card is active.
+ * If a card activated above 106 kbps reached this count, or PPS/ATTRIB failed,
+ * the next activation of the technology uses the next lower data rate.
+ * 0 disables the fall back.
+ *
+ * Default is 3.
+ * */
+#define PHAC_DISCLOOP_CONFIG_I3P4_DATARATE_ERR_LIMIT          0xAAU
+
+/**
+ * Enable/Disable automatic LRi and PSL negotiation for NFC-DEP initiator (#PH_ON or #PH_OFF).
+ *
+ * When enabled, ATR_REQ requests the largest LRi that fits into the HAL receive buffer
+ * (up to 254 bytes) instead of #PHAC_DISCLOOP_CONFIG_TYPEA_P2P_LRI / #PHAC_DISCLOOP_CONFIG_TYPEF_P2P_LRI.
+ * After ATR_RES, PSL_REQ switches to the highest data rate supported by the target (BSt/BRt),
+ * up to 424 kbps, and to the common frame size. PSL_REQ is only sent if it changes the data rate.
+ * If PSL_REQ fails, the error is returned and the next activation uses the next lower data rate.
+ *
+ * Setting this option also restores 424 kbps as highest data rate after a fall back.
+ *
+ * Default is #PH_OFF.
+ * */
+#define PHAC_DISCLOOP_CONFIG_P2P_AUTO_NEGOTIATE               0xABU
+
+/**
+ * Returns the passive technologies polled (guard time applied and poll command sent)
+ * during the technology detection stage of the last \ref phacDiscLoop_Run in poll mode.
+ *
+ * Uses the same bit positions as #PHAC_DISCLOOP_CONFIG_TECH_DETECTED. 0 if the cycle ended
+ * before technology detection, e.g. when LPCD did not detect a card. Read only.
+ * */
+#define PHAC_DISCLOOP_CONFIG_POLLED_TECHS                     0xACU
 /*@}*/
 
 #ifdef NXPRDLIB_REM_GEN_INTFS
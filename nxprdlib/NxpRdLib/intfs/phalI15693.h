@@ -79,6 +79,21 @@ phStatus_t phalI15693_Sw_Init(
 #define PHAL_I15693_OPTION_DEFAULT  PHAL_I15693_OPTION_OFF  /**< Default Option. */
 /*@}*/
 
+/**
+* \brief Per tag entry of a group operation.
+*
+* One entry is passed for each tag taken from an inventory; the status and
+* data of the access to that tag are returned in the same entry.
+*/
+typedef struct
+{
+    uint8_t * pUid;         /**< [In] UID of the tag as returned by the inventory (#PHPAL_SLI15693_UID_LENGTH bytes). */
+    uint8_t * pData;        /**< [In] Read: buffer receiving the block data; Write: data to be written. */
+    uint16_t wDataBufSize;  /**< [In] Read: size of \c pData; Write: number of bytes in \c pData. */
+    uint16_t wDataLength;   /**< [Out] Read: number of bytes received; Write: number of bytes written. */
+    phStatus_t wStatus;     /**< [Out] Status of the access to this tag. */
+} phalI15693_GroupTag_t;
+
 #ifdef NXPRDLIB_REM_GEN_INTFS
 #include "../comps/phalI15693/src/Sw/phalI15693_Sw.h"
 
@@ -136,6 +151,12 @@ phStatus_t phalI15693_Sw_Init(
 #define phalI15693_ExtendedGetMultipleBlockSecurityStatus(pDataParams, wBlockNo, wNumBlocks, ppRxBuffer, pRxLength) \
         phalI15693_Sw_ExtendedGetMultipleBlockSecurityStatus((phalI15693_Sw_DataParams_t *)pDataParams, wBlockNo, wNumBlocks, ppRxBuffer, pRxLength)
 
+#define phalI15693_GroupReadMultipleBlocks(pDataParams, bOption, bBlockNo, wNumBlocks, pTags, wNumTags) \
+        phalI15693_Sw_GroupReadMultipleBlocks((phalI15693_Sw_DataParams_t *)pDataParams, bOption, bBlockNo, wNumBlocks, pTags, wNumTags)
+
+#define phalI15693_GroupWriteBlocks(pDataParams, bOption, bBlockNo, wNumBlocks, pTags, wNumTags) \
+        phalI15693_Sw_GroupWriteBlocks((phalI15693_Sw_DataParams_t *)pDataParams, bOption, bBlockNo, wNumBlocks, pTags, wNumTags)
+
 
 #else
 /**
@@ -431,6 +452,58 @@ phStatus_t phalI15693_ExtendedGetMultipleBlockSecurityStatus (
     uint16_t * pRxLength    /**< [Out] number of received data bytes. */
     );
 
+/**
+* \brief Reads the same block range from a group of tags.
+*
+* The request flags and the timeout are configured once for the whole group;
+* each tag is then accessed in addressed mode with a single read multiple
+* blocks command. A tag which does not answer or fails does not abort the
+* group, its status is returned in \c wStatus of its entry and the next tag
+* is processed. The request flags and the UID of the underlying
+* \ref phpalSli15693 layer are restored afterwards.
+*
+* Tags supporting \ref phpalSli15693_InventoryRead "inventory read" or
+* \ref phpalSli15693_FastInventoryRead "fast inventory read" can return the
+* same blocks already during the inventory; this function is meant for the
+* tags which were not read that way.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Group processed, see \c wStatus of each entry.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid option or block range.
+* \retval Other Depending on implementation and underlying component.
+*/
+phStatus_t phalI15693_GroupReadMultipleBlocks(
+    void * pDataParams,             /**< [In] Pointer to this layers parameter structure. */
+    uint8_t bOption,                /**< [In] Option flag; \c #PHAL_I15693_OPTION_OFF: disable; \c #PHAL_I15693_OPTION_ON: enable. */
+    uint8_t bBlockNo,               /**< [In] First block number. */
+    uint16_t wNumBlocks,            /**< [In] Number of blocks. */
+    phalI15693_GroupTag_t * pTags,  /**< [In,Out] Tags to read from. */
+    uint16_t wNumTags               /**< [In] Number of entries in \c pTags. */
+    );
+
+/**
+* \brief Writes a block range to a group of tags.
+*
+* The blocks are written one by one with the write single block command, which
+* is supported by all tags, in addressed mode. The block size is taken from
+* \c wDataBufSize / \c wNumBlocks of each entry. As for
+* \ref phalI15693_GroupReadMultipleBlocks, the protocol settings are applied
+* once and a failing tag only stops the access to that tag.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Group processed, see \c wStatus of each entry.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid option or block range.
+* \retval Other Depending on implementation and underlying component.
+*/
+phStatus_t phalI15693_GroupWriteBlocks(
+    void * pDataParams,             /**< [In] Pointer to this layers parameter structure. */
+    uint8_t bOption,                /**< [In] Option flag; \c #PHAL_I15693_OPTION_OFF: disable; \c #PHAL_I15693_OPTION_ON: enable. */
+    uint8_t bBlockNo,               /**< [In] First block number. */
+    uint16_t wNumBlocks,            /**< [In] Number of blocks. */
+    phalI15693_GroupTag_t * pTags,  /**< [In,Out] Tags to write to. */
+    uint16_t wNumTags               /**< [In] Number of entries in \c pTags. */
+    );
+
 /** @} */
 
 #endif /* NXPRDLIB_REM_GEN_INTFS */
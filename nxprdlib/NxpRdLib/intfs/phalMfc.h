@@ -41,6 +41,7 @@ extern "C" {
 */
 
 #define PHAL_MFC_SW_ID          0x01    /**< ID for Software MIFARE layer */
+#define PHAL_MFC_SECTOR_NONE    0xFFU   /**< No sector authenticated. */
 
 /**
 * \brief Private parameter structure
@@ -50,6 +51,12 @@ typedef struct
     uint16_t wId;                   /**< Layer ID for this component, NEVER MODIFY! */
     void * pPalMifareDataParams;    /**< Pointer to the parameter structure of the palMifare component. */
     void * pKeyStoreDataParams;     /**< Pointer to the parameter structure of the KeyStore component. */
+    uint8_t bAuthSector;            /**< Sector of the current Crypto1 session; #PHAL_MFC_SECTOR_NONE if none. */
+    uint8_t bAuthKeyType;           /**< Key type of the current Crypto1 session. */
+    uint16_t wAuthKeyNo;            /**< Key number of the current Crypto1 session. */
+    uint16_t wAuthKeyVersion;       /**< Key version of the current Crypto1 session. */
+    uint8_t aAuthUid[4];            /**< UID bytes the current Crypto1 session was started with. */
+    uint8_t bKeyIndex;              /**< Index of the candidate key which authenticated last in the sector functions. */
 } phalMfc_Sw_DataParams_t;
 
 /**
@@ -89,6 +96,8 @@ phStatus_t phalMfc_Sw_Init(
 /*@{*/
 #define PHAL_MFC_DATA_BLOCK_LENGTH      16U     /**< Length of a MIFARE(R) Classic data block. */
 #define PHAL_MFC_VALUE_BLOCK_LENGTH      4U     /**< Length of a MIFARE(R) Classic value block. */
+#define PHAL_MFC_SMALL_SECTORS          32U     /**< Number of sectors with 4 blocks; higher sectors (4K) have 16 blocks. */
+#define PHAL_MFC_MAX_SECTORS            40U     /**< Number of sectors of a MIFARE(R) Classic 4K. */
 /*@}*/
 
 /**
@@ -146,6 +155,12 @@ phStatus_t phalMfc_Sw_Init(
 
 #define phalMfc_GetVersion(pDataParams, pVersion) \
         phalMfc_Sw_GetVersion((phalMfc_Sw_DataParams_t *)pDataParams, pVersion)
+
+#define phalMfc_ReadSectors(pDataParams, pPalI14443p3aDataParams, pSectors, bNumSectors, bKeyType, pKeyNumbers, bNumKeys, wKeyVersion, pUid, bUidLength, pData) \
+        phalMfc_Sw_ReadSectors((phalMfc_Sw_DataParams_t *)pDataParams, pPalI14443p3aDataParams, pSectors, bNumSectors, bKeyType, pKeyNumbers, bNumKeys, wKeyVersion, pUid, bUidLength, pData)
+
+#define phalMfc_WriteSectors(pDataParams, pPalI14443p3aDataParams, pSectors, bNumSectors, bKeyType, pKeyNumbers, bNumKeys, wKeyVersion, pUid, bUidLength, pData) \
+        phalMfc_Sw_WriteSectors((phalMfc_Sw_DataParams_t *)pDataParams, pPalI14443p3aDataParams, pSectors, bNumSectors, bKeyType, pKeyNumbers, bNumKeys, wKeyVersion, pUid, bUidLength, pData)
 #else
 
 /**
@@ -311,6 +326,66 @@ phStatus_t phalMfc_GetVersion(
                                   void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
                                   uint8_t * pVersion    /**< [Out] Version no  It should be #PHAL_MFC_VERSION_LENGTH */
                                   );
+
+/**
+* \brief Read all blocks of a list of sectors with one authentication per sector.
+*
+* Each sector is authenticated once and all its blocks are read. A sector still
+* authenticated from the last #phalMfc_Authenticate or sector function call,
+* with one of the candidate keys and while the HAL reports Crypto1 active
+* (#PHHAL_HW_CONFIG_DISABLE_MF_CRYPTO1), is not authenticated again.
+*
+* The candidate keys are tried starting with the one which authenticated last.
+* As the card halts after a failed authentication, it is woken up and selected
+* again with \c pPalI14443p3aDataParams before the next key is tried; the RF
+* field stays on. If \c pPalI14443p3aDataParams is NULL only one key is tried.
+*
+* \c pData receives the blocks of all sectors in list order, 64 bytes for
+* sectors 0 - 31 and 256 bytes for sectors 32 - 39, sector trailers included.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid sector number, no keys or UID too short.
+* \retval #PH_ERR_AUTH_ERROR None of the keys authenticated a sector.
+*/
+phStatus_t phalMfc_ReadSectors(
+                               void * pDataParams,                  /**< [In] Pointer to this layer's parameter structure. */
+                               void * pPalI14443p3aDataParams,      /**< [In] Pointer to the ISO14443-3A PAL used to reselect the card; may be NULL. */
+                               uint8_t * pSectors,                  /**< [In] Sector numbers (0 - 39) to read. */
+                               uint8_t bNumSectors,                 /**< [In] Number of sectors in pSectors. */
+                               uint8_t bKeyType,                    /**< [In] Either #PHAL_MFC_KEYA or #PHAL_MFC_KEYB. */
+                               uint16_t * pKeyNumbers,              /**< [In] Candidate key numbers. */
+                               uint8_t bNumKeys,                    /**< [In] Number of candidate keys. */
+                               uint16_t wKeyVersion,                /**< [In] Key version of the candidate keys. */
+                               uint8_t * pUid,                      /**< [In] Complete serial number; uint8_t[4/7/10]. */
+                               uint8_t bUidLength,                  /**< [In] Length of provided serial number (4/7/10). */
+                               uint8_t * pData                      /**< [Out] Block data of all sectors. */
+                               );
+
+/**
+* \brief Write all data blocks of a list of sectors with one authentication per sector.
+*
+* Authentication is done as for #phalMfc_ReadSectors. \c pData has the same
+* layout as the output of #phalMfc_ReadSectors; sector trailers and the
+* manufacturer block are skipped, so a buffer read before can be modified and
+* written back.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid sector number, no keys or UID too short.
+* \retval #PH_ERR_AUTH_ERROR None of the keys authenticated a sector.
+*/
+phStatus_t phalMfc_WriteSectors(
+                                void * pDataParams,                 /**< [In] Pointer to this layer's parameter structure. */
+                                void * pPalI14443p3aDataParams,     /**< [In] Pointer to the ISO14443-3A PAL used to reselect the card; may be NULL. */
+                                uint8_t * pSectors,                 /**< [In] Sector numbers (0 - 39) to write. */
+                                uint8_t bNumSectors,                /**< [In] Number of sectors in pSectors. */
+                                uint8_t bKeyType,                   /**< [In] Either #PHAL_MFC_KEYA or #PHAL_MFC_KEYB. */
+                                uint16_t * pKeyNumbers,             /**< [In] Candidate key numbers. */
+                                uint8_t bNumKeys,                   /**< [In] Number of candidate keys. */
+                                uint16_t wKeyVersion,               /**< [In] Key version of the candidate keys. */
+                                uint8_t * pUid,                     /**< [In] Complete serial number; uint8_t[4/7/10]. */
+                                uint8_t bUidLength,                 /**< [In] Length of provided serial number (4/7/10). */
+                                uint8_t * pData                     /**< [In] Block data of all sectors. */
+                                );
 /** @} */
 
 #endif /* NXPRDLIB_REM_GEN_INTFS */
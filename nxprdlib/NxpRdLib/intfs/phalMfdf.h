@@ -49,6 +49,8 @@ extern "C" {
 */
 /** @{ */
 #define PHAL_MFDF_NOT_AUTHENTICATED     0xFFU   /**< No authentication. */
+#define PHAL_MFDF_AUTHENTICATEAES       0xAAU   /**< AES authentication, EV1 secure messaging. */
+#define PHAL_MFDF_NO_DIVERSIFICATION    0xFFFFU /**< No key diversification. */
 
 
 #define PHAL_MFDF_COMMUNICATION_PLAIN   0x00U   /**< Plain mode of communication. */
@@ -59,6 +61,31 @@ extern "C" {
 #define PHAL_MFDF_ADDITIONAL_INFO       0x00A1  /**< Option for getconfig to get additional info of a generic error. */
 /** @} */
 
+/**
+* \name Commands of #phalMfdf_ExecuteBatch
+*/
+/** @{ */
+#define PHAL_MFDF_BATCH_SELECT_APPLICATION  0x5AU   /**< SelectApplication, aParams[0..2] holds the AID. */
+#define PHAL_MFDF_BATCH_GET_VALUE           0x6CU   /**< GetValue of a value file, returns 4 bytes. */
+#define PHAL_MFDF_BATCH_READ_RECORDS        0xBBU   /**< ReadRecords, aParams holds first record and number of records. */
+#define PHAL_MFDF_BATCH_READ_DATA           0xBDU   /**< ReadData, aParams holds offset and length. */
+#define PHAL_MFDF_BATCH_COMMIT_TRANSACTION  0xC7U   /**< CommitTransaction. */
+/** @} */
+
+/**
+* \brief One command of a batch, see #phalMfdf_ExecuteBatch.
+*/
+typedef struct
+{
+    uint8_t bCmd;           /**< [In] One of the PHAL_MFDF_BATCH_* commands. */
+    uint8_t bCommOption;    /**< [In] Communication mode of the file, plain without authentication. */
+    uint8_t bFileNo;        /**< [In] File number, unused for SelectApplication and CommitTransaction. */
+    uint8_t aParams[6];     /**< [In] AID, or 3 bytes offset/first record and 3 bytes length/number of records. LSB first. */
+    uint8_t * pRxBuffer;    /**< [In] Buffer the response data is copied to, unused for SelectApplication and CommitTransaction. */
+    uint16_t wRxBufSize;    /**< [In] Size of pRxBuffer. */
+    uint16_t wRxLength;     /**< [Out] Length of the response data copied to pRxBuffer. */
+} phalMfdf_BatchCmd_t;
+
 /** \name phalMfdf Custom Error Codes
 */
 /** @{ */
@@ -155,6 +182,9 @@ phStatus_t phalMfdf_Sw_Init(
 #ifdef NXPRDLIB_REM_GEN_INTFS
 #include "../comps/phalMfdf/src/Sw/phalMfdf_Sw.h"
 
+#define phalMfdf_AuthenticateAes(pDataParams,wOption,wKeyNo,wKeyVer,bKeyNoCard,pDivInput,bDivLen) \
+        phalMfdf_Sw_AuthenticateAes((phalMfdf_Sw_DataParams_t *)pDataParams,wOption,wKeyNo,wKeyVer,bKeyNoCard,pDivInput,bDivLen)
+
 #define phalMfdf_CreateApplication(pDataParams,bOption,pAid,bKeySettings1,bKeySettings2,pISOFileId,pISODFName,bISODFNameLen) \
         phalMfdf_Sw_CreateApplication((phalMfdf_Sw_DataParams_t *)pDataParams,bOption,pAid,bKeySettings1,bKeySettings2,pISOFileId,pISODFName,bISODFNameLen)
 
@@ -167,15 +197,24 @@ phStatus_t phalMfdf_Sw_Init(
 #define phalMfdf_CreateStdDataFile(pDataParams,bOption,bFileNo,pISOFileId,bCommSett,pAccessRights,pFileSize) \
         phalMfdf_Sw_CreateStdDataFile((phalMfdf_Sw_DataParams_t *)pDataParams,bOption,bFileNo,pISOFileId,bCommSett,pAccessRights,pFileSize)
 
+#define phalMfdf_ReadData(pDataParams,bOption,bFileNo,pOffset,pLength,ppRxdata,pRxdataLen) \
+        phalMfdf_Sw_ReadData((phalMfdf_Sw_DataParams_t *)pDataParams,bOption,bFileNo,pOffset,pLength,ppRxdata,pRxdataLen)
+
 #define phalMfdf_WriteData(pDataParams,bCommOption,bFileNo,pOffset,pTxData,pTxDataLen) \
         phalMfdf_Sw_WriteData((phalMfdf_Sw_DataParams_t *)pDataParams,bCommOption,bFileNo,pOffset,pTxData,pTxDataLen)
 
+#define phalMfdf_ExecuteBatch(pDataParams,pCmds,bNumCmds,pNumExecuted) \
+        phalMfdf_Sw_ExecuteBatch((phalMfdf_Sw_DataParams_t *)pDataParams,pCmds,bNumCmds,pNumExecuted)
+
 #define phalMfdf_IsoSelectFile(pDataParams,bOption,bSelector,pFid,pDFname,bDFnameLen,ppFCI,pwFCILen) \
         phalMfdf_Sw_IsoSelectFile((phalMfdf_Sw_DataParams_t *)pDataParams,bOption,bSelector,pFid,pDFname,bDFnameLen,ppFCI,pwFCILen)
 
 #define phalMfdf_IsoReadBinary(pDataParams,wOption,bOffset,bSfid,bBytesToRead,ppRxBuffer,pBytesRead) \
         phalMfdf_Sw_IsoReadBinary((phalMfdf_Sw_DataParams_t *)pDataParams,wOption,bOffset,bSfid,bBytesToRead,ppRxBuffer,pBytesRead)
 
+#define phalMfdf_IsoReadBinaryExt(pDataParams,wOption,bOffset,bSfid,wBytesToRead,ppRxBuffer,pBytesRead) \
+        phalMfdf_Sw_IsoReadBinaryExt((phalMfdf_Sw_DataParams_t *)pDataParams,wOption,bOffset,bSfid,wBytesToRead,ppRxBuffer,pBytesRead)
+
 #define phalMfdf_IsoUpdateBinary(pDataParams,bOffset,bSfid,pData,bDataLen) \
         phalMfdf_Sw_IsoUpdateBinary((phalMfdf_Sw_DataParams_t *)pDataParams,bOffset,bSfid,pData,bDataLen)
 
@@ -190,6 +229,35 @@ phStatus_t phalMfdf_Sw_Init(
 
 #ifndef NXPRDLIB_REM_GEN_INTFS /* Without optimization */
 
+/**
+* \brief Performs an EV1 AES authentication with the PICC.
+*
+* The AES-128 key is taken from the key store, the random challenge from the CryptoRng
+* component (which the application has to seed). On success the session key is loaded
+* into the crypto component and all further native commands use EV1 secure messaging
+* (CMAC chaining of command and response, MAC'd or enciphered data), until an error
+* status is received, another application is selected or the next authentication.
+*
+* \remarks
+* Key diversification is not supported, wOption has to be #PHAL_MFDF_NO_DIVERSIFICATION.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_AUTH_ERROR The PICC did not prove knowledge of the key.
+* \retval #PH_ERR_KEY The key store entry is not an AES-128 key.
+* \retval #PH_ERR_USE_CONDITION Key store, crypto or random number component missing.
+* \retval Other Depending on implementation and underlying component.
+*/
+phStatus_t phalMfdf_AuthenticateAes(
+                                    void * pDataParams,     /**< [In] Pointer to this layers param structure. */
+                                    uint16_t wOption,       /**< [In] Diversification option, #PHAL_MFDF_NO_DIVERSIFICATION. */
+                                    uint16_t wKeyNo,        /**< [In] Key number in the key store. */
+                                    uint16_t wKeyVer,       /**< [In] Key version in the key store. */
+                                    uint8_t bKeyNoCard,     /**< [In] Key number on the card (0x00 to 0x0D). */
+                                    uint8_t * pDivInput,    /**< [In] Diversification input, unused. */
+                                    uint8_t bDivLen         /**< [In] Length of the diversification input, unused. */
+                                    );
+
 /**
 * \brief Creates new applications on the PICC
 *
@@ -286,6 +354,46 @@ phStatus_t phalMfdf_CreateStdDataFile(
 /** @{ */
 
 
+/**
+* \brief Reads data from a standard or backup data file.
+*
+* bOption is the communication mode of the file (#PHAL_MFDF_COMMUNICATION_PLAIN,
+* #PHAL_MFDF_COMMUNICATION_MACD or #PHAL_MFDF_COMMUNICATION_ENC). Without authentication
+* the data is read plain. A plain read that does not fit into the HAL receive buffer returns
+* #PH_ERR_SUCCESS_CHAINING, the rest is read by calling again with #PH_EXCHANGE_RXCHAINING.
+* Authenticated reads are verified as a whole and therefore have to fit into the receive
+* buffer; larger files are read in pieces using pOffset and pLength.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_SUCCESS_CHAINING More data to be read.
+* \retval #PH_ERR_INTEGRITY_ERROR Response MAC or CRC wrong, the authentication is lost.
+* \retval #PH_ERR_BUFFER_OVERFLOW An authenticated response does not fit into the receive buffer.
+* \retval Other Depending on implementation and underlying component.
+*/
+phStatus_t phalMfdf_ReadData(
+                             void * pDataParams,    /**< [In] Pointer to this layers param structure. */
+                             uint8_t bOption,       /**< [In] Communication mode or #PH_EXCHANGE_RXCHAINING. */
+                             uint8_t bFileNo,       /**< [In] 1 byte file number. */
+                             uint8_t * pOffset,     /**< [In] 3 bytes offset. LSB First. */
+                             uint8_t * pLength,     /**< [In] 3 bytes. length of data to be read, zero reads the whole file. */
+                             uint8_t ** ppRxdata,   /**< [Out] Pointer to the data read. */
+                             uint16_t * pRxdataLen  /**< [Out] Length of the data read. */
+                             );
+
+/**
+* \brief Writes data to a standard or backup data file.
+*
+* bCommOption is the communication mode of the file. After #phalMfdf_AuthenticateAes the
+* data is sent with its truncated CMAC (#PHAL_MFDF_COMMUNICATION_MACD) or enciphered
+* together with its CRC32 (#PHAL_MFDF_COMMUNICATION_ENC); without authentication it is
+* always sent plain.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INTEGRITY_ERROR Response MAC wrong, the authentication is lost.
+* \retval Other Depending on implementation and underlying component.
+*/
 phStatus_t phalMfdf_WriteData(
                               void * pDataParams,   /**< [In] Pointer to this layers param structure. */
                               uint8_t bCommOption,  /**< [In] Communication Mode. Plain, Mac'd or encrypted. */
@@ -295,6 +403,32 @@ phStatus_t phalMfdf_WriteData(
                               uint8_t * pTxDataLen  /**< [in] 3 bytes. length of data to be written. */
                               );
 
+/**
+* \brief Runs a sequence of commands, e.g. the SelectApplication, reads and
+* CommitTransaction of one transaction, in a single call.
+*
+* All entries are checked before the first command is sent, so a bad parameter never
+* leaves the PICC in the middle of a transaction. The commands are then executed in order
+* without going through the generic interface, the response data of each is copied to its
+* pRxBuffer. Execution stops at the first failing command; with an authentication this also
+* ends the secure messaging session as for the single commands.
+*
+* Secure messaging needs the response MAC of one command as IV of the next, so the host
+* side cryptography of a command can not be done ahead of the previous response.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS All commands executed.
+* \retval #PH_ERR_INVALID_PARAMETER An entry is invalid, nothing was sent.
+* \retval #PH_ERR_BUFFER_OVERFLOW A response does not fit into the receive or the entry's buffer.
+* \retval Other Status of the failing command, see pNumExecuted.
+*/
+phStatus_t phalMfdf_ExecuteBatch(
+                                 void * pDataParams,                /**< [In] Pointer to this layers param structure. */
+                                 phalMfdf_BatchCmd_t * pCmds,       /**< [In,Out] Commands to execute. */
+                                 uint8_t bNumCmds,                  /**< [In] Number of entries in pCmds. */
+                                 uint8_t * pNumExecuted             /**< [Out] Number of commands that completed successfully. */
+                                 );
+
 
 /** @} */
 
@@ -354,6 +488,33 @@ phStatus_t phalMfdf_IsoReadBinary(
                                   uint16_t * pBytesRead     /**< [Out] number of bytes read. */
                                   );
 
+/**
+* \brief ISO Read Binary with extended length Le
+*
+* Same as #phalMfdf_IsoReadBinary but codes Le on three bytes so that up to
+* 65536 bytes can be requested with one command. The PICC has to support
+* extended length APDUs (e.g. a Type 4 Tag announcing MLe > 255 in its CC).
+* The response has to fit into the HAL receive buffer, otherwise
+* #PH_ERR_SUCCESS_CHAINING is returned and the function has to be recalled with
+* #PH_EXCHANGE_RXCHAINING.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_SUCCESS_CHAINING operation success with chaining.
+* \retval Other Depending on implementation and underlying component.
+*/
+phStatus_t phalMfdf_IsoReadBinaryExt(
+                                     void * pDataParams,       /**< [In] Pointer to this layers param structure. */
+                                     uint16_t wOption,         /**< [In] #PH_EXCHANGE_DEFAULT or #PH_EXCHANGE_RXCHAINING. */
+                                     uint8_t bOffset,          /**< [In] Offset from where to read. */
+                                     uint8_t bSfid,            /**< [In] Short ISO File Id.
+                                                                         Bit 7 should be 1 to indicate Sfid is supplied.
+                                                                         Else it is treated as MSB of 2Byte offset. */
+                                     uint16_t wBytesToRead,    /**< [In] number of bytes to read. If 0, then entire file to be read. */
+                                     uint8_t ** ppRxBuffer,    /**< [Out] buffer where the read bytes will be stored. */
+                                     uint16_t * pBytesRead     /**< [Out] number of bytes read. */
+                                     );
+
 /**
 * \brief Iso Update Binary
 *
@@ -102,6 +102,33 @@ phStatus_t phalMful_Sw_Init(
 #define PHAL_MFUL_DES_KEY_LENGTH    16U     /**< Length of an MIFARE(R) Ultralight DES key. */
 /*@}*/
 
+/**
+* \name NTAG I2C plus pass-through definitions
+*/
+/*@{*/
+#define PHAL_MFUL_SRAM_LENGTH               64U     /**< Length of the NTAG I2C plus SRAM pass-through window. */
+#define PHAL_MFUL_SRAM_START_ADDR           0xF0U   /**< First page of the SRAM window in sector 0. */
+#define PHAL_MFUL_SRAM_END_ADDR             0xFFU   /**< Last page of the SRAM window in sector 0. */
+#define PHAL_MFUL_SESSION_REG_ADDR          0xECU   /**< First page of the session registers in sector 0. */
+#define PHAL_MFUL_NC_REG_PTHRU_ON_OFF       0x40U   /**< NC_REG bit: pass-through mode enabled. */
+#define PHAL_MFUL_NC_REG_TRANSFER_DIR       0x01U   /**< NC_REG bit: set for RF to I2C, cleared for I2C to RF. */
+#define PHAL_MFUL_NS_REG_SRAM_I2C_READY     0x10U   /**< NS_REG bit: SRAM data ready to be read by the I2C host. */
+#define PHAL_MFUL_NS_REG_SRAM_RF_READY      0x08U   /**< NS_REG bit: SRAM data ready to be read by RF. */
+/*@}*/
+
+/**
+* \brief Statistics of a pass-through transfer.
+*
+* The transfer time is not measured by the library; divide \c dwNumBytes by the
+* time the application measured around the call to get the throughput.
+*/
+typedef struct
+{
+    uint32_t dwNumBytes;    /**< Number of payload bytes transferred. */
+    uint16_t wNumFrames;    /**< Number of SRAM frames transferred. */
+    uint32_t dwNumPolls;    /**< Number of session register reads, one per frame plus the ones waiting for the I2C host. */
+} phalMful_PassThroughStats_t;
+
 #ifdef NXPRDLIB_REM_GEN_INTFS
 #include "../comps/phalMful/src/Sw/phalMful_Sw.h"
 
@@ -141,6 +168,15 @@ phStatus_t phalMful_Sw_Init(
 #define phalMful_ChkTearingEvent(pDataParams, bCntNum, pValidFlag) \
         phalMful_Sw_ChkTearingEvent((phalMful_Sw_DataParams_t *)pDataParams, bCntNum, pValidFlag)
 
+#define phalMful_FastWrite(pDataParams, bStartAddr, bEndAddr, pData) \
+        phalMful_Sw_FastWrite((phalMful_Sw_DataParams_t *)pDataParams, bStartAddr, bEndAddr, pData)
+
+#define phalMful_PassThroughWrite(pDataParams, pData, wDataLength, wMaxPolls, pStats) \
+        phalMful_Sw_PassThroughWrite((phalMful_Sw_DataParams_t *)pDataParams, pData, wDataLength, wMaxPolls, pStats)
+
+#define phalMful_PassThroughRead(pDataParams, pData, wDataLength, wMaxPolls, pStats) \
+        phalMful_Sw_PassThroughRead((phalMful_Sw_DataParams_t *)pDataParams, pData, wDataLength, wMaxPolls, pStats)
+
 #else
 
 /**
@@ -284,6 +320,66 @@ phStatus_t phalMful_ChkTearingEvent(
                                     uint8_t * pValidFlag    /**< [Out] Address of one byte containing the valid flag byte */
                                     );
 
+/**
+* \brief Perform NTAG I2C plus fast write command with Picc.
+*
+* Writes up to #PHAL_MFUL_SRAM_LENGTH bytes in one frame; the tag only accepts it
+* for the SRAM pages.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid address range.
+* \retval Other Depending on implementation and underlying component.
+*/
+phStatus_t phalMful_FastWrite(
+                              void * pDataParams,     /**< [In] Pointer to this layer's parameter structure. */
+                              uint8_t bStartAddr,     /**< [In] One byte start address */
+                              uint8_t bEndAddr,       /**< [In] One byte end address */
+                              uint8_t * pData         /**< [In] (bEndAddr - bStartAddr + 1) * 4 bytes to be written. */
+                              );
+
+/**
+* \brief Stream data to the I2C host through the NTAG I2C plus SRAM.
+*
+* The I2C host has to enable pass-through mode with the RF to I2C direction.
+* The data is sent in #PHAL_MFUL_SRAM_LENGTH byte frames with the fast write
+* command, a shorter last frame is padded with zeros. Before each frame the
+* session registers are polled until the I2C host has read the previous frame.
+* Full frames are sent directly from \c pData.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_USE_CONDITION Pass-through mode is off or set to the other direction.
+* \retval #PH_ERR_IO_TIMEOUT The I2C host did not read a frame within \c wMaxPolls polls.
+* \retval Other Depending on implementation and underlying component.
+*/
+phStatus_t phalMful_PassThroughWrite(
+                                     void * pDataParams,                    /**< [In] Pointer to this layer's parameter structure. */
+                                     uint8_t * pData,                       /**< [In] Data to be sent. */
+                                     uint16_t wDataLength,                  /**< [In] Number of bytes to be sent. */
+                                     uint16_t wMaxPolls,                    /**< [In] Maximum number of session register polls per frame. */
+                                     phalMful_PassThroughStats_t * pStats   /**< [Out] Statistics of the transfer. */
+                                     );
+
+/**
+* \brief Stream data from the I2C host through the NTAG I2C plus SRAM.
+*
+* The I2C host has to enable pass-through mode with the I2C to RF direction.
+* Before each frame the session registers are polled until the I2C host has
+* filled the SRAM, then the frame is read with the fast read command. Reading
+* the last SRAM page hands the SRAM back to the I2C host.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_USE_CONDITION Pass-through mode is off or set to the other direction.
+* \retval #PH_ERR_IO_TIMEOUT The I2C host did not provide a frame within \c wMaxPolls polls.
+* \retval Other Depending on implementation and underlying component.
+*/
+phStatus_t phalMful_PassThroughRead(
+                                    void * pDataParams,                     /**< [In] Pointer to this layer's parameter structure. */
+                                    uint8_t * pData,                        /**< [Out] Buffer receiving the data. */
+                                    uint16_t wDataLength,                   /**< [In] Number of bytes to be received. */
+                                    uint16_t wMaxPolls,                     /**< [In] Maximum number of session register polls per frame. */
+                                    phalMful_PassThroughStats_t * pStats    /**< [Out] Statistics of the transfer. */
+                                    );
+
 /** @} */
 
 #endif /* NXPRDLIB_REM_GEN_INTFS */
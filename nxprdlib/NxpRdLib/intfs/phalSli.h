@@ -47,6 +47,9 @@ typedef struct
 {
     uint16_t wId;                   /**< Layer ID for this component, NEVER MODIFY! */
     void * pPalSli15693DataParams;  /**< Pointer to palSli15693 parameter structure. */
+    uint8_t bFamily;                /**< ICode family found by \ref phalSli_DetectFamily; one of the PHAL_SLI_FAMILY_* values. */
+    uint8_t bFastMode;              /**< Whether \ref phalSli_ReadBlocks uses the fast mode. */
+    void * pAlI15693DataParams;     /**< Pointer to alI15693 parameter structure used for the standard block commands; set by the application. */
 } phalSli_Sw_DataParams_t;
 
 /**
@@ -117,6 +120,17 @@ phStatus_t phalSli_Sw_Init(
 #define PHAL_SLI_PROTECTION_BIT_PROT_LOCK       0x08U   /**< Page protection is locked. */
 /*@}*/
 
+/**
+* \name ICode families
+*/
+/*@{*/
+#define PHAL_SLI_FAMILY_UNKNOWN     0x00U   /**< No NXP ICode tag; only the standard ISO15693 commands are used. */
+#define PHAL_SLI_FAMILY_SLI         0x01U   /**< ICode SLI, SLI-S or SLI-L. */
+#define PHAL_SLI_FAMILY_SLIX        0x02U   /**< ICode SLIX, SLIX-S or SLIX-L. */
+#define PHAL_SLI_FAMILY_SLIX2       0x03U   /**< ICode SLIX2. */
+#define PHAL_SLI_FAMILY_DNA         0x04U   /**< ICode DNA. */
+/*@}*/
+
 #ifdef NXPRDLIB_REM_GEN_INTFS
 #include "../comps/phalSli/src/Sw/phalSli_Sw.h"
 
@@ -180,6 +194,21 @@ phStatus_t phalSli_Sw_Init(
 #define phalSli_GetRandomNumberSetPWD(pDataParams, bPwdIdentifier, pPwd) \
         phalSli_Sw_GetRandomNumberSetPWD((phalSli_Sw_DataParams_t *)pDataParams, bPwdIdentifier, pPwd)
 
+#define phalSli_DetectFamily(pDataParams, pFamily) \
+        phalSli_Sw_DetectFamily((phalSli_Sw_DataParams_t *)pDataParams, pFamily)
+
+#define phalSli_SetFastMode(pDataParams, bFastMode) \
+        phalSli_Sw_SetFastMode((phalSli_Sw_DataParams_t *)pDataParams, bFastMode)
+
+#define phalSli_GetFastMode(pDataParams, pFastMode) \
+        phalSli_Sw_GetFastMode((phalSli_Sw_DataParams_t *)pDataParams, pFastMode)
+
+#define phalSli_ReadBlocks(pDataParams, bBlockNo, wNumBlocks, pData, pDataLength) \
+        phalSli_Sw_ReadBlocks((phalSli_Sw_DataParams_t *)pDataParams, bBlockNo, wNumBlocks, pData, pDataLength)
+
+#define phalSli_WriteBlocks(pDataParams, bBlockNo, wNumBlocks, pData) \
+        phalSli_Sw_WriteBlocks((phalSli_Sw_DataParams_t *)pDataParams, bBlockNo, wNumBlocks, pData)
+
 #else
 
 
@@ -478,6 +507,96 @@ phStatus_t phalSli_GetRandomNumberSetPWD(
     uint8_t * pPwd             /**< [In] Password; 32 bits. */
     );
 
+/**
+* \brief Identify the ICode family of the addressed tag and select the fast mode for it.
+*
+* The family is taken from the manufacturer code, the IC type and the type bits
+* of the UID stored in the \ref phpalSli15693 layer. Tags of other manufacturers
+* and NXP tags with another IC type are reported as #PHAL_SLI_FAMILY_UNKNOWN.
+* ICode tags answering \ref phalSli_GetNxpSystemInfo are reported as SLIX2 or
+* DNA, all others as SLI or SLIX. For every ICode family the fast mode is
+* enabled; for #PHAL_SLI_FAMILY_UNKNOWN it is disabled.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlying component.
+*/
+phStatus_t phalSli_DetectFamily(
+    void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t * pFamily      /**< [Out] Detected family; one of the PHAL_SLI_FAMILY_* values. */
+    );
+
+/**
+* \brief Enable or disable the fast mode of \ref phalSli_ReadBlocks.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_USE_CONDITION Fast mode requested but no ICode family detected.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid bFastMode value.
+*/
+phStatus_t phalSli_SetFastMode(
+    void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t bFastMode      /**< [In] \c #PH_ON: use the fast mode; \c #PH_OFF: use the standard commands. */
+    );
+
+/**
+* \brief Retrieve whether the fast mode is currently in use.
+*
+* The fast mode is disabled automatically when a fast read fails.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phalSli_GetFastMode(
+    void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t * pFastMode    /**< [Out] \c #PH_ON if the fast mode is in use, otherwise \c #PH_OFF. */
+    );
+
+/**
+* \brief Read one or more blocks from the addressed tag.
+*
+* In fast mode the blocks are read with the FAST INVENTORY READ command, using
+* the complete UID as mask, so that the tag answers with twice the high ISO15693
+* data rate. If the fast command fails (e.g. the tag is in the quiet state) the
+* fast mode is disabled and the blocks are read again with
+* \ref phalI15693_ReadMultipleBlocks using the current \ref phpalSli15693 flags.
+* pData must hold \c wNumBlocks * #PHAL_SLI_BLOCK_SIZE bytes.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid block range.
+* \retval #PH_ERR_USE_CONDITION pAlI15693DataParams is not set.
+* \retval #PH_ERR_PROTOCOL_ERROR Unexpected response length.
+* \retval Other Depending on implementation and underlying component.
+*/
+phStatus_t phalSli_ReadBlocks(
+    void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t bBlockNo,        /**< [In] First block to read. */
+    uint16_t wNumBlocks,     /**< [In] Number of blocks to read. */
+    uint8_t * pData,         /**< [Out] Received block data. */
+    uint16_t * pDataLength   /**< [Out] Number of received data bytes. */
+    );
+
+/**
+* \brief Write one or more blocks to the addressed tag.
+*
+* ICode tags have no fast write command, so every block is written with
+* \ref phalI15693_WriteSingleBlock using the current \ref phpalSli15693 flags,
+* independent of the fast mode.
+* pData must hold \c wNumBlocks * #PHAL_SLI_BLOCK_SIZE bytes.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid block range.
+* \retval #PH_ERR_USE_CONDITION pAlI15693DataParams is not set.
+* \retval Other Depending on implementation and underlying component.
+*/
+phStatus_t phalSli_WriteBlocks(
+    void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t bBlockNo,        /**< [In] First block to write. */
+    uint16_t wNumBlocks,     /**< [In] Number of blocks to write. */
+    uint8_t * pData          /**< [In] Block data to write. */
+    );
+
 /** @} */
 
 #endif /* NXPRDLIB_REM_GEN_INTFS */
@@ -67,8 +67,28 @@ extern "C" {
 #define PHAL_TOP_ERR_UNSUPPORTED_TAG               (PH_ERR_CUSTOM_BEGIN + 0x06)     /**< Tag with unsupported structure/format. */
 #define PHAL_TOP_ERR_EMPTY_NDEF                    (PH_ERR_CUSTOM_BEGIN + 0x07)     /**< NDEF message length is zero (i.e. Tag in initialized state). */
 #define PHAL_TOP_ERR_NON_NDEF_TAG                  (PH_ERR_CUSTOM_BEGIN + 0x08)     /**< Tag is not NDEF formatted. */
+#define PHAL_TOP_ERR_VERIFY                        (PH_ERR_CUSTOM_BEGIN + 0x09)     /**< Data read back after write does not match written data. */
 /** @} */
 
+#define PHAL_TOP_CACHE_LINE_SIZE                 0x04U        /**< Tag image cache line size in bytes */
+#define PHAL_TOP_CACHE_MAX_UID_LENGTH            0x0AU        /**< Max. UID length used as tag image cache key */
+#define PHAL_TOP_CACHE_T4T_CC_LENGTH             0x0FU        /**< Length of the T4T capability container kept across sessions */
+
+/**
+* \brief Tag memory image cache parameter structure
+*/
+typedef struct phalTop_Sw_Cache
+{
+    uint8_t * pImage;                                             /**< Tag memory image; NULL if cache is disabled */
+    uint8_t * pValid;                                             /**< Valid bitmap, one bit per cache line of pImage */
+    uint16_t wImageSize;                                          /**< Size of tag memory image in bytes */
+    uint8_t aUid[PHAL_TOP_CACHE_MAX_UID_LENGTH];                  /**< UID of cached tag */
+    uint8_t bUidLength;                                           /**< Length of aUid; 0 if no tag is cached */
+    uint8_t aT4TCc[PHAL_TOP_CACHE_T4T_CC_LENGTH];                 /**< CC file of the last checked T4T; kept by Reset */
+    uint8_t aT4TUid[PHAL_TOP_CACHE_MAX_UID_LENGTH];               /**< UID of the T4T aT4TCc belongs to */
+    uint8_t bT4TUidLength;                                        /**< Length of aT4TUid; 0 if no CC is cached */
+}phalTop_Sw_Cache_t;
+
 #ifdef NXPBUILD__PHAL_T1T_SW
 /**
 * \brief T1T Lock Control TLV parameter structure
@@ -178,6 +198,7 @@ typedef struct phalTop_T1T
 typedef struct phalTop_T2T
 {
     void * pAlT2TDataParams;                                                     /**< Pointer to T2T data parameters */
+    phalTop_Sw_Cache_t * pCache;                                                 /**< Pointer to tag image cache */
     uint8_t bRwa;                                                                /**< Tag read/write size */
     uint8_t bTms;                                                                /**< Tag Memory size */
     uint8_t bTagMemoryType;                                                      /**< Tag memory type (static or dynamic) */
@@ -188,6 +209,8 @@ typedef struct phalTop_T2T
     phalTop_T2T_MemCtrlTlv_t asMemCtrlTlv[PHAL_TOP_T2T_MAX_MEM_CTRL_TLV];        /**< Memory TLV details for each TLV present */
     phalTop_T2T_LockCtrlTlv_t asLockCtrlTlv[PHAL_TOP_T2T_MAX_LOCK_CTRL_TLV];     /**< Lock TLV details for each TLV present */
     phalTop_T2T_Sector_t sSector;                                                /**< Current segment details */
+    uint8_t bFastRead;                                                           /**< FAST_READ detection enabled (\ref PHAL_TOP_CONFIG_T2T_FAST_READ) */
+    uint8_t bFastReadSupported;                                                  /**< FAST_READ supported by tag; detected in CheckNdef */
 }phalTop_T2T_t;
 #endif /* NXPBUILD__PHAL_MFUL_SW */
 
@@ -231,6 +254,7 @@ typedef struct phalTop_T4T
 typedef struct phalTop_T5T
 {
     void *  pAlI15693DataParams;                                                  /**< Pointer to T5T data parameters */
+    phalTop_Sw_Cache_t * pCache;                                                  /**< Pointer to tag image cache */
     uint8_t bRwa;                                                                /**< Tag read/write size */
     uint8_t bTerminatorTlvPresence;                                              /**< Terminator TLV presence; 1 -present, 0 - not present */
     uint8_t bMbRead;                                                             /**< Flag Bit for Multiple Read support */
@@ -238,6 +262,8 @@ typedef struct phalTop_T5T
     uint8_t bSplFrm;                                                             /**< Flag Bit for special frame support */
     uint8_t bExtendedCommandSupport;                                             /**< Flag Bit for Extended Command Support support */
     uint8_t bOptionFlag;                                                         /**< Option Flag PH_ON = Enable, PH_OFF = Disable */
+    uint8_t bMbWrite;                                                            /**< Use Write Multiple Blocks command; PH_ON = Enable, PH_OFF = Disable */
+    uint8_t bWriteVerify;                                                        /**< Read back and compare written blocks; PH_ON = Enable, PH_OFF = Disable */
     uint16_t wMlen;                                                              /**< Tag Memory size */
     uint16_t wNdefHeaderAddr;                                                    /**< Header offset of first NDEF message */
     uint16_t wNdefMsgAddr;                                                       /**< NDEF message start address */
@@ -263,6 +289,7 @@ typedef struct  phalTop_Sw_DataParams
     void * pT3T;                                  /**< Pointer to T3T parameter structure */
     void * pT4T;                                  /**< Pointer to T4T parameter structure */
     void * pT5T;                                  /**< Pointer to T5T parameter structure */
+    phalTop_Sw_Cache_t sCache;                    /**< Tag memory image cache shared by T2T and T5T */
 }phalTop_Sw_DataParams_t;
 
 /**
@@ -322,6 +349,7 @@ phStatus_t phalTop_Sw_Init(
 #define PHAL_TOP_CONFIG_T1T_TERMINATOR_TLV          0x05U                /**< Set Terminator TLV presence. Set before format/write operation to enable writing terminator TLV at end of NDEF TLV. */
 
 #define PHAL_TOP_CONFIG_T2T_TMS                     0x09U                /**< Set tag memory size. Set before format operation. */
+#define PHAL_TOP_CONFIG_T2T_FAST_READ               0x0AU                /**< Enable/Disable FAST_READ detection (GET_VERSION) in CheckNdef; Get if FAST_READ is used. Enable only if tags not supporting GET_VERSION are re-activated on error. Default disabled. */
 
 #define PHAL_TOP_CONFIG_T4T_NDEF_FILE_ID            0x15U                /**< Set NDEF file ID. Set before format operation. */
 #define PHAL_TOP_CONFIG_T4T_NDEF_FILE_SIZE          0x18U                /**< Set Max NDEF length. Set before format operation. */
@@ -334,6 +362,8 @@ phStatus_t phalTop_Sw_Init(
 #define PHAL_TOP_CONFIG_T5T_SPL_FRM                 0x22U                /**< Set T5T special frame support. Set before format operation. */
 #define PHAL_TOP_CONFIG_T5T_OPTION_FLAG             0x26U                /**< Set T5T option Flag. Set before format operation. */
 #define PHAL_TOP_CONFIG_T5T_TERMINATOR_TLV          0x1FU                /**< Set Terminator TLV presence. Set before format/write operation to enable writing terminator TLV at end of NDEF TLV. */
+#define PHAL_TOP_CONFIG_T5T_MBWRITE                 0x23U                /**< Enable/Disable use of Write Multiple Blocks in WriteNdef. Disabled automatically if tag rejects the command. Default disabled. */
+#define PHAL_TOP_CONFIG_T5T_WRITE_VERIFY            0x24U                /**< Enable/Disable read back verification of blocks written by WriteNdef. Default disabled. */
 /*@}*/
 
 /**
@@ -367,6 +397,9 @@ phStatus_t phalTop_Sw_Init(
 #define phalTop_Reset(pDataParams) \
         phalTop_Sw_Reset( (phalTop_Sw_DataParams_t *)pDataParams)
 
+#define phalTop_SetCache(pDataParams, pBuffer, wBufferSize, pUid, bUidLength) \
+        phalTop_Sw_SetCache( (phalTop_Sw_DataParams_t *)pDataParams, pBuffer, wBufferSize, pUid, bUidLength)
+
 #define  phalTop_SetConfig(pDataParams, wConfig, wValue) \
          phalTop_Sw_SetConfig( (phalTop_Sw_DataParams_t *)pDataParams, wConfig, wValue)
 
@@ -477,7 +510,8 @@ phStatus_t phalTop_CheckNdef(
 * \brief Reset Tag Operation parameters
 *
 * User has to call phalTop_Reset to reset all the Software parameters. This shall
-* be called after performing all NDEF operations if needed.
+* be called after performing all NDEF operations if needed. The tag image cache
+* is invalidated, the cached T4T capability container is kept.
 *
 * \return Status code
 * \retval #PH_ERR_SUCCESS Operation successful.
@@ -486,6 +520,40 @@ phStatus_t phalTop_Reset(
     void * pDataParams            /**< [In] Pointer to this layer's parameter structure. */
     );
 
+/**
+* \brief Enable tag memory image cache for the activated tag.
+*
+* With the cache enabled, T2T and T5T blocks read from the tag are kept in an
+* image of the tag memory. Later reads of these blocks by CheckNdef, ReadNdef,
+* WriteNdef etc. are served from the image, and writes of blocks whose content
+* is unchanged are skipped. Writes go to the tag immediately (write through),
+* so the NFC Forum write order is kept if the tag is removed.
+*
+* Shall be called after each activation with the UID of the tag. If the UID
+* differs from the cached tag, the image is invalidated. \ref phalTop_Reset,
+* called on deactivation, also invalidates the image. The tag must not be
+* modified by other means while it is cached.
+*
+* About 1/33 of pBuffer is used for the valid bitmap; the rest holds the
+* image starting at tag address 0. Blocks beyond the image are not cached.
+*
+* For T4T the UID is also used when pBuffer is NULL: the capability container
+* read by CheckNdef is kept across \ref phalTop_Reset, and a later CheckNdef
+* of the same tag skips selecting and reading the CC file. FormatNdef drops
+* the cached CC.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER UID is too long.
+*/
+phStatus_t phalTop_SetCache(
+    void * pDataParams,           /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t * pBuffer,            /**< [In] Cache buffer; NULL to disable the cache. */
+    uint16_t wBufferSize,         /**< [In] Size of pBuffer. */
+    uint8_t * pUid,               /**< [In] UID of the activated tag. */
+    uint8_t bUidLength            /**< [In] Length of pUid; max. #PHAL_TOP_CACHE_MAX_UID_LENGTH. */
+    );
+
 /**
 * \brief Erase a valid NDEF message with an empty NDEF.
 *
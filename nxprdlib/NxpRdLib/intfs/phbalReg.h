@@ -61,6 +61,13 @@ typedef struct
     uint16_t       wId;         /**< Layer ID for this BAL component, NEVER MODIFY! */
     uint16_t       wHalType;    /**< HAL HW type (Rc523, Rc663, ... ) */
     uint8_t        bMultiRegRW; /**< Flag to indicate Multiple Register Read or Write. */
+    uint16_t       wSpiBus;     /**< SPI bus number of the port used by this instance. */
+    uint16_t       wSpiCsPin;   /**< SPI chip select number of the port used by this instance. */
+    uint16_t       wBusyPin;    /**< GPIO number of the busy line (PN5180 only). */
+    int32_t        dwSpiFd;     /**< Handle of the opened SPI port, -1 if closed. */
+    int32_t        dwBusyPinFd; /**< Handle of the opened busy line, -1 if closed. */
+    uint32_t       dwTxBytes;   /**< Number of bytes sent on the bus since initialisation. */
+    uint32_t       dwRxBytes;   /**< Number of bytes received on the bus since initialisation. */
 } phbalReg_Stub_DataParams_t;
 
 /**
@@ -52,6 +52,55 @@ extern "C" {
  * */
 #define PHCE_T4T_MAX_PROPRIETARY_FILE     0x01U
 
+/**
+ * Maximum number of static responses supported.
+ *
+ * This defines the maximum count of static C-APDU/R-APDU pairs that can be
+ * registered using \ref phceT4T_SetStaticResponse. Static responses are
+ * answered from the reader library thread without waking the application
+ * thread. #NXPBUILD__PHCE_T4T_PROPRIETARY shall be enabled in build
+ * configuration to support static responses.
+ * */
+#define PHCE_T4T_MAX_STATIC_RESPONSE      0x04U
+
+/**
+ * Maximum number of separate updated ranges tracked per file. When more
+ * separate ranges are written, the pending ones are flushed first.
+ * */
+#define PHCE_T4T_MAX_DIRTY_RANGES         0x04U
+
+/**
+ * \brief Flush callback, called with the range of an elementary file written by
+ * UPDATE BINARY since the last flush.
+ *
+ * Set using \ref phceT4T_SetFlushCallback. Overlapping or adjacent updates of a
+ * file are merged; up to #PHCE_T4T_MAX_DIRTY_RANGES separate ranges are kept
+ * and reported one call per range, when another file is updated, when more
+ * ranges are needed, when a new NDEF file is set or when the card emulation
+ * exits. This is used to write back files that are not in RAM, for example
+ * files mapped with phPlatform_File_Map. The callback should only schedule the
+ * write back and not wait for it to complete.
+ *
+ * During emulation the callback runs on the reader library thread (the one in
+ * \ref phceT4T_Activate), also for updates written by
+ * \ref phceT4T_AppProcessCmd. Otherwise it runs on the thread calling
+ * \ref phceT4T_Reset, \ref phceT4T_SetElementaryFile or
+ * \ref phceT4T_SetFlushCallback.
+ *
+ * @param[in] pContext    Context given in \ref phceT4T_SetFlushCallback.
+ * @param[in] wFileId    ID of the updated file.
+ * @param[in] pFile    Pointer to the updated file.
+ * @param[in] dwOffset    Offset of the first updated byte.
+ * @param[in] dwLength    Length of the updated range.
+ */
+typedef phStatus_t(*phceT4T_FlushCallback_t)(
+    void *pContext,
+    uint16_t wFileId,
+    uint8_t *pFile,
+    uint32_t dwOffset,
+    uint32_t dwLength
+    );
+
 /**
 * \brief NFC Type 4A Tag card emulation parameter structure
 */
@@ -187,6 +236,44 @@ typedef struct phceT4T_Sw_DataParams
      * */
     uint32_t dwFileOffset;
 
+    /**
+     * Flush callback.
+     *
+     * Called with the updated (dirty) range of a file. Set using
+     * \ref phceT4T_SetFlushCallback, NULL if not used.
+     * */
+    phceT4T_FlushCallback_t pFlushCallback;
+
+    /**
+     * Context passed to \ref phceT4T_FlushCallback_t.
+     * */
+    void *pFlushContext;
+
+    /**
+     * File with a pending (not yet flushed) updated range, NULL if none.
+     * */
+    uint8_t *pDirtyFile;
+
+    /**
+     * Start offsets of the pending updated ranges in pDirtyFile.
+     * */
+    uint32_t aDirtyStart[PHCE_T4T_MAX_DIRTY_RANGES];
+
+    /**
+     * End offsets (exclusive) of the pending updated ranges in pDirtyFile.
+     * */
+    uint32_t aDirtyEnd[PHCE_T4T_MAX_DIRTY_RANGES];
+
+    /**
+     * Number of pending updated ranges in pDirtyFile.
+     * */
+    uint8_t bDirtyRanges;
+
+    /**
+     * ID of the file with a pending updated range.
+     * */
+    uint16_t wDirtyFileId;
+
     /**
      * ID of currently selected file.
      *
@@ -350,6 +437,44 @@ typedef struct phceT4T_Sw_DataParams
          * */
         uint16_t wContentenLen;
     }asProprietaryFile[PHCE_T4T_MAX_PROPRIETARY_FILE];
+
+    /**
+     * Number of static responses registered.
+     *
+     * Application can register static responses using
+     * \ref phceT4T_SetStaticResponse. The maximum number of static responses
+     * is limited by #PHCE_T4T_MAX_STATIC_RESPONSE.
+     * */
+    uint8_t bStaticResponseCount;
+
+    /**
+     * Structure to hold the static responses (response cache).
+     *
+     * \b Note: <em>To use static responses, #NXPBUILD__PHCE_T4T_PROPRIETARY
+     * should be enabled in build.</em>
+     * */
+    struct phceT4T_Sw_StaticResponse
+    {
+        /**
+         * C-APDU (or leading part of C-APDU) to be matched.
+         * */
+        uint8_t *pCApdu;
+
+        /**
+         * Length of C-APDU to be matched.
+         * */
+        uint16_t wCApduLen;
+
+        /**
+         * R-APDU to be sent, including the status word (SW1 SW2).
+         * */
+        uint8_t *pRApdu;
+
+        /**
+         * Length of R-APDU including the status word.
+         * */
+        uint16_t wRApduLen;
+    }asStaticResponse[PHCE_T4T_MAX_STATIC_RESPONSE];
 #endif /* NXPBUILD__PHCE_T4T_PROPRIETARY */
 }phceT4T_Sw_DataParams_t;
 
@@ -622,6 +747,17 @@ phStatus_t phceT4T_Sw_Init(
  * is not in a valid state to execute these APIs.
  * */
 #define PH_CE_T4T_INVALID_STATE          (PH_ERR_CUSTOM_BEGIN + 0x05U)
+
+/**
+ * Static response found for the received command.
+ *
+ * This status code is returned by \ref phceT4T_ProcessCmd when the received
+ * C-APDU matches a static response registered using
+ * \ref phceT4T_SetStaticResponse. The data field of the R-APDU is returned in
+ * ppTxData and the status word in pStatusWord. No application processing is
+ * required.
+ * */
+#define PH_CE_T4T_STATIC_RESPONSE        (PH_ERR_CUSTOM_BEGIN + 0x06U)
 /*@}*/
 
 /**
@@ -884,6 +1020,28 @@ typedef phStatus_t(*phceT4T_AppCallback_t)(
                                   dwFileSize,                               \
                                   dwContentLen)
 
+#define phceT4T_SetStaticResponse(              \
+                                  pDataParams,  \
+                                  pCApdu,       \
+                                  wCApduLen,    \
+                                  pRApdu,       \
+                                  wRApduLen)    \
+     phceT4T_Sw_SetStaticResponse(                                          \
+                                  (phceT4T_Sw_DataParams_t *)pDataParams,   \
+                                  pCApdu,                                   \
+                                  wCApduLen,                                \
+                                  pRApdu,                                   \
+                                  wRApduLen)
+
+#define phceT4T_SetFlushCallback(               \
+                                 pDataParams,   \
+                                 pFlushCallback,\
+                                 pContext)      \
+     phceT4T_Sw_SetFlushCallback(                                           \
+                                 (phceT4T_Sw_DataParams_t *)pDataParams,    \
+                                 pFlushCallback,                            \
+                                 pContext)
+
 #define phceT4T_ProcessCmd(                 \
                            pDataParams,     \
                            wOption,         \
@@ -973,6 +1131,11 @@ typedef phStatus_t(*phceT4T_AppCallback_t)(
 * created first. Followed by NDEF file #PHCE_T4T_FILE_NDEF. Proprietary file(s)
 * are optional.
 *
+* Files are referenced, not copied. The NDEF file can be replaced by setting it
+* again while card emulation is not active (before \ref phceT4T_Activate or
+* after \ref phceT4T_Reset), for example to swap between memory mapped files
+* without copying their content.
+*
 * @param[in] pDataParams    Pointer to this layer's parameter structure \ref
 * phceT4T_Sw_DataParams_t.
 *
@@ -1013,6 +1176,82 @@ phStatus_t phceT4T_SetElementaryFile(
     uint32_t dwContentLen
     );
 
+/**
+* \brief Register a static response (response cache entry).
+*
+* Static responses are answered by \ref phceT4T_ProcessCmd from the reader
+* library thread, without waking the application thread. This shall be used
+* for commands whose response never changes (for example SELECT of a
+* proprietary application or a fixed GET DATA) so that the response time does
+* not depend on scheduling of the application thread.
+*
+* A received (non chained) C-APDU matches an entry if it starts with the
+* registered C-APDU. Entries are checked before the built-in handling of
+* SELECT, READ BINARY and UPDATE BINARY and do not change the tag state.
+* Registered buffers are referenced, not copied, and shall remain valid until
+* the entries are removed.
+*
+* @param[in] pDataParams    Pointer to this layer's parameter structure \ref
+* phceT4T_Sw_DataParams_t.
+*
+* @param[in] pCApdu    C-APDU (or leading part of the C-APDU) to be matched.
+* If set to NULL, all registered static responses are removed.
+*
+* @param[in] wCApduLen    Length of pCApdu. Shall be at least 4 (CLA, INS, P1
+* and P2).
+*
+* @param[in] pRApdu    R-APDU to be sent, ending with the status word (SW1 SW2).
+*
+* @param[in] wRApduLen    Length of pRApdu including the status word. Shall be
+* at least 2.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER  Parameter value is invalid.
+* \retval #PH_ERR_BUFFER_OVERFLOW #PHCE_T4T_MAX_STATIC_RESPONSE entries are
+*         already registered.
+* \retval #PH_ERR_INVALID_DATA_PARAMS Invalid data parameter. The provided data
+*         parameter (pDataParams) is invalid or this layer is not
+*         \ref initialization "initialized".
+*/
+phStatus_t phceT4T_SetStaticResponse(
+    void *pDataParams,
+    uint8_t *pCApdu,
+    uint16_t wCApduLen,
+    uint8_t *pRApdu,
+    uint16_t wRApduLen
+    );
+
+/**
+* \brief Set the callback used to flush updated ranges of elementary files.
+*
+* Ranges written by UPDATE BINARY are tracked as dirty ranges and reported to
+* the callback \ref phceT4T_FlushCallback_t outside of the command/response
+* path. Tracking is done on the reader library thread only: ranges handled by
+* \ref phceT4T_AppProcessCmd (by its default handling or by the application
+* callback) are recorded by the reader library thread once the response is
+* handed back, so no locking is needed. Shall not be called while
+* \ref phceT4T_Activate is running.
+*
+* @param[in] pDataParams    Pointer to this layer's parameter structure \ref
+* phceT4T_Sw_DataParams_t.
+*
+* @param[in] pFlushCallback    Flush callback, NULL to disable tracking.
+*
+* @param[in] pContext    Context passed to the flush callback.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_DATA_PARAMS Invalid data parameter. The provided data
+*         parameter (pDataParams) is invalid or this layer is not
+*         \ref initialization "initialized".
+*/
+phStatus_t phceT4T_SetFlushCallback(
+    void *pDataParams,
+    phceT4T_FlushCallback_t pFlushCallback,
+    void *pContext
+    );
+
 /**
 * \brief Activate T4T card emulation functionality.
 *
@@ -1192,6 +1431,7 @@ phStatus_t phceT4T_Activate(
 * \retval #PH_CE_T4T_UPDATE_BINARY Update Binary received or file updated
 *         (if #PHCE_T4T_CONFIG_HANDLE_UPDATEBINARY is enabled).
 * \retval #PH_CE_T4T_PROPRIETARY Proprietary C-APDU received.
+* \retval #PH_CE_T4T_STATIC_RESPONSE C-APDU answered from a static response.
 * \retval #PH_CE_T4T_FAILURE Unsupported C-APDU / Error. Check status word
 *         (pStatusWord) to get the actual type of error.
 * \retval #PH_ERR_INVALID_DATA_PARAMS Invalid data parameter. The provided data
@@ -96,16 +96,23 @@ typedef struct phlnLlcp_Transport_Socket{
     struct phlnLlcp_Transport_Socket  *pNext;                                                /**< Pointer to the next Registered Socket. */
     uint8_t                           *pUri;                                                 /**< Pointer to URI (Uniform Resource Identifier). */
     uint32_t                           dwBufLen;                                             /**< The size of the Socket Rx Buffer. */
-    uint8_t                           *pbRxBuffer;                                           /**< Pointer to the Socket Rx buffer. Size of the Socket Buffer should be less than or
-                                                                                                  equal to 248 Bytes and less than HAL Rx Buffer.
-                                                                                                  Note: To achieve better performance Socket Buffer Size should be multiple of 248. */
+    uint8_t                           *pbRxBuffer;                                           /**< Pointer to the Socket Rx buffer. First #PHLN_LLCP_MIU bytes hold the received Packet, the
+                                                                                                  remaining bytes are used as receive ring of (#PHLN_LLCP_MIU + 2) bytes slots.
+                                                                                                  Note: To achieve better performance Socket Buffer Size should be multiple of 250. */
     uint32_t                           dwLength;                                             /**< Length of the data received. */
     uint16_t                           wRMiu;                                                /**< Remote Link's MIU. */
+    uint16_t                           wLMiu;                                                /**< Local MIU of the data link, derived from the Socket Rx Buffer size. */
     /**
      * Ready to receive flag.
-     * <b>Note</b>: This Flag needs to be set 'True' by the Application after each Socket Receive to receive next Packet as RW (Receive Window) is 1.
+     * <b>Note</b>: This Flag needs to be set 'True' by the Application after each Socket Receive to receive next Packet.
+     * I PDUs received while this flag is 'False' are held in the Socket receive ring (see #PHLN_LLCP_RW_MAX).
      */
     uint8_t                            fReady;
+    uint8_t                            bLRw;                                                 /**< Local Receive Window (RW) advertised in CONNECT/CC PDU. */
+    uint8_t                            bRRw;                                                 /**< Remote Receive Window (RW) received in CONNECT/CC PDU. */
+    uint8_t                            bRxHead;                                              /**< Index of the next I PDU to be delivered from the Socket receive ring. */
+    uint8_t                            bRxTail;                                              /**< Index of the next free slot in the Socket receive ring. */
+    uint8_t                            fTxWait;                                              /**< Set while a Send call waits for the Transmit Window to be opened by the Peer. */
     phlnLlcp_Transport_Socket_Type_t   eSocketType;                                          /**< Based on this, I PDU (Connection-Oriented) or UI PDU (Connection-Less) will be sent. */
     phStatus_t                         wStatus;                                              /**< Determines the status of the Socket. */
     uint8_t                            bLsap;                                                /**< Local SAP (Service Access Point) address. */
@@ -131,6 +138,7 @@ typedef struct phlnLlcp_LMDataParams{
     uint8_t bOpt;                                                                            /**< Option. */
     uint16_t wMiu;                                                                           /**< maximum information unit (MIU) is max number of octets in information field of an LLC PDU. */
     uint16_t wWks;                                                                           /**< Well-Known Service List. */
+    uint8_t bRw;                                                                             /**< Receive Window (RW) size of the data link connection. */
     uint16_t bAvailableTlv;                                                                  /**< Bit mask for TLVs availability. */
 } phlnLlcp_LMDataParams_t;
 
@@ -353,7 +361,9 @@ phStatus_t phlnLlcp_Sw_Init(
 * <b>Restriction:</b> NxpNfcRdlib cannot support MIU more than HAL Rx Buffer size.
 */
 /*@{*/
+#ifndef PHLN_LLCP_MIU
 #define PHLN_LLCP_MIU                            248                                         /**< Maximum number of bytes in the information field of an LLC PDU that the local LLC is able to receive. */
+#endif /* PHLN_LLCP_MIU */
 #define PHLN_LLCP_TLV_MIUX_VALUE                 (PHLN_LLCP_MIU - 128)                       /**< MIUX (Maximum Information Unit Extension) = Maximum Information Unit (MIU) - 128. */
 /*@}*/
 
@@ -364,12 +374,24 @@ phStatus_t phlnLlcp_Sw_Init(
 */
 #define PHLN_LLCP_SYMM_VALUE                     10
 
+/**
+* \name SYMM timeout in milli seconds used while LLC PDUs other than SYMM are exchanged.
+* The SYMM timeout is reset to this value whenever a non SYMM PDU is received and is doubled for every SYMM PDU received
+* until it reaches the SYMM timeout derived from #PHLN_LLCP_SYMM_VALUE, so that the link turns around quickly while data
+* flows and polls less often when the link is idle.
+*/
+#define PHLN_LLCP_SYMM_ACTIVE_MS                 10
+
 /**
 * \name Receive Window size of LLCP
 * Receive window size of one indicates that the local LLC will acknowledge every I PDU before accepting additional I PDUs.
-* This is fixed as per design and cannot be changed.
+* Receive window of a data link connection is derived from the Socket Rx Buffer size. It is the number of (MIU + 2) bytes
+* slots that fit in the Socket Rx Buffer after the first MIU bytes, limited to #PHLN_LLCP_RW_MAX.
 */
-#define PHLN_LLCP_TLV_RW_VALUE                   0x01
+/*@{*/
+#define PHLN_LLCP_TLV_RW_VALUE                   0x01                                        /**< Default Receive Window, used when Socket Rx Buffer can hold only one I PDU. */
+#define PHLN_LLCP_RW_MAX                         0x0F                                        /**< Maximum Receive Window as per NFCForum LLCP 1.1. */
+/*@}*/
 
 /**
 * \name LLCP Device Type.
@@ -382,10 +404,12 @@ phStatus_t phlnLlcp_Sw_Init(
 /*@}*/
 
 /**
-* \name LLCP De-Aggregation.
+* \name LLCP Aggregation and De-Aggregation.
 * Indicates whether LLCP stack supports dispatching the Aggregated LLC PDUs according to each PDUs destination and
 * Source Service Access Point (SSAP) Address.
-* If LLCP don't need to handle De-Aggregation then PHLN_LLCP_AGF flag can be set to zero. In which case code for De-Aggregation will not be complied.
+* When enabled, UI and I PDUs that are queued back to back are also packed into a single AGF PDU as long as the AGF fits
+* into the remote Link MIU, saving one symmetry exchange per packed PDU.
+* If LLCP don't need to handle Aggregation then PHLN_LLCP_AGF flag can be set to zero. In which case code for Aggregation and De-Aggregation will not be complied.
 */
 /*@{*/
 #define PHLN_LLCP_AGF                              1
@@ -657,8 +681,9 @@ phStatus_t phlnLlcp_Transport_Socket_ConnectViaUri(
 * \brief Receive is a Blocking call used to receive data on a socket.
 * Can be used by any socket type. Function blocks until dwRxBufferSize bytes have been received or an error occurred.\n
 * Once Data is received on the Socket, User need to set 'fReady' flag of the respective Socket to 'True' in-order to receive next Packet.
-* If the fReady flag is not True then the Link Management will send Receiver Not Ready (RNR) PDU to the remote SAP if it receives an Information
-* PDU for this end point.
+* If the fReady flag is not True then received Information PDUs are held in the Socket receive ring and are delivered by the next calls
+* to this API. Acknowledgement of held I PDUs is delayed until they are delivered. If the receive ring is full then the Link Management
+* will send Receiver Not Ready (RNR) PDU to the remote SAP if it receives an Information PDU for this end point.
 *
 * <em>Sequence of functions that needs to be called prior to this API are as below:</em>\n
 * 1. phlnLlcp_WaitForActivation()\n
@@ -687,6 +712,8 @@ phStatus_t phlnLlcp_Transport_Socket_Receive(
 /**
 * \brief Send is a Blocking call used to send data on a Connection-oriented socket.
 * Function blocks until complete buffer has been sent out and a RR PDU is received by \ref phlnLlcp_Activate which will signal the Semaphore.\n
+* If the Receive Window of the remote data link connection is more than one then the function returns as soon as the I PDU is sent out
+* and the number of unacknowledged I PDUs is less than the remote Receive Window.\n
 * \b wOption can be one of:\n
 * \li #PH_TRANSMIT_DEFAULT
 *
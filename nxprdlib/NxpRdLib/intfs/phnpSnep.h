@@ -144,6 +144,38 @@ typedef enum phnpSnep_Request_Codes {
     PHNP_SNEP_REQ_REJECT      = 0x7F                                       /**< Client indicates not to send remaining fragments using this request. */
 } phnpSnep_Request_Codes_t;
 
+/**
+* \brief Callback used by the streaming APIs to deliver a received NDEF message fragment.
+*
+* Called once per received LLC information field, in order, while the remaining fragments are still being received by LLCP.
+* \b pFragment is only valid until the callback returns.
+* Returning any status other than #PH_ERR_SUCCESS aborts the transfer and the status is returned by the streaming API,
+* after which the session should be De-Initialized.
+*/
+typedef phStatus_t (*pphnpSnep_RxCallback_t)(
+                                            void * pContext,                  /**< [In] Application context passed to the streaming API. */
+                                            uint8_t * pFragment,              /**< [In] Pointer to the received fragment. */
+                                            uint32_t dwFragmentLen,           /**< [In] Length of the received fragment. */
+                                            uint32_t dwOffset,                /**< [In] Offset of the fragment within the NDEF message. */
+                                            uint32_t dwMsgLen                 /**< [In] Total length of the NDEF message announced in the SNEP header. */
+                                            );
+
+/**
+* \brief Reader used by the streaming APIs to pull the NDEF message to be sent.
+*
+* Called once per LLC information field with the offset of the next bytes to be sent. The reader returns a pointer to
+* at least one and at most \b dwMaxLen bytes of the message starting at \b dwOffset, which has to stay valid until the next
+* call to the reader or until the streaming API returns.
+* Returning any status other than #PH_ERR_SUCCESS aborts the transfer and the status is returned by the streaming API.
+*/
+typedef phStatus_t (*pphnpSnep_TxReader_t)(
+                                          void * pContext,                    /**< [In] Application context passed to the streaming API. */
+                                          uint32_t dwOffset,                  /**< [In] Offset within the NDEF message of the bytes to be returned. */
+                                          uint32_t dwMaxLen,                  /**< [In] Maximum number of bytes that can be sent in this fragment. */
+                                          uint8_t ** ppData,                  /**< [Out] Pointer to the message bytes. */
+                                          uint32_t * pdwDataLen               /**< [Out] Number of bytes available at \b ppData. */
+                                          );
+
 /* Removal of generic interfaces */
 #ifdef NXPRDLIB_REM_GEN_INTFS
 #include "../comps/phnpSnep/src/Sw/phnpSnep_Sw.h"
@@ -166,6 +198,15 @@ typedef enum phnpSnep_Request_Codes {
 #define phnpSnep_ServerSendResponse( pDataParams, bClientReq,pRespDataForGet, dwRespDataLen, dwPutBuffSize, pPutData, pdwPutDataLen) \
         phnpSnep_Sw_ServerSendResponse((phnpSnep_Sw_DataParams_t *) pDataParams, bClientReq,pRespDataForGet, dwRespDataLen, dwPutBuffSize, pPutData, pdwPutDataLen)
 
+#define phnpSnep_PutStream( pDataParams, dwMsgLen, pfReader, pContext) \
+        phnpSnep_Sw_PutStream((phnpSnep_Sw_DataParams_t *) pDataParams, dwMsgLen, pfReader, pContext)
+
+#define phnpSnep_GetStream( pDataParams, pNdefMsg, dwNdefMsgLen, dwAcceptableLen, pfRxCallback, pContext, pdwRxLen) \
+        phnpSnep_Sw_GetStream((phnpSnep_Sw_DataParams_t *) pDataParams, pNdefMsg, dwNdefMsgLen, dwAcceptableLen, pfRxCallback, pContext, pdwRxLen)
+
+#define phnpSnep_ServerSendResponseStream( pDataParams, bClientReq, dwRespDataLen, pfReader, pReaderContext, dwPutMaxLen, pfRxCallback, pRxContext, pdwPutDataLen) \
+        phnpSnep_Sw_ServerSendResponseStream((phnpSnep_Sw_DataParams_t *) pDataParams, bClientReq, dwRespDataLen, pfReader, pReaderContext, dwPutMaxLen, pfRxCallback, pRxContext, pdwPutDataLen)
+
 #define phnpSnep_ClientDeInit( pDataParams) \
         phnpSnep_Sw_ClientDeInit((phnpSnep_Sw_DataParams_t *) pDataParams)
 
@@ -320,6 +361,86 @@ phStatus_t phnpSnep_ServerSendResponse(
                                        uint32_t *pdwPutDataLen             /**< [Out] Actual length of PUT Request Data received from the Client. */
                                        );
 
+/**
+* \brief Performs the SNEP PUT Request operation pulling the NDEF message from a reader.
+*
+* Same as \ref phnpSnep_Put, but the NDEF message of \b dwMsgLen bytes is not required to be in memory at once.
+* It is pulled fragment by fragment through \b pfReader, each fragment being at most the Remote MIU.
+*
+* This function has to be called after the \ref phnpSnep_ClientInit is done.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS               Operation successful.
+* \retval #PH_ERR_INVALID_DATA_PARAMS   Invalid Component ID.
+* \retval #PH_ERR_INVALID_PARAMETER     Invalid input parameters.
+* \retval #PH_ERR_PROTOCOL_ERROR        Did not receive valid response from Server.
+* \retval #PH_ERR_INTERNAL_ERROR        Reader returned no data or more than requested.
+* \retval Other                         Depending on underlying component or returned by the reader.
+*/
+phStatus_t phnpSnep_PutStream(
+                              void * pDataParams,                          /**< [In] Pointer to this layer's parameter structure. */
+                              uint32_t dwMsgLen,                           /**< [In] Total length of the NDEF message to be transmitted. */
+                              pphnpSnep_TxReader_t pfReader,               /**< [In] Reader supplying the NDEF message. */
+                              void * pContext                              /**< [In] Application context passed to \b pfReader. */
+                              );
+
+/**
+* \brief Performs the SNEP GET Request operation delivering the response through a callback.
+*
+* Same as \ref phnpSnep_Get, but the NDEF message in the Server Response is passed to \b pfRxCallback fragment by fragment
+* as it is received, so the acceptable length is not bound to an application buffer.
+*
+* This function has to be called only after the \ref phnpSnep_ClientInit is done.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS               Operation successful.
+* \retval #PH_ERR_INVALID_DATA_PARAMS   Invalid Component ID.
+* \retval #PH_ERR_INVALID_PARAMETER     Invalid input parameters.
+* \retval #PH_ERR_PROTOCOL_ERROR        Did not receive valid Response from Server.
+* \retval #PH_ERR_BUFFER_OVERFLOW       If Server Response length is more than the specified dwAcceptableLen length.
+* \retval #PH_ERR_SNEP_GET_FAILED       Received Error response from Remote Server. Client should De-Init and start new session.
+* \retval Other                         Depending on implementation, underlying component or returned by the callback.
+*/
+phStatus_t phnpSnep_GetStream(
+                              void * pDataParams,                          /**< [In] Pointer to this layer's parameter structure. */
+                              uint8_t *pNdefMsg,                           /**< [In] Pointer to the NDEF message in the Get Request to be sent to Server. */
+                              uint32_t dwNdefMsgLen,                       /**< [In] Length of the NDEF message in the Get Request to be sent to Server. */
+                              uint32_t dwAcceptableLen,                    /**< [In] Maximum acceptable data from Server. */
+                              pphnpSnep_RxCallback_t pfRxCallback,         /**< [In] Callback receiving the NDEF message in the Server Response. */
+                              void * pContext,                             /**< [In] Application context passed to \b pfRxCallback. */
+                              uint32_t *pdwRxLen                           /**< [Out] Number of bytes received from the Server. */
+                              );
+
+/**
+* \brief Used to send Response to the SNEP Request delivered by \ref phnpSnep_ServerListen, streaming the NDEF message.
+*
+* Same as \ref phnpSnep_ServerSendResponse, with the following differences:\n
+* 1. If bClientReq is PUT request, the received NDEF message is passed to \b pfRxCallback fragment by fragment as it is received.
+* PUT Requests announcing more than \b dwPutMaxLen bytes are rejected. If \b pfRxCallback is NULL the server accepts
+* GET Requests only and Not Implemented response is sent for a PUT Request.\n
+* 2. If bClientReq is GET request, the NDEF message of \b dwRespDataLen bytes sent as Response is pulled through \b pfReader.
+* If \b pfReader is NULL or dwRespDataLen is zero then Not Found response is sent.\n
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS               Operation successful.
+* \retval #PH_ERR_INVALID_DATA_PARAMS   Invalid Component ID.
+* \retval #PH_ERR_INVALID_PARAMETER     Invalid input parameters.
+* \retval #PH_ERR_BUFFER_OVERFLOW       Message in PUT is longer than dwPutMaxLen.
+* \retval #PH_ERR_PROTOCOL_ERROR        Received wrong SNEP Request from Client.
+* \retval Other                         Depending on underlying component or returned by the callback/reader.
+*/
+phStatus_t phnpSnep_ServerSendResponseStream(
+                                             void * pDataParams,                  /**< [In] Pointer to this layer's parameter structure. */
+                                             uint8_t bClientReq,                  /**< [In] Type of received Client Request. Should only be PHNP_SNEP_REQ_GET or PHNP_SNEP_REQ_PUT. */
+                                             uint32_t dwRespDataLen,              /**< [In] Data length to be transmitted to Client for GET Request. */
+                                             pphnpSnep_TxReader_t pfReader,       /**< [In] Reader supplying the data for GET Request. */
+                                             void * pReaderContext,               /**< [In] Application context passed to \b pfReader. */
+                                             uint32_t dwPutMaxLen,                /**< [In] Maximum length of PUT Request Data accepted by the application. */
+                                             pphnpSnep_RxCallback_t pfRxCallback, /**< [In] Callback receiving the PUT Request Data, NULL for GET only server. */
+                                             void * pRxContext,                   /**< [In] Application context passed to \b pfRxCallback. */
+                                             uint32_t *pdwPutDataLen              /**< [Out] Actual length of PUT Request Data received from the Client. */
+                                             );
+
 /**
 * \brief SNEP Client De-Initialization.
 * This function De-Initializes the SNEP Client session.
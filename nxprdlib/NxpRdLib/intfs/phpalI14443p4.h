@@ -59,6 +59,7 @@ typedef struct
     uint8_t   bPcbBlockNum;     /**< Current Block-Number; 0/1; */
     uint8_t   bMaxRetryCount;   /**< Maximum Retry count for ISO/IEC 14443-4:2008(E) Rule 4 and 5. */
     uint8_t   bOpeMode;         /**< Operation mode. One of NFC, EMVCo, ISO. */
+    uint8_t   bIntegrityErrors; /**< Number of integrity errors received; saturates at 0xFF. */
 } phpalI14443p4_Sw_DataParams_t;
 
 /**
@@ -102,6 +103,7 @@ phStatus_t phpalI14443p4_Sw_Init(
 #define PHPAL_I14443P4_CID_MAX          14  /**< The last valid CID. */
 #define PHPAL_I14443P4_FWI_MAX          14  /**< The maximum allowed FWI value. */
 #define PHPAL_I14443P4_FRAMESIZE_MAX    12   /**< The maximum allowed FSDI/FSCI value. */
+#define PHPAL_I14443P4_EMVCO_FRAMESIZE_MAX  8  /**< The maximum allowed FSDI value as per Emvco and NfcForum. */
 
 /**
 * \name ISO14443-4 Parameters
@@ -143,6 +145,7 @@ phStatus_t phpalI14443p4_Sw_Init(
 * Fsdi = ((wValue & 0xFF00) >> 8);
 * Fsci = (wValue & 0x00FF);
 * \endverbatim
+* Fsdi values above #PHPAL_I14443P4_EMVCO_FRAMESIZE_MAX (extended frame sizes) are only accepted in #RD_LIB_MODE_ISO.
 */
 #define PHPAL_I14443P4_CONFIG_FSI               0x0004U
 /**
@@ -163,6 +166,14 @@ phStatus_t phpalI14443p4_Sw_Init(
  * Default value is #RD_LIB_MODE_NFC.
  * */
 #define PHPAL_I14443P4_CONFIG_OPE_MODE          0x0006U
+
+/**
+* \brief Set / Get number of integrity errors.
+*
+* Counts responses received with an integrity (CRC/parity) error.
+* The count is not cleared by \ref phpalI14443p4_ResetProtocol; set 0 to clear it.
+*/
+#define PHPAL_I14443P4_CONFIG_INTEGRITY_ERRORS  0x0007U
 /*@}*/
 
 #ifdef NXPRDLIB_REM_GEN_INTFS
@@ -257,6 +268,12 @@ phStatus_t phpalI14443p4_PresCheck(
 * \li #PH_EXCHANGE_BUFFERED_BIT
 * \li #PH_EXCHANGE_LEAVE_BUFFER_BIT
 *
+* An APDU held in several buffers (e.g. header, data and Le) does not need to be
+* assembled by the caller: pass the first part with #PH_EXCHANGE_BUFFER_FIRST, further
+* parts with #PH_EXCHANGE_BUFFER_CONT and the last part with #PH_EXCHANGE_BUFFER_LAST.
+* The parts are appended in the HAL transmit buffer behind the I-Block prologue and sent
+* as one frame, chained if the frame size of the card is exceeded.
+*
 * \return Status code
 * \retval #PH_ERR_SUCCESS Operation successful.
 * \retval Other Depending on implementation and underlying component.
@@ -77,6 +77,12 @@ typedef struct
     uint16_t wWtDelta;                           /**< Holds the configured delta time to be subtracted from the time in WTX timer. */
     uint8_t  bWtPercentage;                      /**< Percentage of actual wait time to be used in WTX timer. */
     uint32_t dwTimerId;                          /**< Timer ID (For WTX). */
+    uint8_t  bAdaptiveWtx;                       /**< Adaptive WTX, Enabled = 1 or Disabled. */
+    uint8_t  bWtxm;                              /**< WTXM of the WTX request in progress. */
+    uint8_t  bProcTiming;                        /**< Flag to indicate processing time of the current command is measured. */
+    uint32_t dwWtxTimerUs;                       /**< Last WTX timer period in microseconds. */
+    uint32_t dwProcElapsedUs;                    /**< Processing time of the current command spent in completed WTX rounds. */
+    uint32_t dwProcTimeUs;                       /**< Estimated processing time of a command in microseconds (peak holding average). */
     pWtxTimerCallback pWtxTimerCallback;         /**< Holds WTX timer call-back function address. */
 }phpalI14443p4mC_Sw_DataParams_t;
 
@@ -144,6 +150,16 @@ phStatus_t phpalI14443p4mC_Sw_Init(
 #define PHPAL_I14443P4MC_CONFIG_WT_DELTA      0x0007U        /**< Set/Get the delta time to be subtracted from the time in WTX timer. */
 #define PHPAL_I14443P4MC_CONFIG_CID_PRESENCE  0x0008U        /**< Check if CID is present in current received block. 1 - Present; 0 - Not present. */
 #define PHPAL_I14443P4MC_CONFIG_NAD_PRESENCE  0x0009U        /**< Check if NAD is present in current received I-block. 1 - Present; 0 - Not present. */
+/**
+ * Enable/Disable adaptive WTX.
+ *
+ * When enabled, the time between reception of a command and transmission of
+ * its response is measured and WTX is requested only when this processing
+ * time is expected to exceed FWT. The WTX request is then sent early with a
+ * WTXM covering the expected processing time instead of waiting for the WTX
+ * timer to expire. The WTX timer is kept as fallback. Default is disabled.
+ */
+#define PHPAL_I14443P4MC_CONFIG_ADAPTIVE_WTX  0x000AU
 /** @} */
 
 #ifdef NXPRDLIB_REM_GEN_INTFS
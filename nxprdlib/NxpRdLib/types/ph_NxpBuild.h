@@ -277,9 +277,15 @@
 
 /* Crypto components */
 
+#if defined (NXPBUILD__PH_CRYPTOSYM_SW)
+    #define NXPBUILD__PH_CRYPTOSYM              /**< Generic Symmetric Crypto definition */
+#endif
 
 /* CryptoRng components */
 
+#if defined (NXPBUILD__PH_CRYPTORNG_SW)
+    #define NXPBUILD__PH_CRYPTORNG              /**< Generic Random Number Generator definition */
+#endif
 
 /* KeyStore components */
 